@@ -23,44 +23,11 @@
 #include <GLES3/gl3.h>
 
 // ─── Series engine headers ──────────────────────────────────────────────────
+#include "series/PrimeSieve.h"
 #include "series/SeriesManager.h"
 
-// ─── Compute: Segmented Sieve of Eratosthenes (C++20) ──────────────────────
-
-namespace detail {
-
-auto sieve_primes(std::uint32_t limit) -> std::vector<std::uint32_t> {
-    if (limit < 2) return {};
-
-    std::vector<bool> is_prime(limit + 1, true);
-    is_prime[0] = is_prime[1] = false;
-
-    for (std::uint32_t i = 2; i * i <= limit; ++i) {
-        if (is_prime[i]) {
-            for (std::uint32_t j = i * i; j <= limit; j += i) {
-                is_prime[j] = false;
-            }
-        }
-    }
-
-    auto indices = std::views::iota(std::uint32_t{0}, limit + 1);
-    auto primes_view = indices | std::views::filter([&](std::uint32_t n) {
-        return is_prime[n];
-    });
-
-    std::vector<std::uint32_t> result;
-    result.reserve(static_cast<std::size_t>(
-        static_cast<double>(limit) / std::log(static_cast<double>(limit) + 1) * 1.3
-    ));
-    std::ranges::copy(primes_view, std::back_inserter(result));
-
-    return result;
-}
-
-} // namespace detail
-
 auto computePrimes(std::uint32_t limit) -> std::string {
-    auto primes = detail::sieve_primes(limit);
+    auto primes = PrimeSieve::upTo(limit);
 
     if (primes.empty()) return "No primes found.";
 
@@ -114,6 +81,39 @@ void renderFrame(float r, float g, float b) {
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 }
 
+// ─── JS adapters for SeriesManager ──────────────────────────────────────────
+
+/// onChunk(bytes: Uint8Array, firstRow: number, rows: number) -> boolean | void
+/// `bytes` views WASM memory directly and is only valid during the call;
+/// returning `false` stops the export.
+auto exportPartialSums(SeriesManager& mgr, const std::string& series, double terms,
+                       int format, int chunkRows, emscripten::val onChunk) -> std::string {
+    return mgr.exportPartialSums(
+        series, terms, format, chunkRows,
+        [&onChunk](std::span<const std::uint8_t> bytes, std::uint64_t firstRow,
+                   std::uint32_t rows) {
+            const emscripten::val more =
+                onChunk(emscripten::val(emscripten::typed_memory_view(bytes.size(), bytes.data())),
+                        static_cast<double>(firstRow), rows);
+            return !more.isFalse();
+        });
+}
+
+/// Snapshot as a fresh Uint8Array (copied out of WASM memory).
+auto serializeSnapshot(SeriesManager& mgr, bool includeCaches) -> emscripten::val {
+    const std::vector<std::uint8_t> blob = mgr.serialize(includeCaches);
+    return emscripten::val(emscripten::typed_memory_view(blob.size(), blob.data()))
+        .call<emscripten::val>("slice");
+}
+
+/// Copy a Uint8Array into WASM memory in one `set()` and restore from it.
+auto deserializeSnapshot(SeriesManager& mgr, emscripten::val bytes) -> bool {
+    std::vector<std::uint8_t> blob(bytes["length"].as<std::size_t>());
+    emscripten::val(emscripten::typed_memory_view(blob.size(), blob.data()))
+        .call<void>("set", bytes);
+    return mgr.deserialize(blob);
+}
+
 // ─── Embind exports ─────────────────────────────────────────────────────────
 
 EMSCRIPTEN_BINDINGS(engine) {
@@ -129,6 +129,18 @@ EMSCRIPTEN_BINDINGS(engine) {
         .function("render",               &SeriesManager::render)
         .function("setActiveVisualizer",   &SeriesManager::setActiveVisualizer)
         .function("getActiveVisualizer",   &SeriesManager::getActiveVisualizer)
+        .function("getPlotScale",          &SeriesManager::getPlotScale)
+        .function("getPlotReadout",        &SeriesManager::getPlotReadout)
         .function("setParam",             &SeriesManager::setParam)
-        .function("setView",              &SeriesManager::setView);
+        .function("setView",              &SeriesManager::setView)
+        .function("setStreamMode",        &SeriesManager::setStreamMode)
+        .function("setVertexPulling",     &SeriesManager::setVertexPulling)
+        .function("setBatching",          &SeriesManager::setBatching)
+        .function("setGpuBifurcation",    &SeriesManager::setGpuBifurcation)
+        .function("setPipelineDepth",     &SeriesManager::setPipelineDepth)
+        .function("setFrameBudget",       &SeriesManager::setFrameBudget)
+        .function("getStats",             &SeriesManager::getStats)
+        .function("exportPartialSums",    &exportPartialSums)
+        .function("serialize",            &serializeSnapshot)
+        .function("deserialize",          &deserializeSnapshot);
 }
@@ -0,0 +1,209 @@
+// ─── WizSeries: Strange Attractor Visualizer ────────────────────────────────
+// Density images of the Hénon, Clifford and Lozi attractors: hundreds of
+// orbits (StrangeAttractor) binned at canvas resolution and log tone-mapped,
+// so the faint filaments show beside the heavily visited folds.
+//
+// Points accumulate as an incremental task up to "samples" million, paused
+// while another visualizer is on screen.  Changing a parameter starts over
+// with a new window from a pilot orbit; parameters whose orbit escapes draw
+// nothing.  The counts are cached across frames and saved in snapshots, and
+// pointStats() reports the generation rate.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include "ISeriesVisualizer.h"
+#include "StrangeAttractor.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <vector>
+
+class AttractorVisualizer : public ISeriesVisualizer {
+public:
+    AttractorVisualizer() {
+        params_["attractor"]  = 1.0f;
+        params_["henon_a"]    = 1.4f;
+        params_["henon_b"]    = 0.3f;
+        params_["clifford_a"] = -1.4f;
+        params_["clifford_b"] = 1.6f;
+        params_["clifford_c"] = 1.0f;
+        params_["clifford_d"] = 0.7f;
+        params_["lozi_a"]     = 1.7f;
+        params_["lozi_b"]     = 0.5f;
+        params_["samples"]    = 100.0f;
+    }
+
+    void render(float /*time*/, float width, float height,
+                IRenderer& gl) override {
+        const AttractorSpec spec = currentSpec();
+        const double millions = std::clamp(getParam("samples", 100.0f), 0.1f, 100000.0f);
+
+        if (spec_ != spec) {
+            if (tasks_) tasks_->cancel(task_);
+            task_   = 0;
+            spec_   = spec;
+            window_ = StrangeAttractor::locate(spec);
+            ready_  = false;
+        }
+        if (!window_) return;
+
+        // Same margins as the other plots, with the attractor's aspect kept
+        constexpr float mLeft   = 0.14f;
+        constexpr float mRight  = 0.06f;
+        constexpr float mBottom = 0.10f;
+        constexpr float mTop    = 0.08f;
+
+        const PlaneWindow& win = *window_;
+        const float plotW  = 0.5f * (2.0f - mLeft - mRight) * width;    // pixels
+        const float plotH  = 0.5f * (2.0f - mBottom - mTop) * height;
+        const float aspect = (win.x1 - win.x0) / (win.y1 - win.y0);
+        const float fitW   = std::clamp(std::min(plotW, plotH * aspect), 1.0f, plotW);
+        const float fitH   = std::clamp(fitW / aspect, 1.0f, plotH);
+        const float cx     = -1.0f + mLeft + plotW / width;     // plot centre in clip space
+        const float cy     = -1.0f + mBottom + plotH / height;
+        const float halfW  = fitW / width;
+        const float halfH  = fitH / height;
+
+        ensureOrbits(std::clamp(static_cast<int>(fitW), 16, kMaxBins),
+                     std::clamp(static_cast<int>(fitH), 16, kMaxBins),
+                     static_cast<std::uint64_t>(millions * 1e6));
+
+        const Style& style = kStyles[static_cast<int>(spec.kind)];
+        DensityDraw d = orbits_.density().draw(cx - halfW, cx + halfW, cy - halfH, cy + halfH);
+        d.hue      = style.hue;
+        d.hueShift = style.hueShift;
+        d.sat      = 0.80f;
+        d.val      = 0.45f;
+        drawDensity(gl, d);
+    }
+
+    [[nodiscard]] PointStats pointStats() const override {
+        return {ready_ ? orbits_.samples() : 0, rate_};
+    }
+
+    void saveCache(BlobWriter& out) const override {
+        if (!ready_) return;
+        const AttractorSpec& s = orbits_.spec();
+        const DensityBuffer& d = orbits_.density();
+        out.put(static_cast<std::int32_t>(s.kind));
+        out.put(s.a);
+        out.put(s.b);
+        out.put(s.c);
+        out.put(s.d);
+        out.put(static_cast<std::int32_t>(d.width()));
+        out.put(static_cast<std::int32_t>(d.height()));
+        out.put(static_cast<std::uint64_t>(orbits_.samples()));
+        out.putArray(d.counts());
+    }
+
+    bool loadCache(BlobReader& in) override {
+        AttractorSpec s;
+        const auto kind = in.get<std::int32_t>();
+        s.a = in.get<float>();
+        s.b = in.get<float>();
+        s.c = in.get<float>();
+        s.d = in.get<float>();
+        const auto w       = in.get<std::int32_t>();
+        const auto h       = in.get<std::int32_t>();
+        const auto samples = in.get<std::uint64_t>();
+        std::vector<std::uint32_t> counts;
+        if (!in.getArray(counts) || kind < 0 || kind >= kKindCount || w <= 0 || h <= 0 ||
+            counts.size() != static_cast<std::size_t>(w) * static_cast<std::size_t>(h))
+            return false;
+        s.kind = static_cast<AttractorKind>(kind);
+        const std::optional<PlaneWindow> window = StrangeAttractor::locate(s);
+        if (!window) return false;
+
+        if (tasks_) tasks_->cancel(task_);
+        task_   = 0;
+        spec_   = s;
+        window_ = window;
+        startOrbits(w, h);
+        return orbits_.restore(counts, samples);
+    }
+
+private:
+    struct Style {
+        float hue;
+        float hueShift;
+    };
+
+    // Indexed by AttractorKind (the "attractor" parameter)
+    static constexpr Style kStyles[] = {
+        {0.60f, -0.10f},   // Hénon: blue into violet
+        {0.88f,  0.14f},   // Clifford: magenta into orange
+        {0.45f,  0.15f},   // Lozi: teal into blue
+    };
+    static constexpr int kKindCount = static_cast<int>(std::size(kStyles));
+
+    static constexpr int           kMaxBins       = 2048;   // per axis
+    static constexpr std::uint64_t kSamplesPerRun = std::uint64_t{1} << 20;
+    static constexpr std::uint64_t kSeed          = 0x48656E6F6Eull;
+
+    StrangeAttractor             orbits_;
+    std::optional<AttractorSpec> spec_;            // parameters window_ was located for
+    std::optional<PlaneWindow>   window_;
+    bool                         ready_  = false;  // orbits_ holds spec_ at window_
+    std::uint64_t                target_ = 0;
+    double                       rate_   = 0.0;    // samples per second of the last run
+    TaskScheduler::TaskId        task_   = 0;
+
+    [[nodiscard]] AttractorSpec currentSpec() const {
+        AttractorSpec s;
+        s.kind = static_cast<AttractorKind>(
+            std::clamp(static_cast<int>(getParam("attractor", 1.0f)), 0, kKindCount - 1));
+        switch (s.kind) {
+            case AttractorKind::Henon:
+                s.a = getParam("henon_a", 1.4f);
+                s.b = getParam("henon_b", 0.3f);
+                break;
+            case AttractorKind::Clifford:
+                s.a = getParam("clifford_a", -1.4f);
+                s.b = getParam("clifford_b", 1.6f);
+                s.c = getParam("clifford_c", 1.0f);
+                s.d = getParam("clifford_d", 0.7f);
+                break;
+            case AttractorKind::Lozi:
+                s.a = getParam("lozi_a", 1.7f);
+                s.b = getParam("lozi_b", 0.5f);
+                break;
+        }
+        return s;
+    }
+
+    void startOrbits(int w, int h) {
+        orbits_.reset(*spec_, *window_, w, h, kSeed);
+        ready_  = true;
+        target_ = 0;
+        rate_   = 0.0;
+    }
+
+    /// Restart the orbits for new bins, and keep a task refining towards
+    /// `target` samples.
+    void ensureOrbits(int w, int h, std::uint64_t target) {
+        const DensityBuffer& d = orbits_.density();
+        if (!ready_ || w != d.width() || h != d.height()) {
+            if (tasks_) tasks_->cancel(task_);
+            task_ = 0;
+            startOrbits(w, h);
+        }
+        target_ = target;
+        if (orbits_.samples() >= target || (tasks_ && task_ && tasks_->pending(task_))) return;
+        task_ = spawnTask(tasks_, "attractor", accumulate(), this);
+    }
+
+    Task accumulate() {
+        while (orbits_.samples() < target_) {
+            const auto          t0     = std::chrono::steady_clock::now();
+            const std::uint64_t before = orbits_.samples();
+            orbits_.run(std::min(kSamplesPerRun, target_ - orbits_.samples()), jobs_);
+            const std::chrono::duration<double> took = std::chrono::steady_clock::now() - t0;
+            rate_ = static_cast<double>(orbits_.samples() - before) / took.count();
+            co_await Checkpoint{static_cast<float>(orbits_.samples()) /
+                                static_cast<float>(target_)};
+        }
+    }
+};
@@ -0,0 +1,198 @@
+// ─── WizSeries: BBP Digit Extraction ────────────────────────────────────────
+// Hexadecimal digits of π from any position without the ones before it, by
+// the Bailey–Borwein–Plouffe formula
+//
+//   π = Σ 16⁻ᵏ (4/(8k+1) − 2/(8k+4) − 1/(8k+5) − 1/(8k+6)).
+//
+// Multiplying by 16ᵈ, the fractional part of 16ᵈπ — hex digits d + 1 on —
+// needs only {16ᵈ⁻ᵏ / m} for each k ≤ d, which is (16ᵈ⁻ᵏ mod m) / m, plus
+// a few tail terms after d.  The modular powers run 2⁴⁽ᵈ⁻ᵏ⁾ by squaring with
+// Barrett reduction in 64-bit words (128-bit products only for moduli past
+// 2³², positions beyond 5·10⁸), the four moduli of one k in lockstep so
+// their squarings overlap.  Each term is taken exactly as a 64-bit binary
+// fraction, rounded down, and summed modulo 1 by wrapping integer addition:
+// the sum is the same however the k range is split across threads, and
+// off by at most 8 units per term, so the digits that bound leaves exact
+// (reliableDigits: 8 at position 10⁸) are returned.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include "JobSystem.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+class BbpPi {
+public:
+    static constexpr std::uint64_t kMaxPosition = std::uint64_t{1} << 40;
+
+    /// The hex digits of `fraction` that the error bound at position `d`
+    /// leaves exact (10 at 10⁶, 8 at 10⁸).
+    static int reliableDigits(std::uint64_t d) {
+        const auto errorBits = static_cast<int>(std::bit_width(8 * (d + 16)));
+        return std::max(0, (64 - errorBits - 1) / 4);
+    }
+
+    /// {16ᵈπ} as a 64-bit binary fraction: hex digits d + 1 … d + 16.
+    static std::uint64_t fraction(std::uint64_t d, JobSystem* jobs = nullptr) {
+        return terms(d, 0, d + 1, jobs) + tail(d);
+    }
+
+    /// The part of fraction(d) from the terms k0 ≤ k < k1 (k ≤ d), to be
+    /// added up modulo 2⁶⁴ with the other ranges and tail(d) — for callers
+    /// that spread one deep position over several steps.
+    static std::uint64_t terms(std::uint64_t d, std::uint64_t k0, std::uint64_t k1,
+                               JobSystem* jobs = nullptr) {
+        k1 = std::min(k1, d + 1);
+        if (k0 >= k1) return 0;
+        std::atomic<std::uint64_t> sum{0};
+        parallelFor(jobs, 0, (k1 - k0 + kBlockTerms - 1) / kBlockTerms, 1,
+                    [&](std::size_t lo, std::size_t hi) {
+            sum.fetch_add(headSum(d, k0 + lo * kBlockTerms,
+                                  std::min(k1, k0 + hi * kBlockTerms)),
+                          std::memory_order_relaxed);
+        });
+        return sum.load(std::memory_order_relaxed);
+    }
+
+    /// The terms after k = d, while 16ᵈ⁻ᵏ still reaches 2⁻⁶⁴.
+    static std::uint64_t tail(std::uint64_t d) {
+        std::uint64_t s[4] = {0, 0, 0, 0};
+        for (std::uint64_t t = 1; t < 16; ++t)
+            for (int j = 0; j < 4; ++j)
+                s[j] += (std::uint64_t{1} << (64 - 4 * t)) / (8 * (d + t) + kOffsets[j]);
+        return 4 * s[0] - 2 * s[1] - s[2] - s[3];
+    }
+
+    /// fraction(positions[i]) into out[i], the terms of every position
+    /// split into blocks shared out over the job system together.
+    static void fractions(std::span<const std::uint64_t> positions,
+                          std::span<std::uint64_t> out, JobSystem* jobs = nullptr) {
+        // Block b of the flattened k ranges belongs to position p where
+        // first[p] ≤ b < first[p + 1].
+        std::vector<std::size_t> first(positions.size() + 1, 0);
+        for (std::size_t p = 0; p < positions.size(); ++p)
+            first[p + 1] = first[p] + static_cast<std::size_t>(positions[p] / kBlockTerms + 1);
+
+        std::vector<std::atomic<std::uint64_t>> sums(positions.size());
+        parallelFor(jobs, 0, first.back(), 1, [&](std::size_t lo, std::size_t hi) {
+            std::size_t p = static_cast<std::size_t>(
+                std::upper_bound(first.begin(), first.end(), lo) - first.begin() - 1);
+            for (std::size_t b = lo; b < hi; ++b) {
+                while (b >= first[p + 1]) ++p;
+                const std::uint64_t d  = positions[p];
+                const std::uint64_t k0 = (b - first[p]) * kBlockTerms;
+                const std::uint64_t k1 = std::min(d + 1, k0 + kBlockTerms);
+                sums[p].fetch_add(headSum(d, k0, k1), std::memory_order_relaxed);
+            }
+        });
+        for (std::size_t p = 0; p < positions.size(); ++p)
+            out[p] = sums[p].load(std::memory_order_relaxed) + tail(positions[p]);
+    }
+
+    /// `count` hex digits of π after the first `d` (uppercase; "243F6A88…"
+    /// at d = 0), or none where the error bound leaves no digit exact.
+    static std::string hexDigits(std::uint64_t d, int count, JobSystem* jobs = nullptr) {
+        const int step = reliableDigits(d + static_cast<std::uint64_t>(count));
+        if (step == 0) return {};
+        std::vector<std::uint64_t> positions;
+        for (int i = 0; i < count; i += step)
+            positions.push_back(d + static_cast<std::uint64_t>(i));
+        std::vector<std::uint64_t> fracs(positions.size());
+        fractions(positions, fracs, jobs);
+
+        std::string digits;
+        for (const std::uint64_t f : fracs) digits += toHex(f, step);
+        digits.resize(static_cast<std::size_t>(count));
+        return digits;
+    }
+
+    /// The leading `digits` hex digits of a binary fraction.
+    static std::string toHex(std::uint64_t fraction, int digits) {
+        static constexpr char kHex[] = "0123456789ABCDEF";
+        std::string s;
+        for (int i = 0; i < digits; ++i, fraction <<= 4) s += kHex[fraction >> 60];
+        return s;
+    }
+
+private:
+    static constexpr std::uint64_t kBlockTerms = std::uint64_t{1} << 15;
+    static constexpr std::uint64_t kFastLimit  = (std::uint64_t{1} << 32) / 8 - 1;   // 8k+6 < 2³²
+    static constexpr std::uint64_t kOffsets[4] = {1, 4, 5, 6};
+
+    using u128 = unsigned __int128;
+
+    /// A modulus below 2³² with its Barrett reciprocal ⌊(2⁶⁴ − 1) / m⌋.
+    struct Barrett {
+        std::uint64_t m;
+        std::uint64_t inv;
+
+        explicit Barrett(std::uint64_t mod) : m(mod), inv(~std::uint64_t{0} / mod) {}
+
+        /// x mod m (the quotient estimate is at most two short).
+        [[nodiscard]] std::uint64_t reduce(std::uint64_t x) const {
+            std::uint64_t r = x - mulHigh(x, inv) * m;
+            if (r >= m) r -= m;
+            if (r >= m) r -= m;
+            return r;
+        }
+
+        /// ⌊r · 2⁶⁴ / m⌋ for r < m: r · inv, plus the quotient of what that
+        /// leaves, r · (2⁶⁴ − inv · m) < m².
+        [[nodiscard]] std::uint64_t fraction(std::uint64_t r) const {
+            const std::uint64_t left = r * (0 - inv * m);
+            std::uint64_t       q    = mulHigh(left, inv);
+            std::uint64_t       rem  = left - q * m;
+            while (rem >= m) {
+                rem -= m;
+                ++q;
+            }
+            return r * inv + q;
+        }
+    };
+
+    static std::uint64_t mulHigh(std::uint64_t a, std::uint64_t b) {
+        return static_cast<std::uint64_t>((static_cast<u128>(a) * b) >> 64);
+    }
+
+    /// Wrapped sum of the four weighted terms over k in [k0, k1), k ≤ d.
+    static std::uint64_t headSum(std::uint64_t d, std::uint64_t k0, std::uint64_t k1) {
+        std::uint64_t s[4] = {0, 0, 0, 0};
+        std::uint64_t k    = k0;
+        for (; k < std::min(k1, kFastLimit + 1); ++k) {
+            const Barrett mod[4] = {Barrett(8 * k + 1), Barrett(8 * k + 4),
+                                    Barrett(8 * k + 5), Barrett(8 * k + 6)};
+            // 2^(4(d − k)): the leading five exponent bits at once, then
+            // square-and-double through the rest.
+            const std::uint64_t e     = 4 * (d - k);
+            const int           shift = std::max(0, static_cast<int>(std::bit_width(e)) - 5);
+            std::uint64_t       r[4];
+            for (int j = 0; j < 4; ++j) r[j] = mod[j].reduce(std::uint64_t{1} << (e >> shift));
+            for (int bit = shift - 1; bit >= 0; --bit) {
+                const int up = static_cast<int>((e >> bit) & 1);   // no branch to mispredict
+                for (int j = 0; j < 4; ++j) {
+                    r[j] = mod[j].reduce(r[j] * r[j]) << up;
+                    if (r[j] >= mod[j].m) r[j] -= mod[j].m;
+                }
+            }
+            for (int j = 0; j < 4; ++j) s[j] += mod[j].fraction(r[j]);
+        }
+        for (; k < k1; ++k)
+            for (int j = 0; j < 4; ++j) s[j] += wideTerm(d - k, 8 * k + kOffsets[j]);
+        return 4 * s[0] - 2 * s[1] - s[2] - s[3];
+    }
+
+    /// ⌊{16ᵉ / m} · 2⁶⁴⌋ for moduli past 2³², in 128-bit arithmetic.
+    static std::uint64_t wideTerm(std::uint64_t e, std::uint64_t m) {
+        u128 base = 16 % m, r = 1 % m;
+        for (; e; e >>= 1, base = base * base % m)
+            if (e & 1) r = r * base % m;
+        return static_cast<std::uint64_t>((r << 64) / m);
+    }
+};
@@ -2,21 +2,42 @@
 // Renders the recursive middle-thirds removal that produces the Cantor set.
 // Each level is drawn as a row of coloured bars; deeper levels fade in over
 // time to animate the infinite descent.
+//
+// In IFS mode ("mode" = 1) the same self-similarity is played as a chaos
+// game instead: Cantor dust and three other attractors of iterated function
+// systems fill in from random walkers (ChaosGame), accumulated as an
+// incremental task up to "samples" million points and drawn as a density
+// image.  The counts are cached across frames and saved in snapshots.
 // ─────────────────────────────────────────────────────────────────────────────
 #pragma once
 
+#include "ChaosGame.h"
 #include "ISeriesVisualizer.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <span>
 #include <vector>
 
 class CantorSetVisualizer : public ISeriesVisualizer {
 public:
-    CantorSetVisualizer() { params_["depth"] = 6.0f; }
+    CantorSetVisualizer() {
+        params_["depth"]   = 6.0f;
+        params_["mode"]    = 0.0f;
+        params_["ifs"]     = 0.0f;
+        params_["samples"] = 1000.0f;
+    }
 
     void render(float time, float width, float height,
-                GLRenderer& gl) override {
+                IRenderer& gl) override {
+        if (getParam("mode", 0.0f) >= 0.5f) {
+            renderIfs(width, height, gl);
+            return;
+        }
+
         const int depth =
             std::clamp(static_cast<int>(getParam("depth", 6.0f)), 1, 12);
 
@@ -39,7 +60,7 @@ public:
         const float revealed = time * 1.5f;
 
         std::vector<Vertex> quads;
-        quads.reserve(static_cast<size_t>(6 * ((1 << (depth + 1)) - 1)));
+        quads.reserve(static_cast<size_t>(4 * ((1 << (depth + 1)) - 1)));
 
         generateCantor(quads, 0.0f, 1.0f, 0, depth,
                        xMin, xMax, yMax, barH, gap, revealed);
@@ -66,12 +87,166 @@ public:
             axes.push_back({xMin + 0.01f,  y, 0.30f, 0.28f, 0.26f, 0.7f});
         }
 
+        gl.setLayer(0);
         gl.drawLines(grid);
-        gl.drawTriangles(quads);
+        gl.setLayer(1);
+        gl.drawQuads(quads);
+        gl.setLayer(2);
         gl.drawLines(axes);
     }
 
+    [[nodiscard]] PointStats pointStats() const override {
+        if (getParam("mode", 0.0f) < 0.5f) return {};
+        return {game_.samples(), game_rate_};
+    }
+
+    void saveCache(BlobWriter& out) const override {
+        if (game_system_ < 0) return;
+        const DensityBuffer& d = game_.density();
+        out.put(static_cast<std::int32_t>(game_system_));
+        out.put(static_cast<std::int32_t>(d.width()));
+        out.put(static_cast<std::int32_t>(d.height()));
+        out.put(static_cast<std::uint64_t>(game_.samples()));
+        out.putArray(d.counts());
+    }
+
+    bool loadCache(BlobReader& in) override {
+        const auto system  = in.get<std::int32_t>();
+        const auto w       = in.get<std::int32_t>();
+        const auto h       = in.get<std::int32_t>();
+        const auto samples = in.get<std::uint64_t>();
+        std::vector<std::uint32_t> counts;
+        if (!in.getArray(counts) || system < 0 || system >= kSystemCount || w <= 0 || h <= 0 ||
+            counts.size() != static_cast<std::size_t>(w) * static_cast<std::size_t>(h))
+            return false;
+        if (tasks_) tasks_->cancel(task_);
+        startGame(system, w, h);
+        return game_.restore(counts, samples);
+    }
+
 private:
+    /// An iterated function system and the window of the plane holding its
+    /// attractor.
+    struct IfsSystem {
+        std::span<const AffineMap> maps;
+        PlaneWindow                window;
+        float                      hue;
+    };
+
+    static constexpr AffineMap kCantorDust[] = {
+        {1.0f / 3, 0, 0, 1.0f / 3, 0,        0,        1},
+        {1.0f / 3, 0, 0, 1.0f / 3, 2.0f / 3, 0,        1},
+        {1.0f / 3, 0, 0, 1.0f / 3, 0,        2.0f / 3, 1},
+        {1.0f / 3, 0, 0, 1.0f / 3, 2.0f / 3, 2.0f / 3, 1},
+    };
+    static constexpr AffineMap kSierpinski[] = {
+        {0.5f, 0, 0, 0.5f, 0,     0,          1},
+        {0.5f, 0, 0, 0.5f, 0.5f,  0,          1},
+        {0.5f, 0, 0, 0.5f, 0.25f, 0.4330127f, 1},
+    };
+    static constexpr AffineMap kCarpet[] = {
+        {1.0f / 3, 0, 0, 1.0f / 3, 0,        0,        1},
+        {1.0f / 3, 0, 0, 1.0f / 3, 1.0f / 3, 0,        1},
+        {1.0f / 3, 0, 0, 1.0f / 3, 2.0f / 3, 0,        1},
+        {1.0f / 3, 0, 0, 1.0f / 3, 0,        1.0f / 3, 1},
+        {1.0f / 3, 0, 0, 1.0f / 3, 2.0f / 3, 1.0f / 3, 1},
+        {1.0f / 3, 0, 0, 1.0f / 3, 0,        2.0f / 3, 1},
+        {1.0f / 3, 0, 0, 1.0f / 3, 1.0f / 3, 2.0f / 3, 1},
+        {1.0f / 3, 0, 0, 1.0f / 3, 2.0f / 3, 2.0f / 3, 1},
+    };
+    static constexpr AffineMap kFern[] = {   // Barnsley's weights
+        { 0.00f,  0.00f,  0.00f, 0.16f, 0, 0.00f, 0.01f},
+        { 0.85f,  0.04f, -0.04f, 0.85f, 0, 1.60f, 0.85f},
+        { 0.20f, -0.26f,  0.23f, 0.22f, 0, 1.60f, 0.07f},
+        {-0.15f,  0.28f,  0.26f, 0.24f, 0, 0.44f, 0.07f},
+    };
+
+    // Indexed by the "ifs" parameter; the front end lists the same.
+    static constexpr IfsSystem kSystems[] = {
+        {kCantorDust, {0.0f, 1.0f, 0.0f, 1.0f},          0.72f},
+        {kSierpinski, {0.0f, 1.0f, 0.0f, 0.8660254f},    0.60f},
+        {kCarpet,     {0.0f, 1.0f, 0.0f, 1.0f},          0.80f},
+        {kFern,       {-2.1820f, 2.6558f, 0.0f, 9.9983f}, 0.36f},
+    };
+    static constexpr int kSystemCount = static_cast<int>(std::size(kSystems));
+
+    static constexpr int           kMaxBins       = 2048;           // per axis
+    static constexpr std::uint64_t kSamplesPerRun = std::uint64_t{1} << 19;
+    static constexpr std::uint64_t kSeed          = 0x43616E746F72ull;
+
+    ChaosGame             game_;
+    int                   game_system_ = -1;   // system game_ holds, if any
+    std::uint64_t         game_target_ = 0;    // samples the task works towards
+    TaskScheduler::TaskId task_        = 0;
+    double                game_rate_   = 0.0;  // samples per second of the last run
+
+    void renderIfs(float width, float height, IRenderer& gl) {
+        const int system = std::clamp(static_cast<int>(getParam("ifs", 0.0f)), 0,
+                                      kSystemCount - 1);
+        const double millions = std::clamp(getParam("samples", 1000.0f), 0.1f, 100000.0f);
+        const IfsSystem& sys = kSystems[system];
+
+        // Same margins as the bars, with the attractor's aspect ratio kept
+        constexpr float mLeft   = 0.14f;
+        constexpr float mRight  = 0.06f;
+        constexpr float mBottom = 0.10f;
+        constexpr float mTop    = 0.08f;
+
+        const float plotW  = 0.5f * (2.0f - mLeft - mRight) * width;    // pixels
+        const float plotH  = 0.5f * (2.0f - mBottom - mTop) * height;
+        const float aspect = (sys.window.x1 - sys.window.x0) / (sys.window.y1 - sys.window.y0);
+        const float fitW   = std::min(plotW, plotH * aspect);
+        const float fitH   = fitW / aspect;
+        const float cx     = -1.0f + mLeft + plotW / width;     // plot centre in clip space
+        const float cy     = -1.0f + mBottom + plotH / height;
+        const float halfW  = fitW / width;
+        const float halfH  = fitH / height;
+
+        ensureGame(system, std::clamp(static_cast<int>(fitW), 16, kMaxBins),
+                   std::clamp(static_cast<int>(fitH), 16, kMaxBins),
+                   static_cast<std::uint64_t>(millions * 1e6));
+
+        DensityDraw d = game_.density().draw(cx - halfW, cx + halfW, cy - halfH, cy + halfH);
+        d.hue      = sys.hue;
+        d.hueShift = -0.12f;
+        d.sat      = 0.75f;
+        d.val      = 0.50f;
+        drawDensity(gl, d);
+    }
+
+    void startGame(int system, int w, int h) {
+        game_.reset(kSystems[system].maps, kSystems[system].window, w, h, kSeed);
+        game_system_ = system;
+        game_target_ = 0;
+    }
+
+    /// Restart the chaos game for a new system or bin size, and keep a task
+    /// accumulating until `target` samples are in.  Raising the target
+    /// continues from the points already binned.
+    void ensureGame(int system, int w, int h, std::uint64_t target) {
+        const DensityBuffer& d = game_.density();
+        if (system != game_system_ || w != d.width() || h != d.height()) {
+            if (tasks_) tasks_->cancel(task_);
+            task_ = 0;
+            startGame(system, w, h);
+        }
+        game_target_ = target;
+        if (game_.samples() >= target || (tasks_ && task_ && tasks_->pending(task_))) return;
+        task_ = spawnTask(tasks_, "chaos game", accumulate(), this);
+    }
+
+    Task accumulate() {
+        while (game_.samples() < game_target_) {
+            const auto          t0     = std::chrono::steady_clock::now();
+            const std::uint64_t before = game_.samples();
+            game_.run(std::min(kSamplesPerRun, game_target_ - game_.samples()), jobs_);
+            const std::chrono::duration<double> took = std::chrono::steady_clock::now() - t0;
+            game_rate_ = static_cast<double>(game_.samples() - before) / took.count();
+            co_await Checkpoint{static_cast<float>(game_.samples()) /
+                                static_cast<float>(game_target_)};
+        }
+    }
+
     void generateCantor(std::vector<Vertex>& quads,
                         float left, float right,
                         int level, int maxDepth,
@@ -0,0 +1,171 @@
+// ─── WizSeries: Chaos-Game IFS Engine ───────────────────────────────────────
+// Renders the attractor of an iterated function system — a handful of
+// contracting affine maps, such as the two that make the Cantor set or the
+// four of Barnsley's fern — by the chaos game: from any start, apply a map
+// picked at random (with its weight) over and over, and the points visited
+// fill the attractor with its natural measure.
+//
+// Walkers run in independent streams of four lanes each: Xoshiro128x4 draws
+// the map choices and the lanes apply their maps side by side in 4-wide
+// vectors, so only binning into the DensityBuffer is scalar.  Each
+// run() splits the streams into contiguous groups, one DensityBuffer slice
+// per group, in parallel; stream states persist, so repeated runs keep
+// adding to the same picture (progressive accumulation to billions of
+// samples).  Counts depend only on the seed and the number of samples,
+// never on the thread count.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include "DensityBuffer.h"
+#include "JobSystem.h"
+#include "Random.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/// (x, y) → (a·x + b·y + e, c·x + d·y + f), chosen with relative `weight`.
+struct AffineMap {
+    float a, b, c, d, e, f;
+    float weight;
+};
+
+class ChaosGame {
+public:
+    static constexpr int           kMaxMaps = 8;
+    static constexpr std::size_t   kStreams = 64;    // × 4 lanes = 256 walkers
+    static constexpr int           kSteps   = 256;   // per lane per round
+    static constexpr std::uint64_t kRound   = kStreams * 4 * kSteps;   // samples
+
+    /// Start over with `maps` (at most kMaxMaps, weights > 0) binned over
+    /// `window` into `width`×`height` bins.
+    void reset(std::span<const AffineMap> maps, const PlaneWindow& window, int width,
+               int height, std::uint64_t seed) {
+        map_count_ = static_cast<int>(std::min<std::size_t>(maps.size(), kMaxMaps));
+        float total = 0.0f;
+        for (int m = 0; m < map_count_; ++m) total += maps[m].weight;
+        float cumulative = 0.0f;
+        for (int m = 0; m < map_count_; ++m) {
+            const AffineMap& f = maps[m];
+            coef_[0][m] = f.a;
+            coef_[1][m] = f.b;
+            coef_[2][m] = f.c;
+            coef_[3][m] = f.d;
+            coef_[4][m] = f.e;
+            coef_[5][m] = f.f;
+            cumulative += f.weight;
+            // Map m is taken while the top 24 random bits stay below this.
+            threshold_[m] = static_cast<std::uint32_t>(
+                std::min(cumulative / total, 1.0f) * 16777216.0f);
+        }
+        window_ = window;
+        density_.resize(width, height);
+        samples_ = 0;
+        seed_    = seed;
+        startStreams(0);
+    }
+
+    /// Continue with fresh walkers after counts were restored from a
+    /// snapshot: reseeded by the sample count, so they repeat none of the
+    /// points already in the counts.
+    bool restore(std::span<const std::uint32_t> counts, std::uint64_t samples) {
+        if (!density_.assign(counts)) return false;
+        samples_ = samples;
+        startStreams(samples);
+        return true;
+    }
+
+    /// Add at least `samples` points (whole rounds) to the density.
+    void run(std::uint64_t samples, JobSystem* jobs) {
+        if (!map_count_ || !density_.bins()) return;
+        const std::uint64_t rounds = (samples + kRound - 1) / kRound;
+        const std::size_t   groups = std::min<std::size_t>(
+            kStreams, jobs ? static_cast<std::size_t>(jobs->workerCount()) + 1 : 1);
+        density_.prepareSlices(groups);
+        for (std::uint64_t r = 0; r < rounds; ++r) {
+            parallelFor(jobs, 0, groups, 1, [&](std::size_t lo, std::size_t hi) {
+                for (std::size_t g = lo; g < hi; ++g)
+                    for (std::size_t s = g * kStreams / groups; s < (g + 1) * kStreams / groups;
+                         ++s)
+                        walk(streams_[s], density_.slice(g));
+            });
+            samples_ += kRound;
+        }
+        density_.mergeSlices(groups, jobs);
+    }
+
+    [[nodiscard]] const DensityBuffer& density() const { return density_; }
+    [[nodiscard]] std::uint64_t        samples() const { return samples_; }
+
+private:
+    struct Stream {
+        Xoshiro128x4 rng;
+        f32x4        x{}, y{};
+    };
+
+    static constexpr int kWarmup = 40;   // steps before plotting: 2⁻⁴⁰ from the attractor
+
+    float         coef_[6][kMaxMaps] = {};   // a … f per map
+    std::uint32_t threshold_[kMaxMaps] = {};
+    int           map_count_ = 0;
+    PlaneWindow   window_;
+    DensityBuffer density_;
+    Stream        streams_[kStreams];
+    std::uint64_t samples_ = 0;
+    std::uint64_t seed_    = 0;
+
+    /// Seed every stream from (seed, epoch, index) and settle it on the
+    /// attractor.
+    void startStreams(std::uint64_t epoch) {
+        for (std::size_t s = 0; s < kStreams; ++s) {
+            Stream& st = streams_[s];
+            st.rng = Xoshiro128x4(seed_ + epoch, s);
+            st.x   = f32x4{} + 0.5f * (window_.x0 + window_.x1);
+            st.y   = f32x4{} + 0.5f * (window_.y0 + window_.y1);
+            for (int i = 0; i < kWarmup; ++i) step(st);
+        }
+    }
+
+    /// Apply one randomly chosen map in every lane.
+    void step(Stream& st) const {
+        const u32x4 bits = st.rng.next() >> 8;
+        i32x4       index{};
+        for (int m = 0; m + 1 < map_count_; ++m)
+            index -= bits >= threshold_[m];   // true is −1
+
+        f32x4 k[6];
+        for (int j = 0; j < 6; ++j) {
+            k[j] = f32x4{} + coef_[j][0];
+            for (int m = 1; m < map_count_; ++m) k[j] = index == m ? coef_[j][m] : k[j];
+        }
+        const f32x4 x = k[0] * st.x + k[1] * st.y + k[4];
+        st.y          = k[2] * st.x + k[3] * st.y + k[5];
+        st.x          = x;
+    }
+
+    /// kSteps steps of every lane of `st`, binned into `bins`.
+    void walk(Stream& st, std::span<std::uint32_t> bins) const {
+        const int   w  = density_.width();
+        const int   h  = density_.height();
+        const float sx = static_cast<float>(w) / (window_.x1 - window_.x0);
+        const float sy = static_cast<float>(h) / (window_.y1 - window_.y0);
+        const f32x4 fw = f32x4{} + static_cast<float>(w);
+        const f32x4 fh = f32x4{} + static_cast<float>(h);
+        std::uint32_t* out = bins.data();
+        for (int i = 0; i < kSteps; ++i) {
+            step(st);
+            const f32x4 fx = (st.x - window_.x0) * sx;
+            const f32x4 fy = (st.y - window_.y0) * sy;
+            // Compare as floats (out-of-window points must not wrap), then
+            // send them to a bin index past the end.
+            const i32x4 inside = (fx >= 0.0f) & (fx < fw) & (fy >= 0.0f) & (fy < fh);
+            const i32x4 index  = __builtin_convertvector(fy, i32x4) * w +
+                                 __builtin_convertvector(fx, i32x4);
+            const i32x4 bin    = inside ? index : i32x4{} - 1;
+            for (int lane = 0; lane < 4; ++lane)
+                if (bin[lane] >= 0) ++out[bin[lane]];
+        }
+    }
+};
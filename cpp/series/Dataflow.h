@@ -0,0 +1,187 @@
+// ─── WizSeries: Incremental Dataflow Graph ──────────────────────────────────
+// A visualizer's per-frame work split into memoised stages (terms → partial
+// sums → scale → grid / bars → overlay).  Each node declares the scalar
+// inputs it reads (parameters, time, canvas size) and the nodes it depends
+// on; pulling a node recomputes it only when one of those changed since it
+// last ran.
+//
+// Revisions follow the "verified / changed" scheme: a recomputed scalar node
+// whose value equals the previous one keeps its old changed-revision,
+// so its dependents stay clean (early cutoff) — e.g. a fixed y-scale does
+// not rebuild the grid when the term count changes.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+class DataflowGraph {
+public:
+    using InputId = int;
+
+    class Node {
+    public:
+        virtual ~Node() = default;
+
+        [[nodiscard]] const std::string& name() const { return name_; }
+        [[nodiscard]] std::uint64_t runs() const { return runs_; }
+
+    private:
+        friend class DataflowGraph;
+
+        virtual bool compute() = 0;   // true if the output changed
+
+        std::string          name_;
+        std::vector<InputId> inputs_;
+        std::vector<Node*>   deps_;
+        std::uint64_t        verified_at_ = 0;   // 0: never computed
+        std::uint64_t        changed_at_  = 0;
+        std::uint64_t        runs_        = 0;
+        std::uint64_t        ran_frame_   = 0;
+        double               ms_          = 0.0;
+    };
+
+    /// A node holding a value of type T, rebuilt in place by its function.
+    /// The function sees the previous value, so it may extend it rather
+    /// than start over.
+    template <typename T>
+    class Cell : public Node {
+    public:
+        explicit Cell(DataflowGraph& graph, std::function<void(T&)> fn)
+            : graph_(graph), fn_(std::move(fn)) {}
+
+        const T& get() {
+            graph_.pull(*this);
+            return value_;
+        }
+
+        /// The value as last computed, without pulling (e.g. to save it).
+        [[nodiscard]] const T& peek() const { return value_; }
+
+    private:
+        DataflowGraph&          graph_;
+        std::function<void(T&)> fn_;
+        T                       value_{};
+
+        bool compute() override {
+            if constexpr (std::is_arithmetic_v<T>) {
+                const T before = value_;
+                fn_(value_);
+                return !(value_ == before);
+            } else {
+                fn_(value_);
+                return true;
+            }
+        }
+    };
+
+    /// Declare a named scalar input (e.g. a parameter or "@time").
+    InputId input(std::string name) {
+        inputs_.push_back({std::move(name), 0.0, 0});
+        return static_cast<InputId>(inputs_.size() - 1);
+    }
+
+    /// Feed an input's value for this frame; nodes reading it go stale only
+    /// if it differs from the previous value.
+    void set(InputId id, double value) {
+        Input& in = inputs_[static_cast<std::size_t>(id)];
+        if (in.changed_at != 0 && in.value == value) return;
+        in.value      = value;
+        in.changed_at = ++revision_;
+    }
+
+    [[nodiscard]] double value(InputId id) const {
+        return inputs_[static_cast<std::size_t>(id)].value;
+    }
+
+    /// Add a node computing T from `inputs` and the outputs of `deps`.
+    template <typename T, typename Fn>
+    Cell<T>& node(std::string name, std::initializer_list<InputId> inputs,
+                  std::initializer_list<Node*> deps, Fn&& fn) {
+        auto cell     = std::make_unique<Cell<T>>(*this, std::forward<Fn>(fn));
+        cell->name_   = std::move(name);
+        cell->inputs_ = inputs;
+        cell->deps_   = deps;
+        Cell<T>& ref  = *cell;
+        nodes_.push_back(std::move(cell));
+        return ref;
+    }
+
+    /// Inside a node's function: has `in` changed since `n` last ran?
+    [[nodiscard]] bool changed(const Node& n, InputId in) const {
+        return inputs_[static_cast<std::size_t>(in)].changed_at > n.verified_at_;
+    }
+
+    /// Make `n` recompute on its next pull, as if it had never run (e.g.
+    /// after restoring state its function should pick up).
+    void invalidate(Node& n) { n.verified_at_ = 0; }
+
+    /// Start a new frame for "which nodes ran" bookkeeping.
+    void beginFrame() { ++frame_; }
+
+    /// Nodes recomputed during the current frame.
+    [[nodiscard]] int ranThisFrame() const {
+        int n = 0;
+        for (const auto& node : nodes_) n += node->ran_frame_ == frame_;
+        return n;
+    }
+
+    /// JSON array of {node, inputs, ran, runs, ms} in declaration order;
+    /// `ran` marks nodes recomputed during the current frame.
+    [[nodiscard]] std::string json() const {
+        std::string out = "[";
+        for (const auto& node : nodes_) {
+            if (out.size() > 1) out += ',';
+            out += "{\"node\":\"" + node->name_ + "\",\"inputs\":[";
+            for (std::size_t i = 0; i < node->inputs_.size(); ++i) {
+                if (i) out += ',';
+                out += '"' + inputs_[static_cast<std::size_t>(node->inputs_[i])].name + '"';
+            }
+            char buf[96];
+            std::snprintf(buf, sizeof(buf), "],\"ran\":%s,\"runs\":%llu,\"ms\":%.4g}",
+                          node->ran_frame_ == frame_ ? "true" : "false",
+                          static_cast<unsigned long long>(node->runs_), node->ms_);
+            out += buf;
+        }
+        return out + ']';
+    }
+
+private:
+    struct Input {
+        std::string   name;
+        double        value;
+        std::uint64_t changed_at;
+    };
+
+    std::vector<Input>                 inputs_;
+    std::vector<std::unique_ptr<Node>> nodes_;
+    std::uint64_t                      revision_ = 0;
+    std::uint64_t                      frame_    = 0;
+
+    void pull(Node& n) {
+        bool stale = n.verified_at_ == 0;
+        for (Node* d : n.deps_) {
+            pull(*d);
+            stale |= d->changed_at_ > n.verified_at_;
+        }
+        for (InputId i : n.inputs_) stale |= changed(n, i);
+        if (!stale) return;
+
+        const auto t0      = std::chrono::steady_clock::now();
+        const bool differs = n.compute();
+        n.ms_ = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0)
+                    .count();
+        n.verified_at_ = ++revision_;
+        if (differs || n.changed_at_ == 0) n.changed_at_ = n.verified_at_;
+        ++n.runs_;
+        n.ran_frame_ = frame_;
+    }
+};
@@ -0,0 +1,129 @@
+// ─── WizSeries: Density Buffer ──────────────────────────────────────────────
+// A 2-D histogram of plotted points for Monte Carlo and iterated-map
+// visualizers, which draw far more points than could be streamed as
+// vertices: every point lands in a bin and only the counts are drawn
+// (IRenderer::drawDensity), however many billions went in.
+//
+// Writers never share a bin array.  Each takes a private slice, bins its
+// points with plain increments, and mergeSlices() then adds the slices
+// into the counts in parallel over disjoint bin ranges — no atomics and no
+// locks, and the same counts whatever the number of threads.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include "IRenderer.h"
+#include "JobSystem.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+/// The region of the plane mapped onto the density bins.
+struct PlaneWindow {
+    float x0 = 0.0f, x1 = 1.0f;
+    float y0 = 0.0f, y1 = 1.0f;
+};
+
+class DensityBuffer {
+public:
+    /// Resize to `width`×`height` bins and clear.
+    void resize(int width, int height) {
+        width_  = std::max(width, 0);
+        height_ = std::max(height, 0);
+        counts_.assign(bins(), 0);
+        for (std::vector<std::uint32_t>& s : slices_) s.assign(bins(), 0);
+        max_count_ = 0;
+        ++revision_;
+    }
+
+    void clear() { resize(width_, height_); }
+
+    [[nodiscard]] int           width()    const { return width_; }
+    [[nodiscard]] int           height()   const { return height_; }
+    [[nodiscard]] std::uint32_t maxCount() const { return max_count_; }
+    [[nodiscard]] std::uint64_t revision() const { return revision_; }
+    [[nodiscard]] std::uint64_t source()   const { return source_; }
+
+    [[nodiscard]] std::size_t bins() const {
+        return static_cast<std::size_t>(width_) * static_cast<std::size_t>(height_);
+    }
+
+    [[nodiscard]] std::span<const std::uint32_t> counts() const { return counts_; }
+
+    /// Make `n` zeroed private slices available to slice().
+    void prepareSlices(std::size_t n) {
+        if (slices_.size() < n) slices_.resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+            if (slices_[i].size() != bins()) slices_[i].assign(bins(), 0);
+    }
+
+    /// Bin array private to writer `i` (< the prepareSlices() count).
+    [[nodiscard]] std::span<std::uint32_t> slice(std::size_t i) { return slices_[i]; }
+
+    /// Add the first `n` slices into the counts, saturating, and zero them.
+    void mergeSlices(std::size_t n, JobSystem* jobs) {
+        const std::size_t blocks = (bins() + kMergeBlock - 1) / kMergeBlock;
+        block_max_.assign(blocks, 0);
+        parallelFor(jobs, 0, blocks, 1, [&](std::size_t lo, std::size_t hi) {
+            for (std::size_t b = lo; b < hi; ++b) {
+                const std::size_t first = b * kMergeBlock;
+                const std::size_t last  = std::min(bins(), first + kMergeBlock);
+                for (std::size_t s = 0; s < n; ++s) {
+                    std::uint32_t* in = slices_[s].data();
+                    for (std::size_t i = first; i < last; ++i) {
+                        const std::uint64_t sum = std::uint64_t{counts_[i]} + in[i];
+                        counts_[i] = static_cast<std::uint32_t>(std::min<std::uint64_t>(
+                            sum, std::numeric_limits<std::uint32_t>::max()));
+                        in[i] = 0;
+                    }
+                }
+                block_max_[b] = *std::max_element(counts_.begin() + static_cast<long>(first),
+                                                  counts_.begin() + static_cast<long>(last));
+            }
+        });
+        for (const std::uint32_t m : block_max_) max_count_ = std::max(max_count_, m);
+        ++revision_;
+    }
+
+    /// Replace the counts wholesale (snapshot restore); false on a size
+    /// mismatch.
+    bool assign(std::span<const std::uint32_t> counts) {
+        if (counts.size() != bins()) return false;
+        counts_.assign(counts.begin(), counts.end());
+        max_count_ = counts_.empty() ? 0 : *std::max_element(counts_.begin(), counts_.end());
+        ++revision_;
+        return true;
+    }
+
+    /// A DensityDraw of the counts over the given clip-space rect; the
+    /// caller fills in the palette.
+    [[nodiscard]] DensityDraw draw(float xMin, float xMax, float yMin, float yMax) const {
+        DensityDraw d;
+        d.source   = source_;
+        d.revision = revision_;
+        d.counts   = counts_;
+        d.width    = width_;
+        d.height   = height_;
+        d.maxCount = max_count_;
+        d.xMin     = xMin;
+        d.xMax     = xMax;
+        d.yMin     = yMin;
+        d.yMax     = yMax;
+        return d;
+    }
+
+private:
+    static constexpr std::size_t kMergeBlock = std::size_t{1} << 14;   // bins per merge job
+
+    int                                     width_     = 0;
+    int                                     height_    = 0;
+    std::vector<std::uint32_t>              counts_;
+    std::vector<std::vector<std::uint32_t>> slices_;
+    std::vector<std::uint32_t>              block_max_;
+    std::uint32_t                           max_count_ = 0;
+    std::uint64_t                           revision_  = 0;
+    std::uint64_t                           source_    = newSeriesDataSource();
+};
@@ -0,0 +1,120 @@
+// ─── WizSeries: Double-Double Arithmetic ────────────────────────────────────
+// A value held as an unevaluated sum hi + lo of two doubles with |lo| ≤
+// ½ulp(hi), giving ~106 bits (32 significant digits) of precision at a few
+// times the cost of double.  Sums use Knuth's TwoSum and products an FMA
+// TwoProd, so results are exact up to the final renormalisation.  Enough of
+// the field operations for root finding; no transcendental functions.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include <cmath>
+#include <cstdlib>
+#include <string>
+
+struct DoubleDouble {
+    double hi = 0.0;
+    double lo = 0.0;
+
+    constexpr DoubleDouble() = default;
+    constexpr DoubleDouble(double v) : hi(v) {}   // NOLINT: implicit like a double
+    constexpr DoubleDouble(double h, double l) : hi(h), lo(l) {}
+
+    [[nodiscard]] explicit operator double() const { return hi + lo; }
+
+    // ── Error-free transformations ─────────────────────────────────────────
+
+    /// a + b = s + e exactly.
+    static DoubleDouble twoSum(double a, double b) {
+        const double s  = a + b;
+        const double bb = s - a;
+        return {s, (a - (s - bb)) + (b - bb)};
+    }
+
+    /// a + b = s + e exactly, given |a| ≥ |b|.
+    static DoubleDouble quickTwoSum(double a, double b) {
+        const double s = a + b;
+        return {s, b - (s - a)};
+    }
+
+    /// a·b = p + e exactly.
+    static DoubleDouble twoProd(double a, double b) {
+        const double p = a * b;
+        return {p, std::fma(a, b, -p)};
+    }
+
+    // ── Arithmetic ─────────────────────────────────────────────────────────
+
+    friend DoubleDouble operator+(const DoubleDouble& a, const DoubleDouble& b) {
+        DoubleDouble s = twoSum(a.hi, b.hi);
+        DoubleDouble t = twoSum(a.lo, b.lo);
+        s.lo += t.hi;
+        s     = quickTwoSum(s.hi, s.lo);
+        s.lo += t.lo;
+        return quickTwoSum(s.hi, s.lo);
+    }
+
+    friend DoubleDouble operator-(const DoubleDouble& a) { return {-a.hi, -a.lo}; }
+
+    friend DoubleDouble operator-(const DoubleDouble& a, const DoubleDouble& b) {
+        return a + -b;
+    }
+
+    friend DoubleDouble operator*(const DoubleDouble& a, const DoubleDouble& b) {
+        DoubleDouble p = twoProd(a.hi, b.hi);
+        p.lo += a.hi * b.lo + a.lo * b.hi;
+        return quickTwoSum(p.hi, p.lo);
+    }
+
+    friend DoubleDouble operator/(const DoubleDouble& a, const DoubleDouble& b) {
+        // Long division: a double quotient, then one correction from the
+        // exact remainder.
+        const double       q1 = a.hi / b.hi;
+        const DoubleDouble r  = a - b * DoubleDouble(q1);
+        const double       q2 = r.hi / b.hi;
+        return quickTwoSum(q1, q2);
+    }
+
+    DoubleDouble& operator+=(const DoubleDouble& o) { return *this = *this + o; }
+    DoubleDouble& operator-=(const DoubleDouble& o) { return *this = *this - o; }
+    DoubleDouble& operator*=(const DoubleDouble& o) { return *this = *this * o; }
+    DoubleDouble& operator/=(const DoubleDouble& o) { return *this = *this / o; }
+
+    friend bool operator<(const DoubleDouble& a, const DoubleDouble& b) {
+        return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo);
+    }
+
+    /// Decimal digits of the value, e.g. toString(pi, 30) → "3.14159…".
+    [[nodiscard]] std::string toString(int digits) const {
+        DoubleDouble v = *this;
+        std::string  out;
+        if (v.hi < 0.0) {
+            out += '-';
+            v = -v;
+        }
+        int exp10 = v.hi > 0.0 ? static_cast<int>(std::floor(std::log10(v.hi))) : 0;
+        DoubleDouble scale = 1.0;   // 10^|exp10|, exact in double-double
+        for (int i = 0; i < std::abs(exp10); ++i) scale *= 10.0;
+        v = exp10 >= 0 ? v / scale : v * scale;
+        if (v.hi >= 10.0) {   // log10 rounded across a power of ten
+            v /= 10.0;
+            ++exp10;
+        } else if (v.hi < 1.0 && v.hi > 0.0) {
+            v *= 10.0;
+            --exp10;
+        }
+        std::string mantissa;
+        for (int i = 0; i < digits; ++i) {
+            int d = static_cast<int>(std::floor(v.hi));
+            if (v.hi == d && v.lo < 0.0) --d;   // hi rounded up past an integer
+            d = d < 0 ? 0 : d > 9 ? 9 : d;
+            mantissa += static_cast<char>('0' + d);
+            v = (v - DoubleDouble(d)) * 10.0;
+        }
+        // Place the decimal point; values below 1 get leading zeros.
+        if (exp10 < 0) return out + "0." + std::string(static_cast<size_t>(-exp10 - 1), '0') +
+                              mantissa;
+        const auto point = static_cast<size_t>(exp10) + 1;
+        if (point >= mantissa.size()) return out + mantissa;
+        return out + mantissa.substr(0, point) + "." + mantissa.substr(point);
+    }
+};
@@ -0,0 +1,207 @@
+// ─── WizSeries: Feigenbaum Constants ────────────────────────────────────────
+// Locates the period-doubling cascade of the logistic map numerically and
+// derives Feigenbaum's δ and α and the accumulation point r∞ from it.
+//
+//   superstable  R_n, where the 2ⁿ-cycle passes through x = ½:  the root of
+//                g(r) = f_r^(2ⁿ)(½) − ½ near R_{n−1} + (R_{n−1} − R_{n−2})/δ,
+//                found by Newton's method with dg/dr carried along the orbit
+//                (d' = x·(1 − x) + r·(1 − 2x)·d).  The spacing shrinks like
+//                δ⁻ⁿ — 10⁻¹⁵ at n = 20 — so roots are found in double only
+//                while double can still tell the levels apart, and always
+//                polished with double-double orbits.
+//   bifurcation  b_n, where the 2ⁿ⁻¹-cycle loses stability: f^q(x) = x with
+//                multiplier (f^q)'(x) = −1 for q = 2ⁿ⁻¹, by two-dimensional
+//                Newton over (x, r) with second derivatives along the orbit.
+//                Double suffices for the levels that are pixels apart.
+//   constants    δ_n = (R_{n−1} − R_{n−2}) / (R_n − R_{n−1}),
+//                α_n = d_{n−1} / d_n with d_n = f^(2ⁿ⁻¹)(½) − ½ at R_n, and
+//                r∞ ≈ R_n + (R_n − R_{n−1}) / (δ_n − 1).
+//
+// Levels are computed once and kept: extend() only adds the missing ones.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include "DoubleDouble.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+struct FeigenbaumLevel {
+    int          n            = 0;    // cycle period 2ⁿ
+    DoubleDouble superstable;         // R_n
+    double       bifurcation  = 0.0;  // b_n (NaN where not resolved)
+    double       delta        = 0.0;  // δ_n (NaN for n < 2)
+    double       alpha        = 0.0;  // α_n (NaN for n < 2)
+    DoubleDouble accumulation;        // r∞ estimated from this level
+};
+
+class FeigenbaumEngine {
+public:
+    /// Levels above this get no bifurcation point: b_n is within 10⁻⁸ of r∞.
+    static constexpr int kMaxBifurcationLevel = 12;
+
+    /// Levels n = 0 … 30 at most (orbits of 2³⁰ steps).
+    static constexpr int kMaxLevel = 30;
+
+    /// Make levels 0 … n available, computing only those not yet cached.
+    const std::vector<FeigenbaumLevel>& extend(int n) {
+        n = std::min(n, kMaxLevel);
+        while (static_cast<int>(levels_.size()) <= n) addLevel();
+        return levels_;
+    }
+
+    [[nodiscard]] const std::vector<FeigenbaumLevel>& levels() const { return levels_; }
+
+    /// Best estimates so far (NaN before level 2).
+    [[nodiscard]] double delta() const { return ready() ? levels_.back().delta : kNaN; }
+    [[nodiscard]] double alpha() const { return ready() ? levels_.back().alpha : kNaN; }
+    [[nodiscard]] DoubleDouble accumulation() const {
+        return ready() ? levels_.back().accumulation : DoubleDouble(kNaN);
+    }
+
+private:
+    static constexpr double kNaN = std::numeric_limits<double>::quiet_NaN();
+
+    std::vector<FeigenbaumLevel> levels_;
+    std::vector<double>          half_;   // d_n per level, for α
+
+    [[nodiscard]] bool ready() const { return levels_.size() > 2; }
+
+    void addLevel() {
+        FeigenbaumLevel L;
+        L.n = static_cast<int>(levels_.size());
+        const std::uint64_t period = std::uint64_t{1} << L.n;
+
+        // Newton guess: the previous spacing shrunk by the current δ estimate.
+        if (L.n == 0) {
+            L.superstable = 2.0;   // exactly: f_2(½) = ½
+        } else if (L.n == 1) {
+            L.superstable = superstableRoot(3.2, 0.5, period);
+        } else {
+            const DoubleDouble& r1 = levels_[L.n - 1].superstable;
+            const DoubleDouble& r2 = levels_[L.n - 2].superstable;
+            const double        d  = L.n >= 3 ? levels_[L.n - 1].delta : 4.0;
+            const DoubleDouble  step = (r1 - r2) / DoubleDouble(d);
+            L.superstable = superstableRoot(r1 + step, std::abs(step.hi), period);
+        }
+
+        half_.push_back(L.n == 0 ? 0.5
+                                 : static_cast<double>(halfOrbit(L.superstable, period / 2)));
+        if (L.n >= 2) {
+            const DoubleDouble  d1 = levels_[L.n - 1].superstable - levels_[L.n - 2].superstable;
+            const DoubleDouble  d0 = L.superstable - levels_[L.n - 1].superstable;
+            const DoubleDouble  dd = d1 / d0;
+            L.delta        = static_cast<double>(dd);
+            L.alpha        = half_[L.n - 1] / half_[L.n];
+            L.accumulation = L.superstable + d0 / (dd - DoubleDouble(1.0));
+        } else {
+            L.delta = L.alpha = kNaN;
+            L.accumulation    = kNaN;
+        }
+
+        L.bifurcation = kNaN;
+        if (L.n >= 1 && L.n <= kMaxBifurcationLevel) {
+            // b_n sits at a nearly fixed fraction of the way from R_{n−1} to R_n.
+            const double lo   = static_cast<double>(levels_[L.n - 1].superstable);
+            const double hi   = static_cast<double>(L.superstable);
+            const double frac = L.n >= 2 && !std::isnan(levels_[L.n - 1].bifurcation)
+                                    ? (levels_[L.n - 1].bifurcation -
+                                       static_cast<double>(levels_[L.n - 2].superstable)) /
+                                          (lo - static_cast<double>(levels_[L.n - 2].superstable))
+                                    : 0.81;
+            L.bifurcation = bifurcationPoint(lo + frac * (hi - lo), period / 2);
+        }
+        levels_.push_back(L);
+    }
+
+    /// f_r^steps(½) − ½ and its derivative in r.
+    template <typename T>
+    static T orbit(const T& r, std::uint64_t steps, double* dr) {
+        const T half = 0.5;
+        T       x    = half;
+        double  d    = 0.0;
+        const double rd = static_cast<double>(r);
+        for (std::uint64_t i = 0; i < steps; ++i) {
+            const double xd = static_cast<double>(x);
+            d = xd * (1.0 - xd) + rd * (1.0 - 2.0 * xd) * d;
+            x = r * x * (T(1.0) - x);
+        }
+        *dr = d;
+        return x - half;
+    }
+
+    /// R_n within about `spacing` (the distance to R_{n−1}) of `guess`:
+    /// Newton in double while double can still separate the levels, then
+    /// polished in double-double.  A double iterate that strays more than
+    /// half the spacing is discarded.
+    static DoubleDouble superstableRoot(const DoubleDouble& guess, double spacing,
+                                        std::uint64_t period) {
+        DoubleDouble R = guess;
+        if (spacing > 1e-9 * guess.hi) {
+            double r = guess.hi;
+            for (int it = 0; it < 60 && std::abs(r - guess.hi) < 0.5 * spacing; ++it) {
+                double       dg   = 0.0;
+                const double g    = orbit(r, period, &dg);
+                const double step = g / dg;
+                r -= step;
+                if (std::abs(step) < 4e-16 * r) {
+                    if (std::abs(r - guess.hi) < 0.5 * spacing) R = r;
+                    break;
+                }
+            }
+        }
+        for (int it = 0; it < 8; ++it) {
+            double             dg = 0.0;
+            const DoubleDouble g  = orbit(R, period, &dg);
+            const DoubleDouble step = g / DoubleDouble(dg);
+            R -= step;
+            if (std::abs(step.hi) < 1e-31 * R.hi) break;
+        }
+        return R;
+    }
+
+    /// d_n = f^steps(½) − ½ at r, in double-double.
+    static DoubleDouble halfOrbit(const DoubleDouble& r, std::uint64_t steps) {
+        double dr = 0.0;
+        return orbit(r, steps, &dr);
+    }
+
+    /// The r near `guess` where the q-cycle has multiplier −1, or NaN if
+    /// Newton does not settle.
+    static double bifurcationPoint(double guess, std::uint64_t q) {
+        double r = guess;
+        double x = 0.5;
+        for (int k = 0; k < 64; ++k)   // approach the (still stable) cycle
+            for (std::uint64_t i = 0; i < q; ++i) x = r * x * (1.0 - x);
+
+        for (int it = 0; it < 40; ++it) {
+            // Along the orbit from x: X, dX/dx0 (a), dX/dr (b), d²X/dx0² (c),
+            // d²X/dx0 dr (e).
+            double X = x, a = 1.0, b = 0.0, c = 0.0, e = 0.0;
+            for (std::uint64_t i = 0; i < q; ++i) {
+                const double fx  = r * (1.0 - 2.0 * X);
+                const double fr  = X * (1.0 - X);
+                const double fxx = -2.0 * r;
+                const double fxr = 1.0 - 2.0 * X;
+                e = fxx * a * b + fxr * a + fx * e;
+                c = fxx * a * a + fx * c;
+                b = fx * b + fr;
+                a = fx * a;
+                X = r * X * (1.0 - X);
+            }
+            // Solve [a − 1, b; c, e]·(dx, dr) = −(X − x, a + 1).
+            const double F = X - x, G = a + 1.0;
+            const double det = (a - 1.0) * e - b * c;
+            if (det == 0.0 || !std::isfinite(det)) return kNaN;
+            const double dx = (-F * e + G * b) / det;
+            const double dr = (-(a - 1.0) * G + c * F) / det;
+            x += dx;
+            r += dr;
+            if (std::abs(dr) < 1e-15 * r && std::abs(dx) < 1e-13) return r;
+        }
+        return kNaN;
+    }
+};
@@ -0,0 +1,214 @@
+// ─── WizSeries: Frame Pipeline ──────────────────────────────────────────────
+// Pipelined compute → render handoff.  Each frame's geometry is recorded into
+// a staging RecordingRenderer by a producer job on the JobSystem while the
+// main thread replays (uploads + draws) the frame requested depth − 1 calls
+// earlier.  Productions run one at a time on a single "lane" so a visualizer
+// is never rendered concurrently with itself; every staging slot carries a
+// ready flag that acts as the fence between producer and consumer.
+//
+// Typed draws the target takes (data-texture bars, GPU bifurcation, Lyapunov
+// and density passes) are recorded as such, with copies of their arrays, so
+// pipelining does not push visualizers onto their CPU paths.
+//
+// depth 1 is off (the caller renders directly), 2 is double buffering (one
+// frame of added latency), 3 is triple buffering (two frames).
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include "ISeriesVisualizer.h"
+#include "JobSystem.h"
+#include "RecordingRenderer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class FramePipeline {
+public:
+    static constexpr int kMaxDepth = 3;
+
+    using PointStats = ISeriesVisualizer::PointStats;
+
+    struct Stats {
+        int           depth         = 1;
+        int           latencyFrames = 0;     // requests between request and display
+        double        latencyMs     = 0.0;   // wall time between request and display
+        double        produceMs     = 0.0;   // geometry time of the displayed frame
+        double        fenceWaitMs   = 0.0;   // main thread blocked on the fence
+        std::uint64_t repeats       = 0;     // frames that re-showed the last image
+        std::string   dataflow      = "null";   // stage report of the displayed frame
+        PointStats    points;                   // point progress as of the displayed frame
+    };
+
+    explicit FramePipeline(JobSystem& jobs) : jobs_(jobs) {
+        // depth − 1 pending + the one being requested + the last shown image
+        for (int i = 0; i < kMaxDepth + 1; ++i) {
+            pool_.push_back(std::make_unique<Slot>());
+            pool_.back()->rec.shareCopies(pool_.front()->rec);   // productions take turns
+            free_.push_back(pool_.back().get());
+        }
+    }
+
+    FramePipeline(const FramePipeline&) = delete;
+    FramePipeline& operator=(const FramePipeline&) = delete;
+
+    ~FramePipeline() { drain(); }
+
+    void setDepth(int depth) {
+        drain();
+        depth_ = std::clamp(depth, 1, kMaxDepth);
+        stats_ = {};
+        stats_.depth = depth_;
+    }
+
+    [[nodiscard]] int depth() const { return depth_; }
+
+    /// Request frame `time` of `viz` and draw the oldest requested frame on
+    /// `target` once depth − 1 newer ones are queued behind it.  Until then
+    /// (start-up, or after drain()) the last shown image is drawn again.
+    void frame(ISeriesVisualizer& viz, float time, float width, float height,
+               IRenderer& target) {
+        Slot* s = free_.back();
+        free_.pop_back();
+        s->viz       = &viz;
+        s->time      = time;
+        s->width     = width;
+        s->height    = height;
+        s->serial    = ++serial_;
+        s->requested = Clock::now();
+        s->rec.setView(target.viewScale(), target.viewOffset());   // visualizers cull to it
+        s->rec.setTypedDraws(target.typedDraws());   // recorded for replay, not refused
+        s->ready.store(false, std::memory_order_relaxed);
+        pending_.push_back(s);
+        request(s);
+
+        stats_.fenceWaitMs = 0.0;
+        if (pending_.size() < static_cast<size_t>(depth_) && front_) {
+            front_->rec.replay(target);
+            ++stats_.repeats;
+            return;
+        }
+
+        Slot* show = pending_.front();
+        pending_.pop_front();
+        const auto t0 = Clock::now();
+        jobs_.waitUntil([show] { return show->ready.load(std::memory_order_acquire); });
+        const auto t1 = Clock::now();
+        show->rec.replay(target);
+
+        stats_.fenceWaitMs   = msBetween(t0, t1);
+        stats_.latencyFrames = static_cast<int>(serial_ - show->serial);
+        stats_.latencyMs     = msBetween(show->requested, Clock::now());
+        stats_.produceMs     = show->produceMs;
+        stats_.dataflow      = show->dataflow;
+        stats_.points        = show->points;
+        if (front_) free_.push_back(front_);
+        front_ = show;
+    }
+
+    /// Finish in-flight productions and discard queued frames.  Call before
+    /// mutating any visualizer the producer may be reading.
+    void drain() {
+        waitIdle();
+        for (Slot* s : pending_) free_.push_back(s);
+        pending_.clear();
+    }
+
+    /// Wait for in-flight productions without discarding queued frames, so
+    /// the caller may briefly touch visualizer state the producer reads.
+    void waitIdle() {
+        jobs_.waitUntil([this] {
+            std::lock_guard<std::mutex> lock(lane_mutex_);
+            return !lane_busy_;
+        });
+    }
+
+    /// drain() and forget the last shown image, so the next frame waits for
+    /// fresh geometry instead of repeating (e.g. after switching visualizer).
+    void reset() {
+        drain();
+        if (front_) free_.push_back(front_);
+        front_ = nullptr;
+    }
+
+    [[nodiscard]] const Stats& stats() const { return stats_; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Slot {
+        RecordingRenderer  rec;
+        ISeriesVisualizer* viz    = nullptr;
+        float              time   = 0.0f;
+        float              width  = 0.0f;
+        float              height = 0.0f;
+        std::uint64_t      serial = 0;
+        Clock::time_point  requested;
+        double             produceMs = 0.0;
+        std::string        dataflow;
+        PointStats         points;
+        std::atomic<bool>  ready{false};   // fence: set last by the producer
+    };
+
+    JobSystem&    jobs_;
+    int           depth_  = 1;
+    std::uint64_t serial_ = 0;
+    Stats         stats_;
+
+    std::vector<std::unique_ptr<Slot>> pool_;
+    std::vector<Slot*> free_;       // main thread only
+    std::deque<Slot*>  pending_;    // requested, oldest first; main thread only
+    Slot*              front_ = nullptr;   // last image shown
+
+    std::mutex         lane_mutex_;
+    std::deque<Slot*>  lane_queue_;
+    bool               lane_busy_ = false;
+
+    static double msBetween(Clock::time_point a, Clock::time_point b) {
+        return std::chrono::duration<double, std::milli>(b - a).count();
+    }
+
+    /// Queue `s` on the producer lane, starting the lane job if it is idle.
+    void request(Slot* s) {
+        {
+            std::lock_guard<std::mutex> lock(lane_mutex_);
+            lane_queue_.push_back(s);
+            if (lane_busy_) return;
+            lane_busy_ = true;
+        }
+        jobs_.submit([this] { runLane(); });
+    }
+
+    void runLane() {
+        for (;;) {
+            Slot* s = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(lane_mutex_);
+                if (lane_queue_.empty()) {
+                    lane_busy_ = false;
+                    return;
+                }
+                s = lane_queue_.front();
+                lane_queue_.pop_front();
+            }
+            produce(*s);
+        }
+    }
+
+    static void produce(Slot& s) {
+        const auto t0 = Clock::now();
+        s.rec.beginFrame(s.width, s.height);
+        s.viz->render(s.time, s.width, s.height, s.rec);
+        s.rec.endFrame();
+        s.produceMs = msBetween(t0, Clock::now());
+        s.dataflow  = s.viz->dataflowJson();
+        s.points    = s.viz->pointStats();
+        s.ready.store(true, std::memory_order_release);
+    }
+};
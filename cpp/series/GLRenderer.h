@@ -1,160 +1,1210 @@
 // ─── WizSeries: Minimal WebGL 2 Rendering Utilities ─────────────────────────
-// Shared by all visualizers.  Manages a single shader program and a dynamic
-// VBO for streaming coloured 2-D vertices each frame.
+// IRenderer backend for WebGL 2 in the browser and GLES 3 natively.  Manages
+// a single shader program and a dynamic VBO for streaming coloured 2-D
+// vertices each frame, with selectable streaming strategies and per-frame
+// upload/draw counters for benchmarking them.
+//
+// Draws are batched by default: each is appended to the batch for its layer
+// run, primitive and point size (line strips become line lists), and at
+// endFrame() all batches go up in one upload and are issued as one draw each
+// — typically 2–3 draws per frame whatever the visualizer submits.
+//
+// Logistic-map bifurcation diagrams can be computed entirely in a vertex
+// shader: vertex i picks its column (r) and sample from gl_VertexID and runs
+// the warmup and sample iterations itself, so nothing is computed or
+// uploaded on the CPU.  Before its first use the program is checked against
+// a CPU reference through transform feedback; on a mismatch the visualizer
+// keeps its CPU path.
+//
+// Lyapunov fractals are computed per fragment.  Each pixel's running state
+// (x and Σ ln|r·(1 − 2x)|) lives in a pair of RG32F textures the size of the
+// viewport; every frame one pass advances it by LyapunovDraw::perFrame steps
+// (ping-ponging between the textures) and a second pass colours λ into the
+// frame, so high iteration counts refine over several frames.  The state
+// restarts when the draw or the view changes.  Without float render targets
+// (EXT_color_buffer_float) the visualizer computes λ itself.
+//
+// Point histograms (drawDensity) go up as one R32UI texture, re-uploaded
+// only when their revision changes, and are tone-mapped per fragment.
+//
+// Binds, enables and uniforms go through a GLStateCache that drops redundant
+// calls, and per-frame constants (view transform, viewport, time) live in a
+// uniform block both programs share, written at most once per frame.
+//
+// Quads (Primitive::Quads) are streamed as four corners and drawn with
+// glDrawElements through a static GLushort index buffer of 0-1-2 1-3-2
+// patterns, a third less upload than two independent triangles.  GLES 3 has
+// no base-vertex draws, so each batch of up to kQuadBatch quads re-points the
+// attributes at its first corner instead.
+//
+// Series plots can skip vertex streaming entirely ("vertex pulling"): terms
+// and partial sums live in two R32F textures (4096 texels per row, 8 bytes
+// per term) that are only re-uploaded when values change — appended terms
+// upload just the new texels.  A second program builds each bar from
+// gl_InstanceID and each sum-line point from gl_VertexID with texelFetch,
+// so rescaling, resizing and panning are uniform updates.
 // ─────────────────────────────────────────────────────────────────────────────
 #pragma once
 
+#include "GLStateCache.h"
+#include "IRenderer.h"
+
 #include <GLES3/gl3.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
+#include <initializer_list>
+#include <optional>
+#include <span>
 #include <vector>
 
-// ─── Vertex layout: position (x,y) + colour (r,g,b,a) ──────────────────────
+#ifdef __EMSCRIPTEN__
+// WebGL 2 reads buffers back with getBufferSubData; Emscripten's GL library
+// exports it but gl3.h does not declare it.
+extern "C" void glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size,
+                                   void* data);
+#endif
+
+// ─── Vertex streaming strategies ────────────────────────────────────────────
 
-struct Vertex {
-    float x, y;
-    float r, g, b, a;
+enum class StreamMode {
+    BufferData,   // glBufferData with the data on every draw (re-specify)
+    Orphan,       // orphan a fixed-size store, then glBufferSubData at 0
+    SubData,      // glBufferSubData into a persistent store (may sync)
+    Ring,         // append into a large ring; orphan only on wrap-around
 };
 
-// Append a screen-aligned quad (two triangles) to a vertex buffer.
-inline void addQuad(std::vector<Vertex>& out,
-                    float x1, float y1, float x2, float y2,
-                    float r, float g, float b, float a = 1.0f) {
-    out.push_back({x1, y1, r, g, b, a});
-    out.push_back({x2, y1, r, g, b, a});
-    out.push_back({x1, y2, r, g, b, a});
-    out.push_back({x2, y1, r, g, b, a});
-    out.push_back({x2, y2, r, g, b, a});
-    out.push_back({x1, y2, r, g, b, a});
+inline const char* streamModeName(StreamMode mode) {
+    switch (mode) {
+        case StreamMode::BufferData: return "bufferdata";
+        case StreamMode::Orphan:     return "orphan";
+        case StreamMode::SubData:    return "subdata";
+        case StreamMode::Ring:       return "ring";
+    }
+    return "?";
 }
 
+/// Counters for one frame.  Times are CPU time spent inside the GL calls,
+/// which is what WebGL validation and driver overhead show up as.
+struct RenderStats {
+    std::uint32_t drawCalls   = 0;
+    std::uint32_t uploads     = 0;
+    std::uint64_t uploadBytes = 0;
+    double        uploadMs    = 0.0;
+    double        drawMs      = 0.0;
+    std::uint32_t glCalls     = 0;   // state calls issued through the cache
+    std::uint32_t glElided    = 0;   //   and dropped as redundant
+};
+
 // ─── GLRenderer ─────────────────────────────────────────────────────────────
 
-class GLRenderer {
+class GLRenderer : public IRenderer {
 public:
     bool init() {
         const char* vs_src =
-            "#version 300 es\n"
             "layout(location = 0) in vec2 a_pos;\n"
             "layout(location = 1) in vec4 a_color;\n"
             "uniform float u_point_size;\n"
-            "uniform float u_view_scale;\n"
-            "uniform float u_view_offset;\n"
             "out vec4 v_color;\n"
             "void main() {\n"
-            "    gl_Position = vec4(a_pos.x * u_view_scale + u_view_offset,\n"
+            "    gl_Position = vec4(a_pos.x * u_view.x + u_view.y,\n"
             "                      a_pos.y, 0.0, 1.0);\n"
             "    gl_PointSize = u_point_size;\n"
             "    v_color = a_color;\n"
             "}\n";
 
-        const char* fs_src =
-            "#version 300 es\n"
-            "precision mediump float;\n"
-            "in vec4 v_color;\n"
-            "out vec4 fragColor;\n"
-            "void main() {\n"
-            "    fragColor = v_color;\n"
-            "}\n";
-
-        GLuint vs = compileShader(GL_VERTEX_SHADER, vs_src);
-        GLuint fs = compileShader(GL_FRAGMENT_SHADER, fs_src);
-        if (!vs || !fs) return false;
-
-        program_ = glCreateProgram();
-        glAttachShader(program_, vs);
-        glAttachShader(program_, fs);
-        glLinkProgram(program_);
-
-        GLint linked = 0;
-        glGetProgramiv(program_, GL_LINK_STATUS, &linked);
-        if (!linked) return false;
+        program_ = linkProgram({kVertexPrelude, vs_src});
+        if (!program_) return false;
 
-        glDeleteShader(vs);
-        glDeleteShader(fs);
+        u_point_size_ = glGetUniformLocation(program_, "u_point_size");
 
-        u_point_size_  = glGetUniformLocation(program_, "u_point_size");
-        u_view_scale_  = glGetUniformLocation(program_, "u_view_scale");
-        u_view_offset_ = glGetUniformLocation(program_, "u_view_offset");
+        glGenBuffers(1, &ubo_);
+        glBindBuffer(GL_UNIFORM_BUFFER, ubo_);
+        glBufferData(GL_UNIFORM_BUFFER, sizeof(FrameBlock), nullptr, GL_DYNAMIC_DRAW);
+        glBindBufferBase(GL_UNIFORM_BUFFER, kFrameBinding, ubo_);
+        frame_block_.reset();
 
         glGenVertexArrays(1, &vao_);
         glGenBuffers(1, &vbo_);
+        glGenBuffers(1, &ibo_);
 
         glBindVertexArray(vao_);
         glBindBuffer(GL_ARRAY_BUFFER, vbo_);
-
-        // position (vec2)
-        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE,
-                              sizeof(Vertex), reinterpret_cast<void*>(0));
+        pointAttributes(0);
         glEnableVertexAttribArray(0);
-
-        // colour (vec4)
-        glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE,
-                              sizeof(Vertex),
-                              reinterpret_cast<void*>(2 * sizeof(float)));
         glEnableVertexAttribArray(1);
 
+        // The element binding is VAO state: every quad draw finds it bound.
+        std::vector<GLushort> indices(std::size_t{6} * kQuadBatch);
+        for (std::size_t q = 0; q < kQuadBatch; ++q)
+            for (int i = 0; i < 6; ++i)
+                indices[6 * q + i] = static_cast<GLushort>(4 * q + kQuadIndices[i]);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo_);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+                     static_cast<GLsizeiptr>(indices.size() * sizeof(GLushort)),
+                     indices.data(), GL_STATIC_DRAW);
+
         glBindVertexArray(0);
 
+        initData();
+        initBifurcation();
+        initLyapunov();
+        initDensity();
+        state_.invalidate();
         initialized_ = true;
         return true;
     }
 
-    void beginFrame(float width, float height) {
-        glViewport(0, 0, static_cast<int>(width), static_cast<int>(height));
-        glClearColor(0.98f, 0.97f, 0.96f, 1.0f);
+    void beginFrame(float width, float height) override {
+        frame_ = {};
+        frame_w_ = static_cast<GLsizei>(width);
+        frame_h_ = static_cast<GLsizei>(height);
+        state_.resetCounters();
+        state_.viewport(0, 0, static_cast<int>(width), static_cast<int>(height));
+        state_.clearColor(0.98f, 0.97f, 0.96f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT);
-        glUseProgram(program_);
-        glUniform1f(u_view_scale_,  view_scale_);
-        glUniform1f(u_view_offset_, view_offset_);
-        glEnable(GL_BLEND);
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        state_.enableBlend();
+        state_.blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+        const FrameBlock block{{view_scale_, view_offset_, width, height},
+                               {time_, 0.0f, 0.0f, 0.0f}};
+        const bool changed = !frame_block_ || std::memcmp(&*frame_block_, &block,
+                                                          sizeof block) != 0;
+        if (changed) {
+            // Bound here, not trusted from init(): outside code may rebind it.
+            glBindBuffer(GL_UNIFORM_BUFFER, ubo_);
+            glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof block, &block);
+            frame_block_ = block;
+        }
+        state_.count(changed);
+        batches_used_ = 0;
+        layer_run_    = 0;
+        run_layer_.reset();
     }
 
-    void setView(float scale, float offset) {
-        view_scale_  = scale;
-        view_offset_ = offset;
+    void endFrame() override {
+        flush();
+        frame_.glCalls  = state_.counters().issued;
+        frame_.glElided = state_.counters().elided;
+        last_ = frame_;
     }
 
-    void drawPoints(const std::vector<Vertex>& verts, float size = 2.0f) {
-        if (!verts.empty()) draw(verts, GL_POINTS, size);
+    /// Seconds since the visualizer started, for the frame uniform block.
+    void setFrameTime(float seconds) { time_ = seconds; }
+
+    /// Forget cached GL state after code outside the renderer touched it,
+    /// and restore the frame block's binding point.
+    void invalidateState() {
+        state_.invalidate();
+        frame_block_.reset();
+        if (ubo_) glBindBufferBase(GL_UNIFORM_BUFFER, kFrameBinding, ubo_);
     }
-    void drawLines(const std::vector<Vertex>& verts) {
-        if (!verts.empty()) draw(verts, GL_LINES, 1.0f);
+
+    void setStreamMode(StreamMode mode) {
+        stream_mode_ = mode;
+        capacity_    = 0;   // force the next upload to re-specify the store
+        ring_head_   = 0;
     }
-    void drawLineStrip(const std::vector<Vertex>& verts) {
-        if (!verts.empty()) draw(verts, GL_LINE_STRIP, 1.0f);
+
+    [[nodiscard]] StreamMode streamMode() const { return stream_mode_; }
+
+    /// Merge draws into per-layer batches issued at endFrame() (default), or
+    /// upload and draw each call as it arrives.
+    void setBatching(bool on) {
+        flush();
+        batching_ = on;
+    }
+
+    [[nodiscard]] bool batching() const { return batching_; }
+
+    /// Draw quads indexed (default) or expanded to six vertices each on the
+    /// CPU, for comparison.
+    void setIndexedQuads(bool on) { indexed_quads_ = on; }
+
+    [[nodiscard]] bool indexedQuads() const { return indexed_quads_; }
+
+    [[nodiscard]] TypedDrawSupport typedDraws() const override {
+        return {.seriesData  = vertexPulling(),
+                .bifurcation = gpuBifurcation(),
+                .lyapunov    = lyap_.step != 0,
+                .density     = density_.program != 0};
+    }
+
+    /// Draw series plots from data textures (default) or from CPU-built
+    /// vertices.
+    void setVertexPulling(bool on) { vertex_pulling_ = on; }
+
+    [[nodiscard]] bool vertexPulling() const { return vertex_pulling_ && data_.program; }
+
+    bool drawSeriesData(const SeriesDataDraw& d) override {
+        if (!vertexPulling() || d.count <= 0) return false;
+        const std::size_t n = d.terms.size();
+        if (d.sums.size() != n || rowsFor(n) > data_.maxRows) return false;
+        flush();   // keep the order of draws already queued
+
+        const auto t0 = Clock::now();
+        const std::uint64_t bytes = syncData(d);
+        const auto t1 = Clock::now();
+
+        const DataUniforms& u = data_.u;
+        state_.useProgram(data_.program);
+        glUniform1i(u.mode,       d.part == SeriesPart::Bars ? 0 : 1);
+        glUniform1i(u.first,      d.first);
+        glUniform1i(u.total,      static_cast<GLint>(n));
+        glUniform4f(u.layout,     d.xMin, d.barW, d.gap, d.base);
+        glUniform3f(u.scale,      d.yPerUnit, d.reveal, d.barAlpha);
+        glUniform4f(u.hsv,        d.palette.hue, d.palette.hueShift, d.palette.sat,
+                                  d.palette.val);
+        glUniform3f(u.negHsv,     d.palette.negHue, d.palette.negSat, d.palette.negVal);
+        glUniform3f(u.sumColour,  d.sumColour[0], d.sumColour[1], d.sumColour[2]);
+        state_.bindTexture(1, data_.sums);
+        state_.bindTexture(0, data_.terms);
+        state_.bindVertexArray(data_.vao);
+        if (d.part == SeriesPart::Bars)
+            glDrawArraysInstanced(GL_TRIANGLES, 0, 6, d.count);
+        else
+            glDrawArrays(GL_LINE_STRIP, 0, d.count);
+        const auto t2 = Clock::now();
+
+        frame_.drawCalls   += 1;
+        frame_.uploads     += bytes ? 1 : 0;
+        frame_.uploadBytes += bytes;
+        frame_.uploadMs    += msBetween(t0, t1);
+        frame_.drawMs      += msBetween(t1, t2);
+        return true;
+    }
+
+    /// Compute bifurcation diagrams on the GPU when the shader has passed
+    /// validation (default), or leave them to the visualizer.
+    void setGpuBifurcation(bool on) { gpu_bifurcation_ = on; }
+
+    /// Whether drawBifurcation() is in use: enabled and not (yet) failed.
+    [[nodiscard]] bool gpuBifurcation() const {
+        return gpu_bifurcation_ && bif_.program && bif_.validated.value_or(true);
+    }
+
+    bool drawBifurcation(const BifurcationDraw& d) override {
+        if (!gpuBifurcation() || d.columns < 2 || d.samples <= 0 || d.visible <= 0) return false;
+        if (!bif_.validated) {
+            bif_.validated = validateBifurcation();
+            if (!*bif_.validated) {
+                std::printf("GPU bifurcation disagrees with the CPU reference; disabled\n");
+                return false;
+            }
+        }
+        flush();   // keep the order of draws already queued
+
+        const auto t0 = Clock::now();
+        state_.useProgram(bif_.program);
+        setBifurcationUniforms(d);
+        state_.bindVertexArray(bif_.vao);
+        glDrawArrays(GL_POINTS, 0, std::min(d.visible, d.columns) * d.samples);
+
+        frame_.drawCalls += 1;
+        frame_.drawMs    += msBetween(t0, Clock::now());
+        return true;
+    }
+
+    bool drawLyapunov(const LyapunovDraw& d) override {
+        LyapunovPasses& ly = lyap_;
+        if (!ly.step || d.length < 1 || d.length > 32 || d.iterations <= 0) return false;
+        if (!sizeLyapunovState(frame_w_, frame_h_)) return false;
+        if (ly.draw != d || ly.view != std::array{view_scale_, view_offset_}) {
+            ly.draw = d;
+            ly.view = {view_scale_, view_offset_};
+            ly.done = 0;
+        }
+        flush();   // keep the order of draws already queued
+
+        const auto t0 = Clock::now();
+        state_.bindVertexArray(ly.vao);
+        if (ly.done < d.iterations) {
+            const int steps = d.perFrame > 0 ? std::min(d.perFrame, d.iterations - ly.done)
+                                             : d.iterations - ly.done;
+            GLint target = 0;   // the caller's framebuffer, restored below
+            glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &target);
+            glBindFramebuffer(GL_FRAMEBUFFER, ly.fbo[1 - ly.current]);
+            state_.disableBlend();
+            state_.useProgram(ly.step);
+            setLyapunovShape(ly.stepU, d);
+            glUniform1ui(ly.pattern, d.pattern);
+            glUniform4i(ly.counts, d.length, ly.done ? d.warmup + ly.done : 0,
+                        ly.done ? 0 : d.warmup, steps);
+            state_.bindTexture(0, ly.tex[ly.current]);
+            glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+            glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(target));
+            state_.enableBlend();
+            ly.current  = 1 - ly.current;
+            ly.done    += steps;
+            frame_.drawCalls += 1;
+        }
+
+        state_.useProgram(ly.resolve);
+        setLyapunovShape(ly.resolveU, d);
+        glUniform1f(ly.count, static_cast<float>(ly.done));
+        glUniform4f(ly.palette, d.stableHue, d.chaosHue, d.sat, d.contrast);
+        state_.bindTexture(0, ly.tex[ly.current]);
+        glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+
+        frame_.drawCalls += 1;
+        frame_.drawMs    += msBetween(t0, Clock::now());
+        return true;
     }
-    void drawTriangles(const std::vector<Vertex>& verts) {
-        if (!verts.empty()) draw(verts, GL_TRIANGLES, 1.0f);
+
+    bool drawDensity(const DensityDraw& d) override {
+        DensityTexture& dt = density_;
+        const auto bins = static_cast<std::size_t>(d.width) * static_cast<std::size_t>(d.height);
+        if (!dt.program || d.width <= 0 || d.height <= 0 || d.width > dt.maxSize ||
+            d.height > dt.maxSize || d.counts.size() != bins)
+            return false;
+        flush();   // keep the order of draws already queued
+
+        const auto t0 = Clock::now();
+        std::uint64_t bytes = 0;
+        if (d.source != dt.source || d.revision != dt.revision || d.width != dt.w ||
+            d.height != dt.h) {
+            state_.bindTextureForUpload(dt.tex);
+            if (d.width != dt.w || d.height != dt.h) {
+                glTexImage2D(GL_TEXTURE_2D, 0, GL_R32UI, d.width, d.height, 0, GL_RED_INTEGER,
+                             GL_UNSIGNED_INT, d.counts.data());
+                dt.w = d.width;
+                dt.h = d.height;
+            } else {
+                glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, d.width, d.height, GL_RED_INTEGER,
+                                GL_UNSIGNED_INT, d.counts.data());
+            }
+            dt.source   = d.source;
+            dt.revision = d.revision;
+            bytes       = d.counts.size_bytes();
+        }
+        const auto t1 = Clock::now();
+
+        state_.useProgram(dt.program);
+        glUniform4f(dt.rect, d.xMin, d.xMax, d.yMin, d.yMax);
+        glUniform4f(dt.hsv,  d.hue, d.hueShift, d.sat, d.val);
+        glUniform1f(dt.norm, 1.0f / std::log1p(static_cast<float>(std::max(d.maxCount, 1u))));
+        state_.bindTexture(0, dt.tex);
+        state_.bindVertexArray(dt.vao);
+        glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+        const auto t2 = Clock::now();
+
+        frame_.drawCalls   += 1;
+        frame_.uploads     += bytes ? 1 : 0;
+        frame_.uploadBytes += bytes;
+        frame_.uploadMs    += msBetween(t0, t1);
+        frame_.drawMs      += msBetween(t1, t2);
+        return true;
     }
 
+    /// Steps of the current Lyapunov image accumulated so far.
+    [[nodiscard]] int lyapunovSteps() const { return lyap_.done; }
+
+    /// Counters of the most recently completed frame.
+    [[nodiscard]] const RenderStats& lastFrameStats() const { return last_; }
+
     [[nodiscard]] bool isInitialized() const { return initialized_; }
 
 private:
     GLuint program_       = 0;
     GLuint vao_           = 0;
     GLuint vbo_           = 0;
+    GLuint ibo_           = 0;   // static quad indices, bound in vao_
+    GLuint ubo_           = 0;   // FrameBlock
     GLint  u_point_size_  = -1;
-    GLint  u_view_scale_  = -1;
-    GLint  u_view_offset_ = -1;
-    float  view_scale_    = 1.0f;
-    float  view_offset_   = 0.0f;
     bool   initialized_   = false;
 
-    void draw(const std::vector<Vertex>& verts, GLenum mode, float ps) {
-        glBindVertexArray(vao_);
-        glBindBuffer(GL_ARRAY_BUFFER, vbo_);
-        glBufferData(GL_ARRAY_BUFFER,
-                     static_cast<GLsizeiptr>(verts.size() * sizeof(Vertex)),
-                     verts.data(), GL_DYNAMIC_DRAW);
-        glUniform1f(u_point_size_, ps);
-        glDrawArrays(mode, 0, static_cast<GLsizei>(verts.size()));
-        glBindVertexArray(0);
+    GLStateCache state_;
+
+    // ── Per-frame constants ────────────────────────────────────────────────
+
+    // Starts every vertex shader: the shared Frame block.
+    static constexpr const char* kVertexPrelude =
+        "#version 300 es\n"
+        "layout(std140) uniform Frame {\n"
+        "    vec4 u_view;\n"      // scale, offset, viewport width, height
+        "    vec4 u_frame;\n"     // time in seconds
+        "};\n";
+
+    static constexpr const char* kHsvToRgb =
+        "vec3 hsv2rgb(vec3 c) {\n"
+        "    vec3 p = abs(fract(c.xxx + vec3(1.0, 2.0 / 3.0, 1.0 / 3.0)) * 6.0 - 3.0);\n"
+        "    return c.z * mix(vec3(1.0), clamp(p - 1.0, 0.0, 1.0), c.y);\n"
+        "}\n";
+
+    static constexpr const char* kColourFragment =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "in vec4 v_color;\n"
+        "out vec4 fragColor;\n"
+        "void main() {\n"
+        "    fragColor = v_color;\n"
+        "}\n";
+
+    // std140 layout of the Frame block.
+    struct FrameBlock {
+        float view[4];    // scale, offset, viewport width, height
+        float frame[4];   // time in seconds, unused ×3
+    };
+
+    static constexpr GLuint kFrameBinding = 0;
+
+    float                     time_ = 0.0f;
+    std::optional<FrameBlock> frame_block_;   // contents of ubo_, if known
+
+    /// Attach `program`'s Frame block to the shared binding point.
+    static void useFrameBlock(GLuint program) {
+        const GLuint index = glGetUniformBlockIndex(program, "Frame");
+        if (index != GL_INVALID_INDEX) glUniformBlockBinding(program, index, kFrameBinding);
+    }
+
+    StreamMode  stream_mode_ = StreamMode::BufferData;
+    GLsizeiptr  capacity_    = 0;   // bytes allocated in vbo_
+    GLsizeiptr  ring_head_   = 0;   // next free byte in Ring mode
+    RenderStats frame_;
+    RenderStats last_;
+
+    static constexpr GLsizeiptr kRingBytes = GLsizeiptr{4} << 20;
+
+    // Quads per glDrawElements: GLushort indices reach 4·kQuadBatch corners.
+    static constexpr std::size_t kQuadBatch = 16384;
+
+    bool                indexed_quads_ = true;
+    std::vector<Vertex> expanded_;   // quads as triangles when not indexed
+
+    // ── Batching ───────────────────────────────────────────────────────────
+
+    struct Batch {
+        int                 run;         // layer run the draws came from
+        Primitive           mode;        // never LineStrip
+        float               pointSize;
+        std::vector<Vertex> verts;
+    };
+
+    bool                batching_     = true;
+    std::vector<Batch>  batches_;            // [0, batches_used_) are live; the
+    std::size_t         batches_used_ = 0;   //   rest keep their capacity
+    int                 layer_run_    = 0;
+    std::optional<int>  run_layer_;          // layer of the current run
+    std::vector<Vertex> frame_verts_;        // all batches, back to back
+
+    /// Batch for `mode` and `pointSize` in the current layer run.
+    Batch& batchFor(Primitive mode, float pointSize) {
+        if (run_layer_ != layer_) {
+            run_layer_ = layer_;
+            ++layer_run_;
+        }
+        for (std::size_t i = 0; i < batches_used_; ++i) {
+            Batch& b = batches_[i];
+            if (b.run == layer_run_ && b.mode == mode && b.pointSize == pointSize) return b;
+        }
+        if (batches_used_ == batches_.size()) batches_.emplace_back();
+        Batch& b    = batches_[batches_used_++];
+        b.run       = layer_run_;
+        b.mode      = mode;
+        b.pointSize = pointSize;
+        b.verts.clear();
+        return b;
+    }
+
+    /// Append a draw to its batch, dropping any incomplete trailing
+    /// primitive so merged draws stay aligned.
+    void enqueue(std::span<const Vertex> verts, Primitive mode, float ps) {
+        const std::size_t n = verts.size();
+        switch (mode) {
+            case Primitive::LineStrip: {
+                std::vector<Vertex>& out = batchFor(Primitive::Lines, 1.0f).verts;
+                for (std::size_t i = 0; i + 1 < n; ++i) {
+                    out.push_back(verts[i]);
+                    out.push_back(verts[i + 1]);
+                }
+                return;
+            }
+            case Primitive::Quads:
+                if (!indexed_quads_) {
+                    std::vector<Vertex>& out = batchFor(Primitive::Triangles, 1.0f).verts;
+                    for (std::size_t q = 0; q + 3 < n; q += 4)
+                        for (const std::uint16_t i : kQuadIndices) out.push_back(verts[q + i]);
+                    return;
+                }
+                append(batchFor(mode, 1.0f).verts, verts.first(n - n % 4));
+                return;
+            case Primitive::Lines:
+                append(batchFor(mode, 1.0f).verts, verts.first(n - n % 2));
+                return;
+            case Primitive::Triangles:
+                append(batchFor(mode, 1.0f).verts, verts.first(n - n % 3));
+                return;
+            case Primitive::Points:
+                append(batchFor(mode, ps).verts, verts);
+                return;
+        }
+    }
+
+    static void append(std::vector<Vertex>& out, std::span<const Vertex> verts) {
+        out.insert(out.end(), verts.begin(), verts.end());
+    }
+
+    /// Upload every queued batch at once and issue one draw per batch.
+    void flush() {
+        if (!batches_used_) return;
+        frame_verts_.clear();
+        for (std::size_t i = 0; i < batches_used_; ++i) append(frame_verts_, batches_[i].verts);
+        const std::size_t used = batches_used_;
+        batches_used_ = 0;
+        if (frame_verts_.empty()) return;
+
+        const auto bytes = static_cast<GLsizeiptr>(frame_verts_.size() * sizeof(Vertex));
+        bindStream();
+
+        const auto t0 = Clock::now();
+        GLint first = upload(frame_verts_.data(), bytes);
+        const auto t1 = Clock::now();
+        std::uint32_t calls = 0;
+        for (std::size_t i = 0; i < used; ++i) {
+            const Batch& b = batches_[i];
+            if (b.verts.empty()) continue;
+            calls += issue(first, b.verts.size(), b.mode, b.pointSize);
+            first += static_cast<GLint>(b.verts.size());
+        }
+        const auto t2 = Clock::now();
+
+        frame_.drawCalls   += calls;
+        frame_.uploads     += 1;
+        frame_.uploadBytes += static_cast<std::uint64_t>(bytes);
+        frame_.uploadMs    += msBetween(t0, t1);
+        frame_.drawMs      += msBetween(t1, t2);
+    }
+
+    // ── Data-texture series draws ──────────────────────────────────────────
+
+    static constexpr GLsizei kDataWidth = 4096;   // texels per row
+
+    struct DataUniforms {
+        GLint mode = -1, first = -1, total = -1;
+        GLint layout = -1, scale = -1, hsv = -1, negHsv = -1, sumColour = -1;
+    };
+
+    struct DataTextures {
+        GLuint        program  = 0;
+        GLuint        vao      = 0;   // no attributes: everything is pulled
+        GLuint        terms    = 0;
+        GLuint        sums     = 0;
+        GLsizei       rows     = 0;   // allocated texture height
+        GLsizei       maxRows  = 0;
+        std::uint64_t source   = 0;
+        std::uint64_t revision = 0;
+        std::size_t   uploaded = 0;   // texels holding current values
+        DataUniforms  u;
+    };
+
+    bool         vertex_pulling_ = true;
+    DataTextures data_;
+
+    // ── GPU bifurcation diagrams ───────────────────────────────────────────
+
+    struct BifurcationProgram {
+        GLuint program = 0;
+        GLuint vao     = 0;   // no attributes: gl_VertexID is the input
+        GLint  r = -1, counts = -1, rect = -1, hsv = -1, alpha = -1, pointSize = -1;
+        std::optional<bool> validated;   // set by the first draw
+    };
+
+    bool               gpu_bifurcation_ = true;
+    BifurcationProgram bif_;
+
+    void initBifurcation() {
+        const char* vs_src =
+            "uniform vec2  u_r;\n"           // rMin, rMax
+            "uniform ivec3 u_counts;\n"      // columns, samples, warmup
+            "uniform vec4  u_rect;\n"        // xMin, xMax, yMin, yMax
+            "uniform vec4  u_hsv;\n"         // hue, hueShift, sat, val
+            "uniform float u_alpha;\n"
+            "uniform float u_point_size;\n"
+            "out vec4  v_color;\n"
+            "out float v_x;\n"               // captured when validating
+            "void main() {\n"
+            "    int   col = gl_VertexID / u_counts.y;\n"
+            "    int   n   = u_counts.z + gl_VertexID - col * u_counts.y + 1;\n"
+            "    float t   = float(col) / float(u_counts.x - 1);\n"
+            "    float r   = u_r.x + (u_r.y - u_r.x) * t;\n"
+            "    float x   = 0.5;\n"
+            "    for (int i = 0; i < n; ++i) x = r * x * (1.0 - x);\n"
+            "    v_x = x;\n"
+            "    vec2 pos = vec2(u_rect.x + (u_rect.y - u_rect.x) * t,\n"
+            "                    u_rect.z + (u_rect.w - u_rect.z) * x);\n"
+            "    gl_Position  = vec4(pos.x * u_view.x + u_view.y, pos.y, 0.0, 1.0);\n"
+            "    gl_PointSize = u_point_size;\n"
+            "    vec3 hsv = vec3(u_hsv.x + u_hsv.y * t, u_hsv.z, u_hsv.w);\n"
+            "    v_color = vec4(hsv2rgb(hsv), u_alpha);\n"
+            "}\n";
+
+        const GLuint prog =
+            linkProgram({kVertexPrelude, kHsvToRgb, vs_src}, {kColourFragment}, "v_x");
+        if (!prog) return;   // the visualizer iterates on the CPU
+        bif_.program   = prog;
+        bif_.r         = glGetUniformLocation(prog, "u_r");
+        bif_.counts    = glGetUniformLocation(prog, "u_counts");
+        bif_.rect      = glGetUniformLocation(prog, "u_rect");
+        bif_.hsv       = glGetUniformLocation(prog, "u_hsv");
+        bif_.alpha     = glGetUniformLocation(prog, "u_alpha");
+        bif_.pointSize = glGetUniformLocation(prog, "u_point_size");
+        glGenVertexArrays(1, &bif_.vao);
+    }
+
+    void setBifurcationUniforms(const BifurcationDraw& d) {
+        glUniform2f(bif_.r,         d.rMin, d.rMax);
+        glUniform3i(bif_.counts,    d.columns, d.samples, d.warmup);
+        glUniform4f(bif_.rect,      d.xMin, d.xMax, d.yMin, d.yMax);
+        glUniform4f(bif_.hsv,       d.hue, d.hueShift, d.sat, d.val);
+        glUniform1f(bif_.alpha,     d.alpha);
+        glUniform1f(bif_.pointSize, d.pointSize);
+    }
+
+    /// Capture a small diagram through transform feedback and compare it
+    /// with the same iteration on the CPU.  Iterations are few enough that
+    /// rounding differences (e.g. fused multiply-adds) stay far below the
+    /// tolerance even where the map is chaotic.
+    bool validateBifurcation() {
+        BifurcationDraw d;
+        d.columns = 256;
+        d.visible = 256;
+        d.samples = 4;
+        d.warmup  = 4;
+        const int        n     = d.columns * d.samples;
+        const GLsizeiptr bytes = n * GLsizeiptr{sizeof(float)};
+        constexpr float  kTolerance = 1e-3f;
+
+        GLuint buf = 0;
+        glGenBuffers(1, &buf);
+        glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, buf);
+        glBufferData(GL_TRANSFORM_FEEDBACK_BUFFER, bytes, nullptr, GL_STATIC_READ);
+        state_.useProgram(bif_.program);
+        setBifurcationUniforms(d);
+        state_.bindVertexArray(bif_.vao);
+        glEnable(GL_RASTERIZER_DISCARD);
+        glBeginTransformFeedback(GL_POINTS);
+        glDrawArrays(GL_POINTS, 0, n);
+        glEndTransformFeedback();
+        glDisable(GL_RASTERIZER_DISCARD);
+
+        std::vector<float> gpu(static_cast<std::size_t>(n));
+        const bool read = readBuffer(GL_TRANSFORM_FEEDBACK_BUFFER, bytes, gpu.data());
+        glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0);
+        glDeleteBuffers(1, &buf);
+        if (!read) return false;
+
+        for (int c = 0; c < d.columns; ++c) {
+            const float t = static_cast<float>(c) / static_cast<float>(d.columns - 1);
+            const float r = d.rMin + (d.rMax - d.rMin) * t;
+            float x = 0.5f;
+            for (int i = 0; i < d.warmup; ++i) x = r * x * (1.0f - x);
+            for (int i = 0; i < d.samples; ++i) {
+                x = r * x * (1.0f - x);
+                const float g = gpu[static_cast<std::size_t>(c * d.samples + i)];
+                if (!(std::abs(g - x) <= kTolerance)) return false;   // NaN fails too
+            }
+        }
+        return true;
+    }
+
+    /// Copy the first `bytes` of the buffer bound to `target` into `out`.
+    static bool readBuffer(GLenum target, GLsizeiptr bytes, void* out) {
+#ifdef __EMSCRIPTEN__
+        glGetBufferSubData(target, 0, bytes, out);
+        return true;
+#else
+        const void* p = glMapBufferRange(target, 0, bytes, GL_MAP_READ_BIT);
+        if (!p) return false;
+        std::memcpy(out, p, static_cast<std::size_t>(bytes));
+        return glUnmapBuffer(target) == GL_TRUE;
+#endif
+    }
+
+    // ── GPU Lyapunov fractals ──────────────────────────────────────────────
+
+    struct ShapeUniforms {
+        GLint rect = -1, ab = -1;
+    };
+
+    struct LyapunovPasses {
+        GLuint        step     = 0;   // advances the state textures
+        GLuint        resolve  = 0;   // colours λ into the frame
+        GLuint        vao      = 0;   // no attributes: corners from gl_VertexID
+        ShapeUniforms stepU, resolveU;
+        GLint         pattern  = -1, counts = -1, count = -1, palette = -1;
+        GLuint        tex[2]   = {0, 0};
+        GLuint        fbo[2]   = {0, 0};
+        GLsizei       w        = 0;   // state texture size
+        GLsizei       h        = 0;
+        bool          complete = true;   // float targets render
+        int           current  = 0;   // texture holding the latest state
+        int           done     = 0;   // steps accumulated in it
+        std::optional<LyapunovDraw> draw;   // what the state belongs to
+        std::array<float, 2>        view{};
+    };
+
+    LyapunovPasses lyap_;
+    GLsizei        frame_w_ = 0;
+    GLsizei        frame_h_ = 0;
+
+    void initLyapunov() {
+        const char* vs_src =
+            "uniform vec4 u_rect;\n"   // xMin, xMax, yMin, yMax
+            "uniform vec4 u_ab;\n"     // aMin, aMax, bMin, bMax
+            "out vec2 v_ab;\n"
+            "void main() {\n"
+            "    vec2 t   = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));\n"
+            "    vec2 pos = mix(u_rect.xz, u_rect.yw, t);\n"
+            "    v_ab = mix(u_ab.xz, u_ab.yw, t);\n"
+            "    gl_Position = vec4(pos.x * u_view.x + u_view.y, pos.y, 0.0, 1.0);\n"
+            "}\n";
+        const char* fs_prelude =
+            "#version 300 es\n"
+            "precision highp float;\n"
+            "precision highp int;\n"
+            "uniform highp sampler2D u_state;\n"   // x, Σ ln|r·(1 − 2x)|
+            "in vec2 v_ab;\n"
+            "out vec4 fragColor;\n";
+        const char* step_src =
+            "uniform uint  u_pattern;\n"
+            "uniform ivec4 u_counts;\n"   // length, first step, warmup, steps
+            "float rate(int i) {\n"
+            "    return ((u_pattern >> uint(i % u_counts.x)) & 1u) != 0u ? v_ab.y : v_ab.x;\n"
+            "}\n"
+            "void main() {\n"
+            "    vec2 s = u_counts.y == 0 ? vec2(0.5, 0.0)\n"
+            "                             : texelFetch(u_state, ivec2(gl_FragCoord.xy), 0).xy;\n"
+            "    int  i = u_counts.y;\n"
+            "    for (int k = 0; k < u_counts.z; ++k, ++i) {\n"
+            "        float r = rate(i);\n"
+            "        s.x = r * s.x * (1.0 - s.x);\n"
+            "    }\n"
+            "    for (int k = 0; k < u_counts.w; ++k, ++i) {\n"
+            "        float r = rate(i);\n"
+            "        s.y += log(max(abs(r * (1.0 - 2.0 * s.x)), 1e-30));\n"
+            "        s.x  = r * s.x * (1.0 - s.x);\n"
+            "    }\n"
+            "    fragColor = vec4(s, 0.0, 1.0);\n"
+            "}\n";
+        const char* resolve_src =
+            "uniform float u_count;\n"
+            "uniform vec4  u_palette;\n"   // stableHue, chaosHue, sat, contrast
+            "void main() {\n"
+            "    float l = texelFetch(u_state, ivec2(gl_FragCoord.xy), 0).y / u_count;\n"
+            "    vec3 hsv = l <= 0.0\n"
+            "        ? vec3(u_palette.x, u_palette.z, 0.95 - 0.8 * (1.0 - exp(l * u_palette.w)))\n"
+            "        : vec3(u_palette.y, u_palette.z, 0.6 - 0.5 * (1.0 - exp(-l * u_palette.w)));\n"
+            "    fragColor = vec4(hsv2rgb(hsv), 1.0);\n"
+            "}\n";
+
+        const GLuint step    = linkProgram({kVertexPrelude, vs_src}, {fs_prelude, step_src});
+        const GLuint resolve = linkProgram({kVertexPrelude, vs_src},
+                                           {fs_prelude, kHsvToRgb, resolve_src});
+        if (!step || !resolve) {   // the visualizer computes λ on the CPU
+            glDeleteProgram(step);
+            glDeleteProgram(resolve);
+            return;
+        }
+        LyapunovPasses& ly = lyap_;
+        ly.step     = step;
+        ly.resolve  = resolve;
+        ly.stepU    = {glGetUniformLocation(step, "u_rect"), glGetUniformLocation(step, "u_ab")};
+        ly.resolveU = {glGetUniformLocation(resolve, "u_rect"),
+                       glGetUniformLocation(resolve, "u_ab")};
+        ly.pattern  = glGetUniformLocation(step, "u_pattern");
+        ly.counts   = glGetUniformLocation(step, "u_counts");
+        ly.count    = glGetUniformLocation(resolve, "u_count");
+        ly.palette  = glGetUniformLocation(resolve, "u_palette");
+        glGenVertexArrays(1, &ly.vao);
+        glGenTextures(2, ly.tex);
+        glGenFramebuffers(2, ly.fbo);
+    }
+
+    static void setLyapunovShape(const ShapeUniforms& u, const LyapunovDraw& d) {
+        glUniform4f(u.rect, d.xMin, d.xMax, d.yMin, d.yMax);
+        glUniform4f(u.ab,   d.aMin, d.aMax, d.bMin, d.bMax);
+    }
+
+    /// (Re)allocate the state textures at `w`×`h`, restarting accumulation;
+    /// false if float targets cannot be rendered to.
+    bool sizeLyapunovState(GLsizei w, GLsizei h) {
+        LyapunovPasses& ly = lyap_;
+        if (!ly.complete || w <= 0 || h <= 0) return false;
+        if (w == ly.w && h == ly.h) return true;
+
+        GLint target = 0;
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &target);
+        for (int i = 0; i < 2; ++i) {
+            state_.bindTextureForUpload(ly.tex[i]);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RG32F, w, h, 0, GL_RG, GL_FLOAT, nullptr);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+            glBindFramebuffer(GL_FRAMEBUFFER, ly.fbo[i]);
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                                   ly.tex[i], 0);
+            ly.complete = ly.complete &&
+                          glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+        }
+        glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(target));
+        if (!ly.complete) {
+            std::printf("RG32F render targets unsupported; Lyapunov fractals on the CPU\n");
+            return false;
+        }
+        ly.w    = w;
+        ly.h    = h;
+        ly.draw.reset();
+        return true;
+    }
+
+    // ── Density histograms ─────────────────────────────────────────────────
+
+    struct DensityTexture {
+        GLuint        program  = 0;
+        GLuint        vao      = 0;   // no attributes: corners from gl_VertexID
+        GLuint        tex      = 0;   // R32UI counts
+        GLint         rect = -1, hsv = -1, norm = -1;
+        GLsizei       w        = 0;   // allocated texture size
+        GLsizei       h        = 0;
+        GLsizei       maxSize  = 0;
+        std::uint64_t source   = 0;
+        std::uint64_t revision = 0;
+    };
+
+    DensityTexture density_;
+
+    void initDensity() {
+        const char* vs_src =
+            "uniform vec4 u_rect;\n"   // xMin, xMax, yMin, yMax
+            "out vec2 v_uv;\n"
+            "void main() {\n"
+            "    v_uv = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));\n"
+            "    vec2 pos = mix(u_rect.xz, u_rect.yw, v_uv);\n"
+            "    gl_Position = vec4(pos.x * u_view.x + u_view.y, pos.y, 0.0, 1.0);\n"
+            "}\n";
+        const char* fs_prelude =
+            "#version 300 es\n"
+            "precision highp float;\n"
+            "precision highp int;\n"
+            "uniform highp usampler2D u_counts;\n"
+            "uniform vec4  u_hsv;\n"    // hue, hueShift, sat, val
+            "uniform float u_norm;\n"   // 1 / ln(1 + maxCount)
+            "in vec2 v_uv;\n"
+            "out vec4 fragColor;\n";
+        const char* fs_src =
+            "void main() {\n"
+            "    ivec2 size = textureSize(u_counts, 0);\n"
+            "    ivec2 bin  = min(ivec2(v_uv * vec2(size)), size - 1);\n"
+            "    uint  c    = texelFetch(u_counts, bin, 0).r;\n"
+            "    if (c == 0u) discard;\n"
+            "    float t = log(1.0 + float(c)) * u_norm;\n"
+            "    fragColor = vec4(hsv2rgb(vec3(u_hsv.x + u_hsv.y * t, u_hsv.zw)), t);\n"
+            "}\n";
+
+        const GLuint prog = linkProgram({kVertexPrelude, vs_src}, {fs_prelude, kHsvToRgb, fs_src});
+        if (!prog) return;   // visualizers draw their bins as quads
+        DensityTexture& dt = density_;
+        dt.program = prog;
+        dt.rect    = glGetUniformLocation(prog, "u_rect");
+        dt.hsv     = glGetUniformLocation(prog, "u_hsv");
+        dt.norm    = glGetUniformLocation(prog, "u_norm");
+        glGetIntegerv(GL_MAX_TEXTURE_SIZE, &dt.maxSize);
+        glGenVertexArrays(1, &dt.vao);
+        glGenTextures(1, &dt.tex);
+        state_.bindTextureForUpload(dt.tex);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    }
+
+    static GLsizei rowsFor(std::size_t n) {
+        return static_cast<GLsizei>((n + kDataWidth - 1) / kDataWidth);
+    }
+
+    void initData() {
+        const char* vs_src =
+            "uniform highp sampler2D u_terms;\n"
+            "uniform highp sampler2D u_sums;\n"
+            "uniform int   u_mode;\n"        // 0 bars, 1 sum line
+            "uniform int   u_first;\n"
+            "uniform int   u_total;\n"
+            "uniform vec4  u_layout;\n"      // xMin, barW, gap, base
+            "uniform vec3  u_scale;\n"       // yPerUnit, reveal, barAlpha
+            "uniform vec4  u_hsv;\n"         // hue, hueShift, sat, val
+            "uniform vec3  u_neg_hsv;\n"
+            "uniform vec3  u_sum_colour;\n"
+            "out vec4 v_color;\n"
+            "float fetch(highp sampler2D t, int i) {\n"
+            "    return texelFetch(t, ivec2(i % 4096, i / 4096), 0).r;\n"
+            "}\n"
+            "void main() {\n"
+            "    int   i = u_first + (u_mode == 0 ? gl_InstanceID : gl_VertexID);\n"
+            "    float x = u_layout.x + float(i) * u_layout.y;\n"
+            "    float a = clamp(u_scale.y - float(i), 0.0, 1.0);\n"
+            "    vec2  pos;\n"
+            "    if (u_mode == 0) {\n"
+            "        float t  = fetch(u_terms, i);\n"
+            "        float y2 = u_layout.w + t * u_scale.x;\n"
+            "        int   c  = gl_VertexID;\n"   // (x1,y1) (x2,y1) (x1,y2) (x2,y1) (x2,y2) (x1,y2)
+            "        bool  right = c == 1 || c == 3 || c == 4;\n"
+            "        bool  top   = c == 2 || c == 4 || c == 5;\n"
+            "        pos = vec2(right ? x + u_layout.y - u_layout.z : x + u_layout.z,\n"
+            "                   top ? max(u_layout.w, y2) : min(u_layout.w, y2));\n"
+            "        float g   = float(i) / float(max(u_total - 1, 1));\n"
+            "        vec3  hsv = t < 0.0 ? u_neg_hsv\n"
+            "                            : vec3(u_hsv.x + u_hsv.y * g, u_hsv.z, u_hsv.w);\n"
+            "        v_color = vec4(hsv2rgb(hsv), a * u_scale.z);\n"
+            "    } else {\n"
+            "        pos = vec2(x + 0.5 * u_layout.y, u_layout.w + fetch(u_sums, i) * u_scale.x);\n"
+            "        v_color = vec4(u_sum_colour, a);\n"
+            "    }\n"
+            "    gl_Position = vec4(pos.x * u_view.x + u_view.y, pos.y, 0.0, 1.0);\n"
+            "}\n";
+
+        const GLuint prog = linkProgram({kVertexPrelude, kHsvToRgb, vs_src});
+        if (!prog) return;   // vertex pulling stays off
+
+        DataUniforms& u = data_.u;
+        u.mode       = glGetUniformLocation(prog, "u_mode");
+        u.first      = glGetUniformLocation(prog, "u_first");
+        u.total      = glGetUniformLocation(prog, "u_total");
+        u.layout     = glGetUniformLocation(prog, "u_layout");
+        u.scale      = glGetUniformLocation(prog, "u_scale");
+        u.hsv        = glGetUniformLocation(prog, "u_hsv");
+        u.negHsv     = glGetUniformLocation(prog, "u_neg_hsv");
+        u.sumColour  = glGetUniformLocation(prog, "u_sum_colour");
+        glUseProgram(prog);
+        glUniform1i(glGetUniformLocation(prog, "u_terms"), 0);
+        glUniform1i(glGetUniformLocation(prog, "u_sums"),  1);
+        glUseProgram(0);
+
+        GLint maxSize = 0;
+        glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxSize);
+        if (maxSize < kDataWidth) {
+            glDeleteProgram(prog);
+            return;
+        }
+        data_.program = prog;
+        data_.maxRows = maxSize;
+        glGenVertexArrays(1, &data_.vao);
+        glGenTextures(1, &data_.terms);
+        glGenTextures(1, &data_.sums);
+    }
+
+    /// Make the textures hold d.terms / d.sums; returns bytes uploaded.
+    std::uint64_t syncData(const SeriesDataDraw& d) {
+        const std::size_t n    = d.terms.size();
+        const GLsizei     rows = rowsFor(n);
+        if (d.source != data_.source || d.revision != data_.revision) data_.uploaded = 0;
+        if (rows > data_.rows) {
+            data_.rows = std::min(std::max(rows, data_.rows * 2), data_.maxRows);
+            for (GLuint tex : {data_.terms, data_.sums}) {
+                state_.bindTextureForUpload(tex);
+                glTexImage2D(GL_TEXTURE_2D, 0, GL_R32F, kDataWidth, data_.rows, 0, GL_RED,
+                             GL_FLOAT, nullptr);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+            }
+            data_.uploaded = 0;
+        }
+        data_.source   = d.source;
+        data_.revision = d.revision;
+
+        const std::size_t from = data_.uploaded;
+        data_.uploaded = n;
+        if (n <= from) return 0;   // shrinking keeps the stored prefix valid
+        state_.bindTextureForUpload(data_.terms);
+        uploadTexels(d.terms.data(), from, n);
+        state_.bindTextureForUpload(data_.sums);
+        uploadTexels(d.sums.data(), from, n);
+        return std::uint64_t{2} * (n - from) * sizeof(float);
+    }
+
+    /// Copy values [lo, hi) into the row-major texels of the bound texture:
+    /// the tail of a partial first row, whole rows, then the head of the last.
+    static void uploadTexels(const float* v, std::size_t lo, std::size_t hi) {
+        constexpr auto W = static_cast<std::size_t>(kDataWidth);
+        auto put = [v](std::size_t i, std::size_t w, std::size_t h) {
+            glTexSubImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(i % W),
+                            static_cast<GLint>(i / W), static_cast<GLsizei>(w),
+                            static_cast<GLsizei>(h), GL_RED, GL_FLOAT, v + i);
+        };
+        if (lo % W) {
+            const std::size_t w = std::min(W - lo % W, hi - lo);
+            put(lo, w, 1);
+            lo += w;
+        }
+        if (const std::size_t rows = (hi - lo) / W) {
+            put(lo, W, rows);
+            lo += rows * W;
+        }
+        if (lo < hi) put(lo, hi - lo, 1);
+    }
+
+    using Clock = std::chrono::steady_clock;
+
+    static double msBetween(Clock::time_point a, Clock::time_point b) {
+        return std::chrono::duration<double, std::milli>(b - a).count();
+    }
+
+    void draw(std::span<const Vertex> verts, Primitive mode,
+              float ps) override {
+        if (batching_) {
+            enqueue(verts, mode, ps);
+            return;
+        }
+        if (mode == Primitive::Quads && !indexed_quads_) {
+            expanded_.clear();
+            for (std::size_t q = 0; q + 3 < verts.size(); q += 4)
+                for (const std::uint16_t i : kQuadIndices) expanded_.push_back(verts[q + i]);
+            if (!expanded_.empty()) draw(expanded_, Primitive::Triangles, ps);
+            return;
+        }
+
+        const auto bytes = static_cast<GLsizeiptr>(verts.size_bytes());
+        bindStream();
+
+        const auto t0 = Clock::now();
+        const GLint first = upload(verts.data(), bytes);
+        const auto t1 = Clock::now();
+        const std::uint32_t calls = issue(first, verts.size(), mode, ps);
+        const auto t2 = Clock::now();
+
+        frame_.drawCalls   += calls;
+        frame_.uploads     += 1;
+        frame_.uploadBytes += static_cast<std::uint64_t>(bytes);
+        frame_.uploadMs    += msBetween(t0, t1);
+        frame_.drawMs      += msBetween(t1, t2);
+    }
+
+    /// Make the streaming program, vao_ and vbo_ current.
+    void bindStream() {
+        state_.useProgram(program_);
+        state_.bindVertexArray(vao_);
+        state_.bindArrayBuffer(vbo_);
+    }
+
+    /// Draw `count` vertices starting at vertex `first` of vbo_ (with vao_
+    /// bound); returns the number of draw calls.
+    std::uint32_t issue(GLint first, std::size_t count, Primitive mode, float ps) {
+        state_.uniform1f(u_point_size_, ps);
+        if (mode == Primitive::Quads) return drawIndexedQuads(first, count / 4);
+        glDrawArrays(toGL(mode), first, static_cast<GLsizei>(count));
+        return 1;
+    }
+
+    /// Draw `quads` quads whose corners start at vertex `first` of vbo_ (with
+    /// vao_ bound); returns the number of draw calls.
+    std::uint32_t drawIndexedQuads(GLint first, std::size_t quads) {
+        std::uint32_t calls = 0;
+        for (std::size_t q = 0; q < quads; q += kQuadBatch, ++calls) {
+            const std::size_t n = std::min(kQuadBatch, quads - q);
+            pointAttributes(static_cast<GLintptr>((static_cast<std::size_t>(first) + 4 * q)
+                                                  * sizeof(Vertex)));
+            glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(6 * n), GL_UNSIGNED_SHORT,
+                           nullptr);
+        }
+        if (first != 0 || quads > kQuadBatch) pointAttributes(0);
+        return calls;
+    }
+
+    /// Point the position (vec2) and colour (vec4) attributes at the vertex
+    /// starting `base` bytes into vbo_ (bound).
+    static void pointAttributes(GLintptr base) {
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex),
+                              reinterpret_cast<void*>(base));
+        glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex),
+                              reinterpret_cast<void*>(base + 2 * sizeof(float)));
+    }
+
+    /// Put `bytes` of vertex data into vbo_ (bound) according to the stream
+    /// mode; returns the index of the first vertex to draw.
+    GLint upload(const void* data, GLsizeiptr bytes) {
+        switch (stream_mode_) {
+            case StreamMode::BufferData:
+                glBufferData(GL_ARRAY_BUFFER, bytes, data, GL_DYNAMIC_DRAW);
+                capacity_ = bytes;
+                return 0;
+
+            case StreamMode::Orphan:
+                capacity_ = std::max(capacity_, bytes);
+                glBufferData(GL_ARRAY_BUFFER, capacity_, nullptr, GL_STREAM_DRAW);
+                glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, data);
+                return 0;
+
+            case StreamMode::SubData:
+                if (bytes > capacity_) {
+                    capacity_ = std::max(bytes, capacity_ * 2);
+                    glBufferData(GL_ARRAY_BUFFER, capacity_, nullptr, GL_DYNAMIC_DRAW);
+                }
+                glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, data);
+                return 0;
+
+            case StreamMode::Ring: {
+                if (bytes > capacity_ || ring_head_ + bytes > capacity_) {
+                    capacity_ = std::max({capacity_, bytes, kRingBytes});
+                    glBufferData(GL_ARRAY_BUFFER, capacity_, nullptr, GL_STREAM_DRAW);
+                    ring_head_ = 0;
+                }
+                glBufferSubData(GL_ARRAY_BUFFER, ring_head_, bytes, data);
+                const auto first = static_cast<GLint>(ring_head_ / GLsizeiptr{sizeof(Vertex)});
+                ring_head_ += bytes;
+                return first;
+            }
+        }
+        return 0;
+    }
+
+    static GLenum toGL(Primitive mode) {
+        switch (mode) {
+            case Primitive::Points:    return GL_POINTS;
+            case Primitive::Lines:     return GL_LINES;
+            case Primitive::LineStrip: return GL_LINE_STRIP;
+            case Primitive::Triangles: return GL_TRIANGLES;
+            case Primitive::Quads:     return GL_TRIANGLES;   // via drawIndexedQuads()
+        }
+        return GL_TRIANGLES;
+    }
+
+    /// Link a vertex shader made of `vsParts` with a fragment shader made of
+    /// `fsParts` (by default the plain colour one), optionally capturing one
+    /// output through transform feedback, and attach it to the Frame block.
+    /// Returns 0 on failure.
+    static GLuint linkProgram(std::initializer_list<const char*> vsParts,
+                              std::initializer_list<const char*> fsParts = {kColourFragment},
+                              const char* feedback = nullptr) {
+        GLuint vs = compileShader(GL_VERTEX_SHADER, vsParts);
+        GLuint fs = compileShader(GL_FRAGMENT_SHADER, fsParts);
+        if (!vs || !fs) {
+            glDeleteShader(vs);
+            glDeleteShader(fs);
+            return 0;
+        }
+
+        GLuint prog = glCreateProgram();
+        glAttachShader(prog, vs);
+        glAttachShader(prog, fs);
+        if (feedback) glTransformFeedbackVaryings(prog, 1, &feedback, GL_INTERLEAVED_ATTRIBS);
+        glLinkProgram(prog);
+        glDeleteShader(vs);
+        glDeleteShader(fs);
+        GLint linked = 0;
+        glGetProgramiv(prog, GL_LINK_STATUS, &linked);
+        if (!linked) {
+            glDeleteProgram(prog);
+            return 0;
+        }
+        useFrameBlock(prog);
+        return prog;
     }
 
-    static GLuint compileShader(GLenum type, const char* src) {
+    /// Compile the concatenation of `parts`.
+    static GLuint compileShader(GLenum type, std::initializer_list<const char*> parts) {
         GLuint s = glCreateShader(type);
-        glShaderSource(s, 1, &src, nullptr);
+        glShaderSource(s, static_cast<GLsizei>(parts.size()), parts.begin(), nullptr);
         glCompileShader(s);
         GLint ok = 0;
         glGetShaderiv(s, GL_COMPILE_STATUS, &ok);
@@ -0,0 +1,154 @@
+// ─── WizSeries: GL State Cache ──────────────────────────────────────────────
+// Shadows the bindings, enables and uniforms GLRenderer sets and drops the
+// calls that would not change them.  Under WebGL every GL call is a
+// validated hop into the GPU process, so a frame that re-binds the same VAO,
+// buffer and program for each draw pays for calls that do nothing.  Counters
+// record how many calls went through and how many were elided.
+//
+// The cache assumes it sees every change to the state it tracks: call
+// invalidate() after anything else may have touched GL (a restored context,
+// third-party code sharing it).
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include <GLES3/gl3.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+class GLStateCache {
+public:
+    struct Counters {
+        std::uint32_t issued = 0;
+        std::uint32_t elided = 0;
+    };
+
+    static constexpr int kTextureUnits = 4;
+
+    /// Forget all shadowed state; the next call of each kind goes through.
+    void invalidate() {
+        const Counters counters = counters_;
+        *this     = {};
+        counters_ = counters;
+    }
+
+    [[nodiscard]] const Counters& counters() const { return counters_; }
+
+    void resetCounters() { counters_ = {}; }
+
+    void useProgram(GLuint program) {
+        if (set(program_, program)) glUseProgram(program);
+    }
+
+    void bindVertexArray(GLuint vao) {
+        if (set(vao_, vao)) glBindVertexArray(vao);
+    }
+
+    void bindArrayBuffer(GLuint buffer) {
+        if (set(array_buffer_, buffer)) glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    }
+
+    /// Bind `texture` as the 2-D texture sampled from `unit`.
+    void bindTexture(int unit, GLuint texture) {
+        if (!set(textures_[static_cast<std::size_t>(unit)], texture)) return;
+        activate(unit);
+        glBindTexture(GL_TEXTURE_2D, texture);
+    }
+
+    /// Bind `texture` to the active unit, for glTexImage2D and friends.
+    void bindTextureForUpload(GLuint texture) {
+        activate(0);
+        bindTexture(0, texture);
+    }
+
+    void enableBlend() {
+        if (set(blend_, 1)) glEnable(GL_BLEND);
+    }
+
+    void disableBlend() {
+        if (set(blend_, 0)) glDisable(GL_BLEND);
+    }
+
+    void blendFunc(GLenum src, GLenum dst) {
+        if (set(blend_func_, {src, dst})) glBlendFunc(src, dst);
+    }
+
+    void viewport(GLint x, GLint y, GLsizei w, GLsizei h) {
+        if (set(viewport_, {x, y, w, h})) glViewport(x, y, w, h);
+    }
+
+    void clearColor(float r, float g, float b, float a) {
+        if (set(clear_colour_, {r, g, b, a})) glClearColor(r, g, b, a);
+    }
+
+    /// glUniform1f on the program in use, skipped if it already holds `v`.
+    void uniform1f(GLint location, float v) {
+        if (location < 0) return;
+        for (Uniform& u : uniforms_) {
+            if (u.program != program_ || u.location != location) continue;
+            if (std::memcmp(&u.value, &v, sizeof v) == 0) {
+                ++counters_.elided;
+                return;
+            }
+            u.value = v;
+            ++counters_.issued;
+            glUniform1f(location, v);
+            return;
+        }
+        uniforms_.push_back({program_, location, v});
+        ++counters_.issued;
+        glUniform1f(location, v);
+    }
+
+    /// Count a call made directly (e.g. a uniform-buffer update) as issued
+    /// or, if the caller found it redundant, as elided.
+    void count(bool issued) { ++(issued ? counters_.issued : counters_.elided); }
+
+private:
+    struct Uniform {
+        GLuint program;
+        GLint  location;
+        float  value;
+    };
+
+    // Values no real state holds, so the first call always goes through.
+    static constexpr GLuint kUnknown = ~GLuint{0};
+
+    Counters counters_;
+
+    GLuint                            program_      = kUnknown;
+    GLuint                            vao_          = kUnknown;
+    GLuint                            array_buffer_ = kUnknown;
+    int                               active_unit_  = -1;
+    std::array<GLuint, kTextureUnits> textures_     = filled<kTextureUnits>(kUnknown);
+    int                               blend_        = -1;
+    std::array<GLenum, 2>             blend_func_   = filled<2>(GLenum{0});
+    std::array<GLint, 4>              viewport_     = filled<4>(GLint{-1});
+    std::array<float, 4>              clear_colour_ = filled<4>(-1.0f);
+    std::vector<Uniform>              uniforms_;
+
+    void activate(int unit) {
+        if (set(active_unit_, unit)) glActiveTexture(GL_TEXTURE0 + static_cast<GLenum>(unit));
+    }
+
+    template <std::size_t N, typename T>
+    static constexpr std::array<T, N> filled(T v) {
+        std::array<T, N> a{};
+        a.fill(v);
+        return a;
+    }
+
+    /// Store `v` in `slot`; true (and counted as issued) if it changed.
+    template <typename T>
+    bool set(T& slot, const T& v) {
+        if (slot == v) {
+            ++counters_.elided;
+            return false;
+        }
+        slot = v;
+        ++counters_.issued;
+        return true;
+    }
+};
@@ -5,139 +5,43 @@
 // ─────────────────────────────────────────────────────────────────────────────
 #pragma once
 
-#include "ISeriesVisualizer.h"
+#include "SeriesPlotVisualizer.h"
 
 #include <algorithm>
 #include <cmath>
 #include <vector>
 
-class GeometricProgressionVisualizer : public ISeriesVisualizer {
+class GeometricProgressionVisualizer : public SeriesPlotVisualizer {
 public:
-    GeometricProgressionVisualizer() {
+    GeometricProgressionVisualizer()
+        : SeriesPlotVisualizer({.defaultTerms = 15.0f,
+                                .maxTerms     = 50,
+                                .revealRate   = 8.0f,
+                                .signedBars   = true,
+                                .barGap       = 0.10f,
+                                // teal bars, warm red when negative
+                                .palette      = {.hue = 0.52f, .sat = 0.65f, .val = 0.60f,
+                                                 .negHue = 0.98f, .negSat = 0.65f, .negVal = 0.70f},
+                                .shapeParam   = "ratio",
+                                .sumColour    = {0.80f, 0.50f, 0.05f}}) {   // deep amber
         params_["ratio"] = 0.70f;
-        params_["terms"] = 15.0f;
     }
 
-    void render(float time, float width, float height,
-                GLRenderer& gl) override {
-        const float ratio =
-            std::clamp(getParam("ratio", 0.70f), -2.0f, 2.0f);
-        const int terms =
-            std::clamp(static_cast<int>(getParam("terms", 15.0f)), 1, 50);
+protected:
+    float shape() const override { return std::clamp(getParam("ratio", 0.70f), -2.0f, 2.0f); }
 
-        // Extra left/bottom margins for axis labels
-        constexpr float mLeft   = 0.14f;
-        constexpr float mRight  = 0.06f;
-        constexpr float mBottom = 0.12f;
-        constexpr float mTop    = 0.08f;
-
-        const float xMin = -1.0f + mLeft;
-        const float xMax =  1.0f - mRight;
-        const float yMid =  0.0f;
-        const float yExt =  1.0f - std::max(mTop, mBottom);
-
-        // ── Pre-scan for scaling ────────────────────────────────────────────
-        float maxAbsVal = 0.0f;
-        float maxAbsSum = 0.0f;
-        {
-            float v = 1.0f, s = 0.0f;
-            for (int k = 0; k < terms; ++k) {
-                maxAbsVal = std::max(maxAbsVal, std::abs(v));
-                s += v;
-                maxAbsSum = std::max(maxAbsSum, std::abs(s));
-                v *= ratio;
-            }
-        }
-        const float scale = std::max({maxAbsVal, maxAbsSum, 0.001f});
-
-        const float barW   = (xMax - xMin) / static_cast<float>(terms);
-        const float barGap = barW * 0.10f;
-
-        const float revealed = time * 8.0f;
-        const int   visible  = std::min(terms,
-                                        static_cast<int>(revealed) + 1);
-
-        // ── Horizontal gridlines ──────────────────────────────────────────
-        std::vector<Vertex> grid;
-        {
-            float step = scale / 4.0f;
-            if (step < 0.01f) step = 0.01f;
-            // Round step to a nice number
-            float mag = std::pow(10.0f, std::floor(std::log10(step)));
-            step = std::ceil(step / mag) * mag;
-
-            for (float v = step; v < scale; v += step) {
-                float gy = yMid + (v / scale) * yExt;
-                float gyn = yMid - (v / scale) * yExt;
-                grid.push_back({xMin, gy,  0.78f, 0.76f, 0.74f, 0.25f});
-                grid.push_back({xMax, gy,  0.78f, 0.76f, 0.74f, 0.25f});
-                grid.push_back({xMin, gyn, 0.78f, 0.76f, 0.74f, 0.25f});
-                grid.push_back({xMax, gyn, 0.78f, 0.76f, 0.74f, 0.25f});
-            }
-        }
-
-        std::vector<Vertex> quads;
-        quads.reserve(static_cast<size_t>(visible * 6));
-        std::vector<Vertex> sumLine;
-        sumLine.reserve(static_cast<size_t>(visible));
-
-        float val = 1.0f;
-        float partialSum = 0.0f;
-
-        for (int k = 0; k < visible; ++k) {
-            const float alpha =
-                std::clamp(revealed - static_cast<float>(k), 0.0f, 1.0f);
-            partialSum += val;
-
-            const float x1 = xMin + static_cast<float>(k)     * barW + barGap;
-            const float x2 = xMin + static_cast<float>(k + 1) * barW - barGap;
-            const float bh = (val / scale) * yExt;
-
-            // Teal for positive, warm red for negative (light-theme friendly)
-            float cr{}, cg{}, cb{};
-            if (val >= 0.0f)
-                hsvToRgb(0.52f, 0.65f, 0.60f, cr, cg, cb);   // teal
-            else
-                hsvToRgb(0.98f, 0.65f, 0.70f, cr, cg, cb);   // warm red
-
-            float y1 = yMid;
-            float y2 = yMid + bh;
-            if (y1 > y2) std::swap(y1, y2);
-
-            addQuad(quads, x1, y1, x2, y2, cr, cg, cb, alpha * 0.85f);
-
-            // Running sum polyline (deep amber)
-            const float sx = xMin + (static_cast<float>(k) + 0.5f) * barW;
-            const float sy = yMid + (partialSum / scale) * yExt;
-            sumLine.push_back({sx, sy, 0.80f, 0.50f, 0.05f, alpha});
-
-            val *= ratio;
-        }
-
-        // ── Axes (dark for light background) ──────────────────────────────
-        std::vector<Vertex> axes;
-        // Horizontal zero-line
-        axes.push_back({xMin, yMid, 0.30f, 0.28f, 0.26f, 0.8f});
-        axes.push_back({xMax, yMid, 0.30f, 0.28f, 0.26f, 0.8f});
-        // Left vertical axis
-        axes.push_back({xMin, yMid - yExt, 0.30f, 0.28f, 0.26f, 0.8f});
-        axes.push_back({xMin, yMid + yExt, 0.30f, 0.28f, 0.26f, 0.8f});
-
-        // Convergence limit line for |r| < 1
-        if (std::abs(ratio) < 1.0f && std::abs(1.0f - ratio) > 1e-6f
-            && visible >= terms) {
-            const float limit  = 1.0f / (1.0f - ratio);
-            const float limitY = yMid + (limit / scale) * yExt;
-            const float pulse  = 0.5f + 0.5f * std::sin(time * 3.0f);
-            axes.push_back({xMin, limitY,
-                            0.15f, 0.60f, 0.15f, 0.4f + 0.4f * pulse});
-            axes.push_back({xMax, limitY,
-                            0.15f, 0.60f, 0.15f, 0.4f + 0.4f * pulse});
-        }
+    float term(int k) const override {
+        const float ratio = shape();
+        float v = 1.0f;
+        for (int i = 0; i < k; ++i) v *= ratio;
+        return v;
+    }
 
-        gl.drawLines(grid);
-        gl.drawTriangles(quads);
-        gl.drawLines(axes);
-        if (sumLine.size() >= 2) gl.drawLineStrip(sumLine);
+    // Convergence limit line for |r| < 1
+    bool limit(const std::vector<float>& /*sums*/, float& value) const override {
+        const float ratio = shape();
+        if (std::abs(ratio) >= 1.0f || std::abs(1.0f - ratio) <= 1e-6f) return false;
+        value = 1.0f / (1.0f - ratio);
+        return true;
     }
 };
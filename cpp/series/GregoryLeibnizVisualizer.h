@@ -1,136 +1,294 @@
 // ─── WizSeries: Gregory-Leibniz Series Visualizer ───────────────────────────
 // Draws bars for each term (-1)^n/(2n+1) and overlays a running partial-sum
 // line oscillating toward π/4 ≈ 0.7854.
+//
+// Digit mode ("mode" = 1) is the opposite extreme: "digits" hex digits of π
+// starting after position "position_hi"·2²⁰ + "position_lo" (two exact
+// halves, as floats lose integers past 2²⁴), extracted by the BBP formula
+// (BbpPi.h) without any digit before them.  Each extraction yields the
+// digits its error bound leaves exact; its terms run as an incremental task
+// over the job system, a slice at a time, so deep positions fill in cell by
+// cell.  The cells are coloured by digit over a histogram of the sixteen
+// values, and the digits themselves reach the labels through plotReadout().
 // ─────────────────────────────────────────────────────────────────────────────
 #pragma once
 
-#include "ISeriesVisualizer.h"
+#include "BbpPi.h"
+#include "SeriesPlotVisualizer.h"
+#include "StatsWriter.h"
 
 #include <algorithm>
-#include <cmath>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
 #include <vector>
 
-class GregoryLeibnizVisualizer : public ISeriesVisualizer {
+class GregoryLeibnizVisualizer : public SeriesPlotVisualizer {
 public:
-    GregoryLeibnizVisualizer() { params_["terms"] = 40.0f; }
+    GregoryLeibnizVisualizer()
+        : SeriesPlotVisualizer({.defaultTerms = 40.0f,
+                                .maxTerms     = kLongSeriesTerms,
+                                .kind         = SeriesKind::GregoryLeibniz,
+                                .revealRate   = 8.0f,
+                                .signedBars   = true,
+                                .barGap       = 0.10f,
+                                // blue bars, rose when negative
+                                .palette      = {.hue = 0.60f, .sat = 0.60f, .val = 0.65f,
+                                                 .negHue = 0.95f, .negSat = 0.55f, .negVal = 0.70f},
+                                .sumColour    = {0.80f, 0.50f, 0.05f}}) {   // deep amber
+        params_["mode"]        = 0.0f;
+        params_["position_hi"] = 0.0f;
+        params_["position_lo"] = 1000000.0f;
+        params_["digits"]      = 64.0f;
+    }
 
-    void render(float time, float width, float /*height*/,
-                GLRenderer& gl) override {
-        const int terms =
-            std::clamp(static_cast<int>(getParam("terms", 40.0f)), 1, 2000);
+    void render(float time, float width, float height, IRenderer& gl) override {
+        if (getParam("mode", 0.0f) < 0.5f) {
+            SeriesPlotVisualizer::render(time, width, height, gl);
+            return;
+        }
+        const int count = std::clamp(static_cast<int>(getParam("digits", 64.0f)), 1, kMaxDigits);
+        ensureDigits(digitPosition(), count);
+        renderDigits(gl);
+    }
 
-        constexpr float mLeft   = 0.14f;
-        constexpr float mRight  = 0.06f;
-        constexpr float mBottom = 0.12f;
-        constexpr float mTop    = 0.08f;
+    [[nodiscard]] float plotYScale() const override {
+        return getParam("mode", 0.0f) < 0.5f ? SeriesPlotVisualizer::plotYScale() : 0.0f;
+    }
 
-        const float xMin = -1.0f + mLeft;
-        const float xMax =  1.0f - mRight;
-        const float yMid =  0.0f;
-        const float yExt =  1.0f - std::max(mTop, mBottom);
-
-        constexpr float LIMIT = 0.78539816f; // π/4
-
-        // Pre-scan for scaling
-        float maxAbsVal = 0.0f;
-        float maxAbsSum = 0.0f;
-        {
-            float s = 0.0f;
-            for (int n = 0; n < terms; ++n) {
-                float sign = (n % 2 == 0) ? 1.0f : -1.0f;
-                float term = sign / (2.0f * static_cast<float>(n) + 1.0f);
-                maxAbsVal = std::max(maxAbsVal, std::abs(term));
-                s += term;
-                maxAbsSum = std::max(maxAbsSum, std::abs(s));
-            }
-        }
-        const float scale = std::max({maxAbsVal, maxAbsSum, 0.001f});
-
-        const float barW   = (xMax - xMin) / static_cast<float>(terms);
-        const float barGap = barW * 0.10f;
-
-        const float revealed = time * 8.0f;
-        const int   visible  = std::min(terms,
-                                        static_cast<int>(revealed) + 1);
-
-        // ── Horizontal gridlines ────────────────────────────────────────
-        std::vector<Vertex> grid;
-        {
-            float step = scale / 4.0f;
-            if (step < 0.01f) step = 0.01f;
-            float mag = std::pow(10.0f, std::floor(std::log10(step)));
-            step = std::ceil(step / mag) * mag;
-
-            for (float v = step; v < scale; v += step) {
-                float gy = yMid + (v / scale) * yExt;
-                float gyn = yMid - (v / scale) * yExt;
-                grid.push_back({xMin, gy,  0.78f, 0.76f, 0.74f, 0.25f});
-                grid.push_back({xMax, gy,  0.78f, 0.76f, 0.74f, 0.25f});
-                grid.push_back({xMin, gyn, 0.78f, 0.76f, 0.74f, 0.25f});
-                grid.push_back({xMax, gyn, 0.78f, 0.76f, 0.74f, 0.25f});
-            }
-        }
+    [[nodiscard]] std::string plotReadout() const override {
+        if (getParam("mode", 0.0f) < 0.5f) return "null";
+        std::lock_guard<std::mutex> lock(readout_mutex_);
+        return readout_;
+    }
+
+    [[nodiscard]] PointStats pointStats() const override {
+        if (getParam("mode", 0.0f) < 0.5f) return {};
+        return {terms_, rate_};
+    }
+
+    void saveCache(BlobWriter& out) const override {
+        SeriesPlotVisualizer::saveCache(out);
+        if (!started_) return;
+        out.put(pos_);
+        out.put(static_cast<std::int32_t>(count_));
+        out.put(partial_);
+        out.put(next_k_);
+        out.put(terms_);
+        out.putString(digits_);
+    }
+
+    bool loadCache(BlobReader& in) override {
+        if (!SeriesPlotVisualizer::loadCache(in)) return false;
+        if (in.atEnd()) return true;
+        const auto        pos     = in.get<std::uint64_t>();
+        const auto        count   = in.get<std::int32_t>();
+        const auto        partial = in.get<std::uint64_t>();
+        const auto        nextK   = in.get<std::uint64_t>();
+        const auto        terms   = in.get<std::uint64_t>();
+        const std::string digits  = in.getString();
+        if (!in.ok() || count < 1 || count > kMaxDigits ||
+            digits.find_first_not_of("0123456789ABCDEF") != std::string::npos ||
+            nextK > pos + digits.size() + 1)
+            return false;
+        startDigits(pos, count);
+        partial_ = partial;
+        next_k_  = nextK;
+        terms_   = terms;
+        digits_  = digits;
+        return true;
+    }
+
+protected:
+    static constexpr float LIMIT = 0.78539816f; // π/4
+
+    float term(int n) const override {
+        const float sign = (n % 2 == 0) ? 1.0f : -1.0f;
+        return sign / (2.0f * static_cast<float>(n) + 1.0f);
+    }
+
+    // Convergence limit line at π/4
+    bool limit(const std::vector<float>& /*sums*/, float& value) const override {
+        value = LIMIT;
+        return true;
+    }
 
-        std::vector<Vertex> quads;
-        quads.reserve(static_cast<size_t>(visible * 6));
-        std::vector<Vertex> sumLine;
-        sumLine.reserve(static_cast<size_t>(visible));
+private:
+    static constexpr int           kHalfBits       = 20;     // per position param
+    static constexpr int           kMaxDigits      = 256;
+    static constexpr int           kColumns        = 16;
+    static constexpr std::uint64_t kMinTermsPerRun = 1024;   // also the first run
+    static constexpr std::uint64_t kMaxTermsPerRun = std::uint64_t{1} << 18;
 
-        float partialSum = 0.0f;
+    bool          started_ = false;
+    std::uint64_t pos_     = 0;     // digits skipped
+    int           count_   = 0;
+    int           step_    = 0;     // exact digits per extraction
+    std::string   digits_;          // extracted so far, whole extractions
+    std::uint64_t partial_ = 0;     // terms of the extraction under way, mod 2⁶⁴
+    std::uint64_t next_k_  = 0;     // its next term
+    std::uint64_t terms_   = 0;     // BBP terms evaluated
+    double        rate_    = 0.0;   // terms per second of the last slice
+    TaskScheduler::TaskId task_ = 0;
 
-        for (int n = 0; n < visible; ++n) {
-            float sign = (n % 2 == 0) ? 1.0f : -1.0f;
-            float term = sign / (2.0f * static_cast<float>(n) + 1.0f);
-            partialSum += term;
+    mutable std::mutex readout_mutex_;   // the front end reads while frames render
+    std::string        readout_ = "null";
 
-            const float alpha =
-                std::clamp(revealed - static_cast<float>(n), 0.0f, 1.0f);
+    /// The digit position from its halves, up to BbpPi::kMaxPosition.
+    [[nodiscard]] std::uint64_t digitPosition() const {
+        const auto half = [this](const char* name, float fallback) {
+            constexpr float kMax = static_cast<float>((1 << kHalfBits) - 1);
+            return static_cast<std::uint64_t>(std::clamp(getParam(name, fallback), 0.0f, kMax));
+        };
+        const std::uint64_t p = half("position_hi", 0.0f) << kHalfBits |
+                                half("position_lo", 1000000.0f);
+        return std::min(p, BbpPi::kMaxPosition);
+    }
 
-            const float x1 = xMin + static_cast<float>(n)     * barW + barGap;
-            const float x2 = xMin + static_cast<float>(n + 1) * barW - barGap;
-            const float bh = (term / scale) * yExt;
+    void startDigits(std::uint64_t position, int count) {
+        if (tasks_) tasks_->cancel(task_);
+        task_    = 0;
+        started_ = true;
+        pos_     = position;
+        count_   = count;
+        step_    = BbpPi::reliableDigits(position + static_cast<std::uint64_t>(count));
+        digits_.clear();
+        partial_ = 0;
+        next_k_  = 0;
+        terms_   = 0;
+        rate_    = 0.0;
+    }
 
-            // Blue for positive, rose for negative
-            float cr{}, cg{}, cb{};
-            if (term >= 0.0f)
-                hsvToRgb(0.60f, 0.60f, 0.65f, cr, cg, cb);
-            else
-                hsvToRgb(0.95f, 0.55f, 0.70f, cr, cg, cb);
+    [[nodiscard]] int shown() const {
+        return std::min(count_, static_cast<int>(digits_.size()));
+    }
 
-            float y1 = yMid;
-            float y2 = yMid + bh;
-            if (y1 > y2) std::swap(y1, y2);
+    void ensureDigits(std::uint64_t position, int count) {
+        if (!started_ || position != pos_ || count != count_) startDigits(position, count);
+        if (shown() >= count_ || (tasks_ && task_ && tasks_->pending(task_))) return;
+        task_ = spawnTask(tasks_, "bbp", extract(), this);
+    }
 
-            addQuad(quads, x1, y1, x2, y2, cr, cg, cb, alpha * 0.85f);
+    /// Terms that fit in `seconds` at the last slice's rate, so a run never
+    /// holds the frame much past its budget whatever the position costs.
+    [[nodiscard]] std::uint64_t termsPerRun(double seconds) const {
+        const double fits = std::min(rate_ * seconds, static_cast<double>(kMaxTermsPerRun));
+        return fits > static_cast<double>(kMinTermsPerRun) ? static_cast<std::uint64_t>(fits)
+                                                           : kMinTermsPerRun;
+    }
 
-            // Running sum polyline (deep amber)
-            const float sx = xMin + (static_cast<float>(n) + 0.5f) * barW;
-            const float sy = yMid + (partialSum / scale) * yExt;
-            sumLine.push_back({sx, sy, 0.80f, 0.50f, 0.05f, alpha});
+    Task extract() {
+        while (shown() < count_) {
+            const std::uint64_t d  = pos_ + digits_.size();
+            const std::uint64_t k1 = std::min(d + 1, next_k_ + termsPerRun(co_await SliceLeft{}));
+            const auto          t0 = std::chrono::steady_clock::now();
+            partial_ += BbpPi::terms(d, next_k_, k1, jobs_);
+            const std::chrono::duration<double> took = std::chrono::steady_clock::now() - t0;
+            rate_    = static_cast<double>(k1 - next_k_) / std::max(took.count(), 1e-9);
+            terms_  += k1 - next_k_;
+            next_k_  = k1;
+            if (next_k_ > d) {
+                digits_ += BbpPi::toHex(partial_ + BbpPi::tail(d), step_);
+                partial_ = 0;
+                next_k_  = 0;
+            }
+            co_await Checkpoint{(static_cast<float>(shown()) +
+                                 static_cast<float>(next_k_) / static_cast<float>(d + 1) *
+                                 static_cast<float>(step_)) / static_cast<float>(count_)};
+        }
+    }
+
+    void renderDigits(IRenderer& gl) {
+        // Clip-space margins — extra left/bottom for axis labels
+        constexpr float mLeft   = 0.14f;
+        constexpr float mRight  = 0.06f;
+        constexpr float mBottom = 0.12f;
+        constexpr float mTop    = 0.08f;
+        constexpr float gridBottom = -0.05f;   // cells above, histogram below
+        constexpr float histTop    = -0.20f;
+
+        const float xMin = -1.0f + mLeft;
+        const float xMax =  1.0f - mRight;
+        const float yMin = -1.0f + mBottom;
+        const float yMax =  1.0f - mTop;
+
+        // ── Digit cells, in rows of sixteen ───────────────────────────────
+        const int   rows  = (count_ + kColumns - 1) / kColumns;
+        const float cellW = (xMax - xMin) / kColumns;
+        const float cellH = (yMax - gridBottom) / static_cast<float>(std::max(rows, 4));
+        const int   done  = shown();
+        const float under = static_cast<float>(next_k_) /
+                            static_cast<float>(pos_ + digits_.size() + 1);   // extraction under way
+        std::array<int, 16> histogram{};
+        std::vector<Vertex> cells;
+        for (int i = 0; i < count_; ++i) {
+            const float x = xMin + cellW * static_cast<float>(i % kColumns);
+            const float y = yMax - cellH * static_cast<float>(i / kColumns + 1);
+            if (i < done) {
+                const int v = hexValue(digits_[static_cast<std::size_t>(i)]);
+                ++histogram[static_cast<std::size_t>(v)];
+                float r{}, g{}, b{};
+                hsvToRgb(static_cast<float>(v) / 16.0f, 0.45f, 0.90f, r, g, b);
+                addQuad(cells, x + 0.002f, y + 0.002f, x + cellW - 0.002f, y + cellH - 0.002f,
+                        r, g, b, 1.0f);
+            } else {
+                addQuad(cells, x + 0.002f, y + 0.002f, x + cellW - 0.002f, y + cellH - 0.002f,
+                        0.86f, 0.84f, 0.82f, 1.0f);
+                if (i < done + step_)
+                    addQuad(cells, x + 0.002f, y + 0.002f, x + 0.002f + (cellW - 0.004f) * under,
+                            y + 0.012f, 0.80f, 0.50f, 0.05f, 1.0f);
+            }
+        }
+
+        // ── Histogram of the digits, against the uniform count ─────────────
+        const int   most    = *std::max_element(histogram.begin(), histogram.end());
+        const float expect  = static_cast<float>(done) / 16.0f;
+        const float top     = std::max({static_cast<float>(most), 2.0f * expect, 1.0f});
+        const float barW    = (xMax - xMin) / 16.0f;
+        auto        clipY   = [&](float n) { return yMin + (histTop - yMin) * n / top; };
+        std::vector<Vertex> bars;
+        for (int v = 0; v < 16; ++v) {
+            float r{}, g{}, b{};
+            hsvToRgb(static_cast<float>(v) / 16.0f, 0.55f, 0.75f, r, g, b);
+            const float x = xMin + barW * static_cast<float>(v);
+            addQuad(bars, x + barW * 0.12f, yMin, x + barW * 0.88f,
+                    clipY(static_cast<float>(histogram[static_cast<std::size_t>(v)])),
+                    r, g, b, 0.9f);
         }
 
-        // ── Axes ────────────────────────────────────────────────────────
         std::vector<Vertex> axes;
-        // Horizontal zero-line
-        axes.push_back({xMin, yMid, 0.30f, 0.28f, 0.26f, 0.8f});
-        axes.push_back({xMax, yMid, 0.30f, 0.28f, 0.26f, 0.8f});
-        // Left vertical axis
-        axes.push_back({xMin, yMid - yExt, 0.30f, 0.28f, 0.26f, 0.8f});
-        axes.push_back({xMin, yMid + yExt, 0.30f, 0.28f, 0.26f, 0.8f});
-
-        // Convergence limit line at π/4
-        if (visible >= terms) {
-            const float limitY = yMid + (LIMIT / scale) * yExt;
-            const float pulse  = 0.5f + 0.5f * std::sin(time * 3.0f);
-            axes.push_back({xMin, limitY,
-                            0.15f, 0.60f, 0.15f, 0.4f + 0.4f * pulse});
-            axes.push_back({xMax, limitY,
-                            0.15f, 0.60f, 0.15f, 0.4f + 0.4f * pulse});
+        axes.push_back({xMin, yMin, 0.30f, 0.28f, 0.26f, 0.8f});
+        axes.push_back({xMax, yMin, 0.30f, 0.28f, 0.26f, 0.8f});
+        axes.push_back({xMin, yMin, 0.30f, 0.28f, 0.26f, 0.8f});
+        axes.push_back({xMin, histTop, 0.30f, 0.28f, 0.26f, 0.8f});
+        if (done > 0) {
+            axes.push_back({xMin, clipY(expect), 0.15f, 0.60f, 0.15f, 0.8f});
+            axes.push_back({xMax, clipY(expect), 0.15f, 0.60f, 0.15f, 0.8f});
         }
 
-        gl.drawLines(grid);
-        gl.drawTriangles(quads);
+        gl.setLayer(0);
+        gl.drawQuads(cells);
+        gl.setLayer(1);
+        gl.drawQuads(bars);
+        gl.setLayer(2);
         gl.drawLines(axes);
-        if (sumLine.size() >= 2) gl.drawLineStrip(sumLine);
+
+        publish(static_cast<int>(top));
+    }
+
+    static int hexValue(char c) { return c <= '9' ? c - '0' : c - 'A' + 10; }
+
+    void publish(int histogramTop) {
+        const std::string json = StatsWriter()
+            .field("position",     pos_)
+            .field("digits",       digits_.substr(0, static_cast<std::size_t>(shown())))
+            .field("count",        count_)
+            .field("step",         step_)
+            .field("histogramTop", histogramTop)
+            .str();
+        std::lock_guard<std::mutex> lock(readout_mutex_);
+        readout_ = json;
     }
 };
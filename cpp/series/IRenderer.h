@@ -0,0 +1,260 @@
+// ─── WizSeries: Renderer Interface ──────────────────────────────────────────
+// Every visualizer emits coloured 2-D clip-space vertices through this
+// interface.  GLRenderer batches them into WebGL 2 / GLES 3 draws;
+// SoftwareRenderer rasterizes the same streams on the CPU for offline export.
+// Backends may also lay out series bars themselves from raw values
+// (drawSeriesData), compute bifurcation diagrams and Lyapunov fractals on
+// the GPU (drawBifurcation, drawLyapunov) and tone-map point histograms
+// themselves (drawDensity).
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// ─── Vertex layout: position (x,y) + colour (r,g,b,a) ──────────────────────
+
+struct Vertex {
+    float x, y;
+    float r, g, b, a;
+};
+
+// Append a screen-aligned quad to a vertex buffer as its four corners
+// (x1,y1) (x2,y1) (x1,y2) (x2,y2), for drawQuads().
+inline void addQuad(std::vector<Vertex>& out,
+                    float x1, float y1, float x2, float y2,
+                    float r, float g, float b, float a = 1.0f) {
+    out.push_back({x1, y1, r, g, b, a});
+    out.push_back({x2, y1, r, g, b, a});
+    out.push_back({x1, y2, r, g, b, a});
+    out.push_back({x2, y2, r, g, b, a});
+}
+
+// Quads are four corners each, drawn as these two triangles.
+inline constexpr std::uint16_t kQuadIndices[6] = {0, 1, 2, 1, 3, 2};
+
+enum class Primitive { Points, Lines, LineStrip, Triangles, Quads };
+
+// ─── Series data draws ──────────────────────────────────────────────────────
+
+/// Bar colours as HSV: hue runs from `hue` to `hue + hueShift` across the
+/// bars; negative terms use the neg* colour instead.
+struct BarPalette {
+    float hue      = 0.0f;
+    float hueShift = 0.0f;
+    float sat      = 0.0f;
+    float val      = 0.0f;
+    float negHue   = 0.0f;
+    float negSat   = 0.0f;
+    float negVal   = 0.0f;
+};
+
+enum class SeriesPart { Bars, SumLine };
+
+/// A fresh SeriesDataDraw::source id.  Ids are never reused, so a backend
+/// caching one owner's values cannot mistake a later owner for it.
+inline std::uint64_t newSeriesDataSource() {
+    static std::atomic<std::uint64_t> next{1};
+    return next.fetch_add(1, std::memory_order_relaxed);
+}
+
+/// One part of a bar plot described by raw values plus layout.  Bar i spans
+/// x ∈ [xMin + i·barW + gap, xMin + (i+1)·barW − gap] and y from `base` to
+/// base + terms[i]·yPerUnit; the sum line visits (xMin + (i+½)·barW,
+/// base + sums[i]·yPerUnit).  Everything drawn has alpha
+/// clamp(reveal − i, 0, 1), times barAlpha for bars.
+struct SeriesDataDraw {
+    std::uint64_t          source   = 0;         // newSeriesDataSource() of the owner
+    std::uint64_t          revision = 0;         // changes when stored values change
+    std::span<const float> terms;                // values appended since the last
+    std::span<const float> sums;                 //   draw are uploaded incrementally
+    SeriesPart             part     = SeriesPart::Bars;
+    int                    first    = 0;         // bars [first, first + count)
+    int                    count    = 0;
+    float                  xMin     = 0.0f;
+    float                  barW     = 0.0f;
+    float                  gap      = 0.0f;
+    float                  base     = 0.0f;
+    float                  yPerUnit = 1.0f;
+    float                  reveal   = 0.0f;
+    float                  barAlpha = 1.0f;
+    BarPalette             palette;
+    float                  sumColour[3] = {0.0f, 0.0f, 0.0f};
+};
+
+// ─── Bifurcation draws ──────────────────────────────────────────────────────
+
+/// A logistic-map bifurcation diagram computed by the backend: column c of
+/// `columns` has r = rMin + (rMax − rMin)·t with t = c/(columns − 1),
+/// iterates x ← r·x·(1 − x) from x = ½ for `warmup` steps, then plots the
+/// next `samples` values at (lerp(xMin, xMax, t), lerp(yMin, yMax, x)) in
+/// HSV colour (hue + hueShift·t, sat, val).
+struct BifurcationDraw {
+    float rMin      = 1.0f;
+    float rMax      = 4.0f;
+    int   columns   = 0;
+    int   visible   = 0;   // draw columns [0, visible)
+    int   warmup    = 0;
+    int   samples   = 0;
+    float xMin      = -1.0f;
+    float xMax      = 1.0f;
+    float yMin      = -1.0f;
+    float yMax      = 1.0f;
+    float hue       = 0.0f;
+    float hueShift  = 0.0f;
+    float sat       = 0.0f;
+    float val       = 0.0f;
+    float alpha     = 1.0f;
+    float pointSize = 1.0f;
+};
+
+// ─── Lyapunov draws ─────────────────────────────────────────────────────────
+
+/// A Markus–Lyapunov fractal computed per pixel by the backend.  The
+/// clip-space rect [xMin, xMax]×[yMin, yMax] (under the view transform) maps
+/// to growth rates a ∈ [aMin, aMax] across and b ∈ [bMin, bMax] up.  From
+/// x = ½ the map x ← r·x·(1 − x) runs with r = b at steps i whose bit
+/// (i mod length) of `pattern` is set and r = a otherwise; after `warmup`
+/// steps, λ is the mean of ln|r·(1 − 2x)| over `iterations` more.  Stable
+/// points (λ ≤ 0) get HSV (stableHue, sat, 0.95 − 0.8·(1 − e^(λ·contrast))),
+/// chaotic ones (chaosHue, sat, 0.6 − 0.5·(1 − e^(−λ·contrast))).
+struct LyapunovDraw {
+    std::uint32_t pattern    = 0b10;   // "AB"
+    int           length     = 2;      // 1–32
+    int           warmup     = 0;
+    int           iterations = 0;
+    int           perFrame   = 0;      // steps per frame when accumulating
+    float         aMin       = 2.0f;
+    float         aMax       = 4.0f;
+    float         bMin       = 2.0f;
+    float         bMax       = 4.0f;
+    float         xMin       = -1.0f;
+    float         xMax       = 1.0f;
+    float         yMin       = -1.0f;
+    float         yMax       = 1.0f;
+    float         stableHue  = 0.0f;
+    float         chaosHue   = 0.0f;
+    float         sat        = 0.0f;
+    float         contrast   = 1.0f;
+
+    bool operator==(const LyapunovDraw&) const = default;
+};
+
+// ─── Density draws ──────────────────────────────────────────────────────────
+
+/// A histogram of `width`×`height` point counts (row-major, row 0 at the
+/// bottom) stretched over the clip-space rect [xMin, xMax]×[yMin, yMax]
+/// under the view transform.  A bin holding c points is tone-mapped to
+/// t = ln(1 + c) / ln(1 + maxCount) and drawn in HSV (hue + hueShift·t, sat,
+/// val) at alpha t; empty bins are not drawn.
+struct DensityDraw {
+    std::uint64_t                  source   = 0;   // newSeriesDataSource() of the owner
+    std::uint64_t                  revision = 0;   // changes when counts change
+    std::span<const std::uint32_t> counts;
+    int                            width    = 0;
+    int                            height   = 0;
+    std::uint32_t                  maxCount = 0;
+    float                          xMin     = -1.0f;
+    float                          xMax     = 1.0f;
+    float                          yMin     = -1.0f;
+    float                          yMax     = 1.0f;
+    float                          hue      = 0.0f;
+    float                          hueShift = 0.0f;
+    float                          sat      = 0.0f;
+    float                          val      = 0.0f;
+};
+
+/// The typed draws (drawSeriesData() and the like) a backend takes, as far
+/// as it can tell without the draw in hand; any of them may still refuse a
+/// particular draw.
+struct TypedDrawSupport {
+    bool seriesData  = false;
+    bool bifurcation = false;
+    bool lyapunov    = false;
+    bool density     = false;
+};
+
+// ─── IRenderer ──────────────────────────────────────────────────────────────
+
+class IRenderer {
+public:
+    virtual ~IRenderer() = default;
+
+    /// Clear the target and prepare for a new frame of `width`×`height` px.
+    virtual void beginFrame(float width, float height) = 0;
+
+    /// Flush any work still queued for the current frame.
+    virtual void endFrame() {}
+
+    /// Horizontal pan/zoom applied to every vertex:  x' = x·scale + offset.
+    void setView(float scale, float offset) {
+        view_scale_  = scale;
+        view_offset_ = offset;
+    }
+
+    [[nodiscard]] float viewScale()  const { return view_scale_; }
+    [[nodiscard]] float viewOffset() const { return view_offset_; }
+
+    /// Tag the following draws with `layer`.  Layers are drawn in the order
+    /// they are submitted; within a run of draws in one layer, a batching
+    /// backend may merge draws of the same primitive into the first of them,
+    /// so they must not depend on each other's order.  Only changes of the
+    /// value matter.
+    void setLayer(int layer) { layer_ = layer; }
+
+    [[nodiscard]] int layer() const { return layer_; }
+
+    /// Primitive-agnostic form of the typed helpers below.
+    void submit(Primitive mode, std::span<const Vertex> verts,
+                float pointSize = 1.0f) {
+        if (!verts.empty()) draw(verts, mode, pointSize);
+    }
+
+    void drawPoints(const std::vector<Vertex>& verts, float size = 2.0f) {
+        if (!verts.empty()) draw(verts, Primitive::Points, size);
+    }
+    void drawLines(const std::vector<Vertex>& verts) {
+        if (!verts.empty()) draw(verts, Primitive::Lines, 1.0f);
+    }
+    void drawLineStrip(const std::vector<Vertex>& verts) {
+        if (!verts.empty()) draw(verts, Primitive::LineStrip, 1.0f);
+    }
+    void drawTriangles(const std::vector<Vertex>& verts) {
+        if (!verts.empty()) draw(verts, Primitive::Triangles, 1.0f);
+    }
+    void drawQuads(const std::vector<Vertex>& verts) {
+        if (!verts.empty()) draw(verts, Primitive::Quads, 1.0f);
+    }
+
+    /// Lay out and draw series bars from raw values.  Returns false if the
+    /// backend cannot (the caller then builds the vertices itself).
+    virtual bool drawSeriesData(const SeriesDataDraw& /*d*/) { return false; }
+
+    /// Compute and draw a bifurcation diagram.  Returns false if the backend
+    /// cannot (the caller then iterates the map itself).
+    virtual bool drawBifurcation(const BifurcationDraw& /*d*/) { return false; }
+
+    /// Compute and draw a Lyapunov fractal, possibly refining it over the
+    /// following frames while `d` and the view stay the same.  Returns false
+    /// if the backend cannot (the caller then computes λ itself).
+    virtual bool drawLyapunov(const LyapunovDraw& /*d*/) { return false; }
+
+    /// Tone-map and draw a point histogram.  Returns false if the backend
+    /// cannot (the caller then draws the bins as quads).
+    virtual bool drawDensity(const DensityDraw& /*d*/) { return false; }
+
+    /// Which typed draws to expect this backend to take, for a recorder
+    /// standing in for it on another thread (RecordingRenderer).
+    [[nodiscard]] virtual TypedDrawSupport typedDraws() const { return {}; }
+
+protected:
+    float view_scale_  = 1.0f;
+    float view_offset_ = 0.0f;
+    int   layer_       = 0;
+
+    /// Backend hook: `verts` is never empty; `pointSize` is in pixels.
+    virtual void draw(std::span<const Vertex> verts, Primitive mode,
+                      float pointSize) = 0;
+};
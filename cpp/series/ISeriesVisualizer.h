@@ -1,11 +1,17 @@
 // ─── WizSeries: Abstract base for every series visualizer ───────────────────
 #pragma once
 
-#include "GLRenderer.h"
+#include "IRenderer.h"
+#include "JobSystem.h"
+#include "Snapshot.h"
+#include "Task.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 class ISeriesVisualizer {
 public:
@@ -14,7 +20,7 @@ public:
     /// Called once per frame.  `time` is seconds since the visualizer became
     /// active; `width`/`height` are the canvas pixel dimensions.
     virtual void render(float time, float width, float height,
-                        GLRenderer& gl) = 0;
+                        IRenderer& gl) = 0;
 
     /// Set a named parameter (e.g. "depth", "ratio").
     virtual void setParam(const std::string& name, float value) {
@@ -28,8 +34,56 @@ public:
         return it != params_.end() ? it->second : defaultVal;
     }
 
+    /// Job system for parallel compute (owned by SeriesManager or the tool
+    /// driving the visualizer).  May be null: work then runs inline.
+    void attachJobs(JobSystem* jobs) { jobs_ = jobs; }
+
+    /// Scheduler for computations spread over several frames.  May be null:
+    /// tasks then run to completion when spawned.
+    void attachTasks(TaskScheduler* tasks) { tasks_ = tasks; }
+
+    /// Every parameter currently set (for snapshots).
+    [[nodiscard]] const std::unordered_map<std::string, float>& params() const {
+        return params_;
+    }
+
+    /// Per-stage recompute report for getStats() as a JSON value
+    /// (see Dataflow.h); "null" for visualizers without a stage graph.
+    [[nodiscard]] virtual std::string dataflowJson() const { return "null"; }
+
+    /// Positive y extent of the last rendered plot, for axis labels drawn by
+    /// the front end; 0 for visualizers without an autoscaled y axis.
+    [[nodiscard]] virtual float plotYScale() const { return 0.0f; }
+
+    /// Computed values the front end labels the plot with (e.g. a limit to
+    /// more digits than a float holds) as a JSON object; "null" for none.
+    /// May be called while a frame renders on another thread.
+    [[nodiscard]] virtual std::string plotReadout() const { return "null"; }
+
+    /// Points binned so far and the rate of the latest refinement step.
+    struct PointStats {
+        std::uint64_t points    = 0;
+        double        perSecond = 0.0;
+    };
+
+    /// Progress of a point-density visualizer (chaos game, attractors) for
+    /// getStats(); zero for the others.  Reads state render() and tasks
+    /// write, so unlike plotReadout() it must not race a frame: pipelined
+    /// frames copy it when their production ends.
+    [[nodiscard]] virtual PointStats pointStats() const { return {}; }
+
+    /// Append expensive computed state (e.g. attractor samples) to a
+    /// snapshot.  Visualizers without caches write nothing.
+    virtual void saveCache(BlobWriter& /*out*/) const {}
+
+    /// Restore what saveCache() wrote.  Returning false just means the
+    /// visualizer recomputes on its next frame.
+    virtual bool loadCache(BlobReader& in) { return in.atEnd(); }
+
 protected:
     std::unordered_map<std::string, float> params_;
+    JobSystem*     jobs_  = nullptr;
+    TaskScheduler* tasks_ = nullptr;
 
     // ── Colour helpers ──────────────────────────────────────────────────────
 
@@ -52,4 +106,39 @@ protected:
             case 5: r = v; g = p; b = q; break;
         }
     }
+
+    /// Draw a point histogram through the backend, or else as quads: one
+    /// per run of bins in a row whose tone rounds to the same of 64 levels.
+    static void drawDensity(IRenderer& gl, const DensityDraw& d) {
+        if (d.maxCount == 0 || gl.drawDensity(d)) return;
+        constexpr int kLevels = 64;
+        const float norm = 1.0f / std::log1p(static_cast<float>(d.maxCount));
+        const float bw   = (d.xMax - d.xMin) / static_cast<float>(d.width);
+        const float bh   = (d.yMax - d.yMin) / static_cast<float>(d.height);
+        auto level = [&](std::uint32_t c) {
+            if (!c) return 0;
+            const float t = std::log1p(static_cast<float>(c)) * norm;
+            return std::max(1, static_cast<int>(std::lround(t * kLevels)));
+        };
+
+        std::vector<Vertex> quads;
+        for (int row = 0; row < d.height; ++row) {
+            const std::uint32_t* counts = &d.counts[static_cast<std::size_t>(row) * d.width];
+            const float          y1     = d.yMin + bh * static_cast<float>(row);
+            for (int x = 0; x < d.width;) {
+                const int l = level(counts[x]);
+                int end = x + 1;
+                while (end < d.width && level(counts[end]) == l) ++end;
+                if (l) {
+                    const float t = static_cast<float>(l) / kLevels;
+                    float cr{}, cg{}, cb{};
+                    hsvToRgb(d.hue + d.hueShift * t, d.sat, d.val, cr, cg, cb);
+                    addQuad(quads, d.xMin + bw * static_cast<float>(x), y1,
+                            d.xMin + bw * static_cast<float>(end), y1 + bh, cr, cg, cb, t);
+                }
+                x = end;
+            }
+        }
+        gl.drawQuads(quads);
+    }
 };
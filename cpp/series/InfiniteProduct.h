@@ -0,0 +1,160 @@
+// ─── WizSeries: Infinite Products ───────────────────────────────────────────
+// The factors of three classical products, as their natural logarithms so a
+// partial product is the exponential of a (compensated) sum and stays in
+// range however many factors it takes:
+//
+//   Wallis   Π 4n²/(4n² − 1),             n ≥ 1        = π/2
+//   Viète    Π 2/cₙ, c₁ = √2, cₙ = √(2 + cₙ₋₁)          = π/2
+//   Euler    Π 1/(1 − p⁻ˢ) over the primes p            = ζ(s), s > 1
+//
+// Viète's product is usually written 2/π = √2/2 · √(2 + √2)/2 · …; its
+// reciprocal is taken so all three head for a limit above 1.  The radicals
+// run as the pair (cₙ, 2 − cₙ), the second by dₙ = dₙ₋₁/(2 + cₙ), so the
+// factors near 1 keep every bit their logarithm needs instead of cancelling
+// in 2 − cₙ.  The Euler factors come from a segmented sieve (PrimeSieve.h).
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include "PrimeSieve.h"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <optional>
+#include <span>
+#include <vector>
+
+enum class ProductKind {
+    Wallis,   // Π 4n²/(4n² − 1)   → π/2
+    Viete,    // Π 2/cₙ            → π/2
+    Euler,    // Π 1/(1 − p⁻ˢ)     → ζ(s)
+};
+
+/// ln of Wallis factor n ≥ 1, without the rounding of 4n²/(4n² − 1) to 1.
+inline double wallisLogFactor(std::uint64_t n) {
+    const auto nd = static_cast<double>(n);
+    return -std::log1p(-1.0 / (4.0 * nd * nd));
+}
+
+/// ζ(s) for real s > 1, by Euler–Maclaurin summation from N = 16 (to a few
+/// ulps for 1 < s ≤ 8).
+inline double riemannZeta(double s) {
+    constexpr int    N = 16;
+    constexpr double kBernoulli[] = {   // B₂ⱼ/(2j)! for j = 1 … 5
+                                     1.0 / 12.0, -1.0 / 720.0, 1.0 / 30240.0,
+                                     -1.0 / 1209600.0, 1.0 / 47900160.0};
+    double sum = 0.0;
+    for (int k = N - 1; k >= 1; --k) sum += std::pow(static_cast<double>(k), -s);
+    sum += std::pow(N, 1.0 - s) / (s - 1.0) + 0.5 * std::pow(N, -s);
+    double rising = s;                       // s(s + 1) … (s + 2j − 2)
+    double power  = std::pow(N, -s - 1.0);   // N^(−s − 2j + 1)
+    for (int j = 0; j < 5; ++j) {
+        sum    += kBernoulli[j] * rising * power;
+        rising *= (s + 2.0 * j + 1.0) * (s + 2.0 * j + 2.0);
+        power  /= N * N;
+    }
+    return sum;
+}
+
+/// Limit of the product, or NaN when it diverges (Euler at s ≤ 1).
+inline double productLimit(ProductKind kind, double s = 2.0) {
+    if (kind != ProductKind::Euler) return std::numbers::pi / 2.0;
+    return s > 1.0 ? riemannZeta(s) : std::numeric_limits<double>::quiet_NaN();
+}
+
+// ─── ProductStream ──────────────────────────────────────────────────────────
+// The log factors of one product in order, with their running sum in
+// double by Knuth's TwoSum — the exact log of the partial product, where the
+// plot only keeps floats.  Viète's factors need the ones before them and
+// Euler's the primes before them, so the stream holds O(1) state plus, for
+// Euler's alone, the sieve's segment; every kCheckpoint factors the state is
+// saved, and seek() goes back by replaying from the checkpoint before it.
+
+class ProductStream {
+public:
+    static constexpr std::uint64_t kCheckpoint = std::uint64_t{1} << 16;   // factors apart
+
+    /// `s` is only used by ProductKind::Euler.
+    explicit ProductStream(ProductKind kind = ProductKind::Wallis, double s = 2.0) {
+        reset(kind, s);
+    }
+
+    void reset(ProductKind kind, double s = 2.0) {
+        kind_     = kind;
+        s_        = s;
+        position_ = 0;
+        state_    = {};
+        checkpoints_.clear();
+        if (kind != ProductKind::Euler) sieve_.reset();
+        else if (sieve_)                sieve_->rewind(0);
+        else                            sieve_.emplace();
+    }
+
+    [[nodiscard]] ProductKind kind() const { return kind_; }
+    [[nodiscard]] double s() const { return s_; }
+
+    /// Factors produced so far.
+    [[nodiscard]] std::uint64_t position() const { return position_; }
+
+    /// ln of the product of every factor so far.
+    [[nodiscard]] double logProduct() const { return state_.hi + state_.lo; }
+
+    /// Go back to `factors` factors in, if the stream is further along, and
+    /// return where it now stands.
+    std::uint64_t seek(std::uint64_t factors) {
+        if (factors >= position_) return position_;
+        const std::uint64_t k = factors / kCheckpoint;
+        state_    = checkpoints_[k];
+        position_ = k * kCheckpoint;
+        if (sieve_) sieve_->rewind(position_);
+        while (position_ < factors) next();
+        return position_;
+    }
+
+    /// ln of the next factor.
+    double next() {
+        if (position_ % kCheckpoint == 0 && position_ / kCheckpoint == checkpoints_.size())
+            checkpoints_.push_back(state_);
+        ++position_;
+        double t = 0.0;
+        switch (kind_) {
+            case ProductKind::Wallis:
+                t = wallisLogFactor(position_);
+                break;
+            case ProductKind::Viete:
+                // 2/cₙ = 1/(1 − dₙ/2)
+                state_.c  = std::sqrt(2.0 + state_.c);
+                state_.d /= 2.0 + state_.c;
+                t = -std::log1p(-0.5 * state_.d);
+                break;
+            case ProductKind::Euler:
+                t = -std::log1p(-std::pow(static_cast<double>(sieve_->next()), -s_));
+                break;
+        }
+        const double sum = state_.hi + t;
+        const double bb  = sum - state_.hi;
+        state_.lo += (state_.hi - (sum - bb)) + (t - bb);
+        state_.hi  = sum;
+        return t;
+    }
+
+    void generate(std::span<float> out) {
+        for (float& v : out) v = static_cast<float>(next());
+    }
+
+private:
+    struct State {
+        double c  = 0.0;   // Viète: cₙ
+        double d  = 2.0;   // Viète: 2 − cₙ
+        double hi = 0.0;   // compensated sum of the log factors
+        double lo = 0.0;
+    };
+
+    ProductKind               kind_     = ProductKind::Wallis;
+    double                    s_        = 2.0;
+    std::uint64_t             position_ = 0;
+    State                     state_;
+    std::vector<State>        checkpoints_;   // state every kCheckpoint factors
+    std::optional<PrimeSieve> sieve_;         // Euler's only
+};
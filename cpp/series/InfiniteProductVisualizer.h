@@ -0,0 +1,126 @@
+// ─── WizSeries: Infinite Product Visualizer ─────────────────────────────────
+// Partial products of Wallis's product, Viète's nested radicals or Euler's
+// product over the primes ("product" = 0, 1, 2; InfiniteProduct.h).  Each
+// bar is the natural log of one factor and the line the product so far: the
+// plot is a product-style SeriesPlotVisualizer, so the logs are summed with
+// compensation and exponentiated per point, and long runs get the same
+// grouped bars, cached stages and view-window scaling as any series.
+//
+// The factors stream in order from a ProductStream (Euler's fed by the
+// segmented sieve, "s" the exponent of ζ(s)), so cutting the factor count
+// back only rewinds the stream to its last checkpoint.  The stream also
+// keeps the log of the product in double, which plotReadout() hands to the
+// labels with the distance from the limit.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include "DoubleDouble.h"
+#include "InfiniteProduct.h"
+#include "SeriesPlotVisualizer.h"
+#include "StatsWriter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+
+class InfiniteProductVisualizer : public SeriesPlotVisualizer {
+public:
+    InfiniteProductVisualizer()
+        : SeriesPlotVisualizer({.defaultTerms = 30.0f,
+                                .maxTerms     = kLongSeriesTerms,
+                                .revealRate   = 8.0f,
+                                .palette      = {.hue = 0.10f, .hueShift = -0.06f,
+                                                 .sat = 0.70f, .val = 0.85f},   // amber
+                                .shapeParam   = "s",
+                                .product      = true,
+                                .sumColour    = {0.20f, 0.10f, 0.60f}}) {   // deep indigo
+        params_["product"] = 0.0f;
+        params_["s"]       = 2.0f;
+    }
+
+    void render(float time, float width, float height, IRenderer& gl) override {
+        SeriesPlotVisualizer::render(time, width, height, gl);
+        publish();
+    }
+
+    [[nodiscard]] std::string plotReadout() const override {
+        std::lock_guard<std::mutex> lock(readout_mutex_);
+        return readout_;
+    }
+
+protected:
+    static constexpr float MAX_S = 4.0f;
+
+    // Never called, as streamed() is always true: only here to satisfy the
+    // pure virtual.
+    float term(int /*i*/) const override { return 0.0f; }
+
+    // 0 for Wallis, −1 for Viète, s for Euler
+    float shape() const override {
+        switch (kind()) {
+            case ProductKind::Wallis: return 0.0f;
+            case ProductKind::Viete:  return -1.0f;
+            case ProductKind::Euler:  return std::clamp(getParam("s", 2.0f), 1.0f, MAX_S);
+        }
+        return 0.0f;
+    }
+
+    bool streamed() const override { return true; }
+
+    std::size_t resumeStream(std::size_t valid) override {
+        const double s = shape();
+        if (stream_.kind() != kind() || stream_.s() != s) {
+            stream_.reset(kind(), s);
+            return 0;
+        }
+        return static_cast<std::size_t>(stream_.seek(valid));
+    }
+
+    void streamTerms(std::span<float> out) override { stream_.generate(out); }
+
+    // Always show the limit, when there is one
+    float yScale(const PlotExtent& visible) const override {
+        const double limit = productLimit(kind(), shape());
+        const float  scale = SeriesPlotVisualizer::yScale(visible);
+        return std::isfinite(limit) ? std::max(scale, static_cast<float>(limit) * 1.15f) : scale;
+    }
+
+    // π/2 for Wallis and Viète, ζ(s) for Euler; none when s = 1
+    bool limit(const std::vector<float>& /*sums*/, float& value) const override {
+        const double limit = productLimit(kind(), shape());
+        value = static_cast<float>(limit);
+        return std::isfinite(limit);
+    }
+
+private:
+    ProductStream stream_;
+
+    mutable std::mutex readout_mutex_;   // the front end reads while frames render
+    std::string        readout_ = "null";
+
+    [[nodiscard]] ProductKind kind() const {
+        return static_cast<ProductKind>(
+            std::clamp(static_cast<int>(getParam("product", 0.0f) + 0.5f), 0, 2));
+    }
+
+    void publish() {
+        const double logProduct = stream_.logProduct();
+        const double limit      = productLimit(kind(), shape());
+        StatsWriter  json;
+        json.field("product",    static_cast<int>(kind()))
+            .field("factors",    stream_.position())
+            .field("logProduct", logProduct)
+            .field("value",      DoubleDouble(std::exp(logProduct)).toString(16))
+            .field("s",          static_cast<double>(shape()));
+        if (std::isfinite(limit))
+            json.field("limit",         DoubleDouble(limit).toString(16))
+                .field("relativeError", std::abs(std::expm1(logProduct - std::log(limit))));
+        const std::string text = json.str();
+        std::lock_guard<std::mutex> lock(readout_mutex_);
+        readout_ = text;
+    }
+};
@@ -0,0 +1,371 @@
+// ─── WizSeries: Work-Stealing Job System ────────────────────────────────────
+// One engine-wide scheduler for every parallel compute path.  A fixed pool of
+// workers each owns a Chase–Lev deque per priority: the owner pushes and pops
+// at the bottom (LIFO, cache-warm), idle workers steal from the top (FIFO).
+// Interactive jobs (work the current frame waits on) are always taken before
+// Background jobs (cache fills) anywhere in the pool.
+//
+// The thread that constructs the JobSystem is worker 0: it has its own deques
+// and helps execute jobs while it waits, so fork/join nests without blocking.
+// Other foreign threads submit through a locked injection queue.  With one
+// worker (e.g. a WASM build without pthreads) jobs simply run inline.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+enum class JobPriority { Interactive, Background };
+
+/// Tracks the outstanding jobs of one fork/join group.
+class JobCounter {
+public:
+    [[nodiscard]] bool done() const { return pending_.load(std::memory_order_acquire) == 0; }
+
+private:
+    friend class JobSystem;
+    std::atomic<int> pending_{0};
+};
+
+struct Job {
+    std::function<void()> fn;
+    JobCounter*           counter;
+};
+
+// ─── Chase–Lev deque ────────────────────────────────────────────────────────
+// Lock-free single-owner deque (Chase & Lev 2005, with the C11 memory orders
+// of Lê et al. 2013).  Slots are additionally release/acquire so the job a
+// thief takes is visibly published even to fence-unaware tools (TSan).
+// Retired rings are kept until destruction so a thief holding an old ring
+// pointer never reads freed memory.
+
+class ChaseLevDeque {
+public:
+    ChaseLevDeque() {
+        rings_.push_back(std::make_unique<Ring>(64));
+        ring_ = rings_.back().get();
+    }
+
+    /// Owner only.
+    void push(Job* job) {
+        const std::int64_t b = bottom_.load(std::memory_order_relaxed);
+        const std::int64_t t = top_.load(std::memory_order_acquire);
+        Ring* r = ring_.load(std::memory_order_relaxed);
+        if (b - t > r->capacity - 1) r = grow(r, t, b);
+        r->put(b, job);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+
+    /// Owner only; nullptr when empty.
+    Job* pop() {
+        const std::int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+        Ring* r = ring_.load(std::memory_order_relaxed);
+        bottom_.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t t = top_.load(std::memory_order_relaxed);
+
+        if (t > b) {   // empty
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        Job* job = r->get(b);
+        if (t == b) {  // last element: race thieves for it
+            if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                              std::memory_order_relaxed))
+                job = nullptr;
+            bottom_.store(b + 1, std::memory_order_relaxed);
+        }
+        return job;
+    }
+
+    /// Any thread; nullptr when empty or when another thief won the race.
+    Job* steal() {
+        std::int64_t t = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const std::int64_t b = bottom_.load(std::memory_order_acquire);
+        if (t >= b) return nullptr;
+
+        Job* job = ring_.load(std::memory_order_acquire)->get(t);
+        if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                          std::memory_order_relaxed))
+            return nullptr;
+        return job;
+    }
+
+private:
+    struct Ring {
+        explicit Ring(std::int64_t cap)
+            : capacity(cap),
+              slots(std::make_unique<std::atomic<Job*>[]>(static_cast<size_t>(cap))) {}
+
+        Job* get(std::int64_t i) const {
+            const auto slot = static_cast<size_t>(i & (capacity - 1));
+            return slots[slot].load(std::memory_order_acquire);
+        }
+        void put(std::int64_t i, Job* job) {
+            slots[static_cast<size_t>(i & (capacity - 1))].store(job, std::memory_order_release);
+        }
+
+        std::int64_t                         capacity;   // power of two
+        std::unique_ptr<std::atomic<Job*>[]> slots;
+    };
+
+    alignas(64) std::atomic<std::int64_t> top_{0};
+    alignas(64) std::atomic<std::int64_t> bottom_{0};
+    std::atomic<Ring*>                    ring_{nullptr};
+    std::vector<std::unique_ptr<Ring>>    rings_;   // owner only
+
+    Ring* grow(Ring* old, std::int64_t t, std::int64_t b) {
+        rings_.push_back(std::make_unique<Ring>(old->capacity * 2));
+        Ring* r = rings_.back().get();
+        for (std::int64_t i = t; i < b; ++i) r->put(i, old->get(i));
+        ring_.store(r, std::memory_order_release);
+        return r;
+    }
+};
+
+// ─── JobSystem ──────────────────────────────────────────────────────────────
+
+class JobSystem {
+public:
+    struct Stats {
+        int           workers  = 0;
+        std::uint64_t executed = 0;
+        std::uint64_t steals   = 0;
+    };
+
+    /// `threads` is the pool size including the constructing thread;
+    /// ≤ 0 picks the hardware concurrency (navigator.hardwareConcurrency
+    /// under Emscripten pthreads, 1 in a single-threaded WASM build).
+    explicit JobSystem(int threads = 0)
+        : owner_(std::this_thread::get_id()),
+          worker_count_(threads > 0 ? threads : defaultThreadCount()),
+          workers_(std::make_unique<Worker[]>(static_cast<size_t>(worker_count_))) {
+        threads_.reserve(static_cast<size_t>(worker_count_ - 1));
+        for (int i = 1; i < worker_count_; ++i)
+            threads_.emplace_back([this, i] { workerLoop(i); });
+    }
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    ~JobSystem() {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            stop_.store(true);
+        }
+        sleep_cv_.notify_all();
+        for (auto& t : threads_) t.join();
+        // Fire-and-forget jobs that never ran are dropped.
+        for (int p = 0; p < kPriorities; ++p) {
+            for (int w = 0; w < worker_count_; ++w)
+                while (Job* job = workers_[w].deques[p].pop()) delete job;
+            for (Job* job : inject_[p]) delete job;
+        }
+    }
+
+    [[nodiscard]] int workerCount() const { return worker_count_; }
+
+    [[nodiscard]] Stats stats() const {
+        return {worker_count_, executed_.load(std::memory_order_relaxed),
+                steals_.load(std::memory_order_relaxed)};
+    }
+
+    /// Queue `fn`.  If `counter` is given it is incremented now and
+    /// decremented when `fn` returns, for use with wait().
+    void submit(std::function<void()> fn, JobCounter* counter = nullptr,
+                JobPriority priority = JobPriority::Interactive) {
+        if (counter) counter->pending_.fetch_add(1, std::memory_order_relaxed);
+        if (worker_count_ == 1) {
+            execute(new Job{std::move(fn), counter});
+            return;
+        }
+
+        Job* job = new Job{std::move(fn), counter};
+        const int p    = static_cast<int>(priority);
+        const int self = selfIndex();
+        if (self >= 0) {
+            workers_[self].deques[p].push(job);
+        } else {
+            std::lock_guard<std::mutex> lock(inject_mutex_);
+            inject_[p].push_back(job);
+            inject_size_[p].fetch_add(1);
+        }
+        queued_.fetch_add(1);
+        if (sleepers_.load() > 0) {
+            { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+            sleep_cv_.notify_one();
+        }
+    }
+
+    /// Block until every job counted by `counter` has finished, executing
+    /// other queued jobs meanwhile.
+    void wait(const JobCounter& counter) {
+        waitUntil([&counter] { return counter.done(); });
+    }
+
+    /// Block until `ready()` returns true, executing queued jobs meanwhile
+    /// (e.g. a fence flag set by the last job of a chain).
+    template <typename Pred>
+    void waitUntil(Pred&& ready) {
+        const int self = selfIndex();
+        while (!ready()) {
+            if (Job* job = findJob(self)) execute(job);
+            else std::this_thread::yield();
+        }
+    }
+
+    /// Run fn(lo, hi) over sub-ranges of [begin, end) of at least `grain`
+    /// items, on up to ~4 chunks per worker, and wait for all of them.
+    template <typename Fn>
+    void parallelFor(std::size_t begin, std::size_t end, std::size_t grain, Fn&& fn,
+                     JobPriority priority = JobPriority::Interactive) {
+        if (end <= begin) return;
+        const std::size_t n = end - begin;
+        grain = std::max<std::size_t>(grain, 1);
+        const std::size_t chunks =
+            std::min((n + grain - 1) / grain, static_cast<std::size_t>(worker_count_) * 4);
+        if (chunks <= 1 || worker_count_ == 1) {
+            fn(begin, end);
+            return;
+        }
+
+        JobCounter done;
+        const std::size_t step = n / chunks, extra = n % chunks;
+        std::size_t lo = begin;
+        for (std::size_t c = 0; c + 1 < chunks; ++c) {
+            const std::size_t hi = lo + step + (c < extra ? 1 : 0);
+            submit([&fn, lo, hi] { fn(lo, hi); }, &done, priority);
+            lo = hi;
+        }
+        fn(lo, end);   // the last chunk runs on the calling thread
+        wait(done);
+    }
+
+    /// Fork/join: run `a` as a job and `b` inline, then wait for both.
+    template <typename A, typename B>
+    void fork(A&& a, B&& b, JobPriority priority = JobPriority::Interactive) {
+        JobCounter done;
+        submit([&a] { a(); }, &done, priority);
+        b();
+        wait(done);
+    }
+
+private:
+    static constexpr int kPriorities = 2;
+
+    struct Worker {
+        ChaseLevDeque deques[kPriorities];
+    };
+
+    static inline thread_local const JobSystem* tls_system_ = nullptr;
+    static inline thread_local int              tls_index_  = -1;
+
+    std::thread::id             owner_;
+    int                         worker_count_;
+    std::unique_ptr<Worker[]>   workers_;
+    std::vector<std::thread>    threads_;
+
+    std::mutex                  inject_mutex_;
+    std::deque<Job*>            inject_[kPriorities];
+    std::atomic<int>            inject_size_[kPriorities] = {};
+
+    std::mutex                  sleep_mutex_;
+    std::condition_variable     sleep_cv_;
+    std::atomic<int>            sleepers_{0};
+    std::atomic<std::int64_t>   queued_{0};
+    std::atomic<bool>           stop_{false};
+
+    std::atomic<std::uint64_t>  executed_{0};
+    std::atomic<std::uint64_t>  steals_{0};
+
+    static int defaultThreadCount() {
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+        return 1;
+#else
+        return static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+#endif
+    }
+
+    /// Worker index of the calling thread, or -1 for a foreign thread.
+    [[nodiscard]] int selfIndex() const {
+        if (tls_system_ == this) return tls_index_;
+        return std::this_thread::get_id() == owner_ ? 0 : -1;
+    }
+
+    void workerLoop(int index) {
+        tls_system_ = this;
+        tls_index_  = index;
+        while (!stop_.load(std::memory_order_relaxed)) {
+            if (Job* job = findJob(index)) {
+                execute(job);
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            sleepers_.fetch_add(1);
+            sleep_cv_.wait(lock, [this] { return stop_.load() || queued_.load() > 0; });
+            sleepers_.fetch_sub(1);
+        }
+    }
+
+    /// Highest-priority job available to `self`: own deque, then the
+    /// injection queue, then a steal from any other worker.
+    Job* findJob(int self) {
+        for (int p = 0; p < kPriorities; ++p) {
+            if (self >= 0)
+                if (Job* job = workers_[self].deques[p].pop()) return take(job);
+
+            if (inject_size_[p].load(std::memory_order_relaxed) > 0) {
+                std::lock_guard<std::mutex> lock(inject_mutex_);
+                if (!inject_[p].empty()) {
+                    Job* job = inject_[p].front();
+                    inject_[p].pop_front();
+                    inject_size_[p].fetch_sub(1);
+                    return take(job);
+                }
+            }
+
+            const int start = self >= 0 ? self + 1 : 0;
+            for (int k = 0; k < worker_count_; ++k) {
+                const int victim = (start + k) % worker_count_;
+                if (victim == self) continue;
+                if (Job* job = workers_[victim].deques[p].steal()) {
+                    steals_.fetch_add(1, std::memory_order_relaxed);
+                    return take(job);
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    Job* take(Job* job) {
+        queued_.fetch_sub(1);
+        return job;
+    }
+
+    void execute(Job* job) {
+        job->fn();
+        if (job->counter) job->counter->pending_.fetch_sub(1, std::memory_order_release);
+        delete job;
+        executed_.fetch_add(1, std::memory_order_relaxed);
+    }
+};
+
+/// parallelFor on `jobs`, or a plain loop when no job system is attached.
+template <typename Fn>
+void parallelFor(JobSystem* jobs, std::size_t begin, std::size_t end, std::size_t grain,
+                 Fn&& fn, JobPriority priority = JobPriority::Interactive) {
+    if (jobs) jobs->parallelFor(begin, end, grain, std::forward<Fn>(fn), priority);
+    else if (begin < end) fn(begin, end);
+}
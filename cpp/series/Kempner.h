@@ -0,0 +1,385 @@
+// ─── WizSeries: Kempner Series ──────────────────────────────────────────────
+// Σ 1/n over the n whose decimal digits avoid a given string — "9" in
+// Kempner's original.  Unlike the harmonic series it converges, since the
+// allowed numbers of j digits thin out geometrically, but so slowly that
+// summing term by term is hopeless: without a 9, the terms below 10³⁰ still
+// fall short of the limit 22.9206766… by almost 1.
+//
+// KempnerSum evaluates the limit by Baillie's digit recurrence, in the form
+// Schmelzer and Baillie gave for excluded strings.  An automaton tracks how
+// much of the string the digits read so far end with (DigitAutomaton), and
+// s_k(j, i) sums n^−k over the allowed j-digit n that leave it in state i.
+// Appending a digit d to n gives
+//
+//   1/(10n + d)^k = Σ_w (−1)^w C(k+w−1, w) d^w / (10n)^(k+w),
+//
+// so the power sums of each level are one fixed linear map M of those of
+// the level before — needing fewer powers as n grows, since the series in
+// w converges like (d / 10n)^w.  Numbers of up to three digits are summed
+// directly, the levels after them by the recurrence, and everything beyond
+// the last level in closed form as (I − M)^−1 applied to it, solved block by
+// block for decreasing k.  All in double-double: over 20 digits for any
+// string of up to six digits, in well under a millisecond.
+//
+// KempnerDirect sums the same series term by term for contrast, in blocks
+// of 1000 numbers sharing their leading digits: a block costs one walk of
+// the automaton plus the allowed last three digits from the state it ends
+// in, summed two doubles at a time.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include "DoubleDouble.h"
+#include "JobSystem.h"
+#include "PartialSumScan.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// Matching automaton for a string of decimal digits (Knuth–Morris–Pratt):
+/// state i < length() means the digits so far end with its first i
+/// characters and nowhere contain it; state length() means they do.
+class DigitAutomaton {
+public:
+    static constexpr int kMaxLength = 6;
+
+    /// `pattern` is clamped to kMaxLength digits; non-digits are dropped,
+    /// and an empty pattern excludes 9.
+    explicit DigitAutomaton(std::string_view pattern = "9") {
+        for (const char c : pattern)
+            if (c >= '0' && c <= '9' && static_cast<int>(pattern_.size()) < kMaxLength)
+                pattern_ += c;
+        if (pattern_.empty()) pattern_ = "9";
+
+        const int m = length();
+        next_.assign(static_cast<std::size_t>(m), {});
+        int fallback = 0;   // state of the pattern minus its first digit
+        for (int i = 0; i < m; ++i) {
+            const int match = pattern_[static_cast<std::size_t>(i)] - '0';
+            for (int d = 0; d < 10; ++d) next_[i][d] = i ? next_[fallback][d] : 0;
+            next_[i][match] = i + 1;
+            if (i) fallback = next_[fallback][match];
+        }
+    }
+
+    /// The digits of `value`, zero-padded to `width`.
+    static std::string digits(std::uint32_t value, int width) {
+        std::string s = std::to_string(value);
+        if (static_cast<int>(s.size()) < width)
+            s.insert(0, static_cast<std::size_t>(width) - s.size(), '0');
+        return s;
+    }
+
+    [[nodiscard]] const std::string& pattern() const { return pattern_; }
+    [[nodiscard]] int                length()  const { return static_cast<int>(pattern_.size()); }
+
+    [[nodiscard]] int next(int state, int digit) const { return next_[state][digit]; }
+
+    /// State after reading the digits of `n` from `state`.
+    [[nodiscard]] int walk(int state, std::uint64_t n) const {
+        char buf[20];
+        int  len = 0;
+        do {
+            buf[len++] = static_cast<char>(n % 10);
+            n /= 10;
+        } while (n);
+        while (len-- && state < length()) state = next_[state][buf[len]];
+        return state;
+    }
+
+private:
+    std::string                     pattern_;
+    std::vector<std::array<int, 10>> next_;
+};
+
+class KempnerSum {
+public:
+    static constexpr int kMaxPowers    = 16;
+    static constexpr int kDirectDigits = 3;   // levels summed term by term
+
+    /// The limit, and the partial sums below 10^j for j up to `decades`.
+    KempnerSum(const DigitAutomaton& automaton, int decades)
+        : m_(automaton.length()) {
+        const int last = std::max(decades, kDirectDigits);
+        digitPowers(automaton);
+        decades_.assign(static_cast<std::size_t>(last) + 1, 0.0);
+
+        // Levels 1 … 3 directly; level 3 with every power the recurrence uses.
+        std::vector<DoubleDouble> level(static_cast<std::size_t>(powers(kDirectDigits) * m_));
+        DoubleDouble below = 0.0;   // sum over the levels before `level`
+        DoubleDouble total = 0.0;
+        int          digits = 1;
+        for (std::uint64_t n = 1; n < 1000; ++n) {
+            if (n == 10 || n == 100) {
+                decades_[static_cast<std::size_t>(digits++)] = static_cast<double>(total);
+                below = total;
+            }
+            const int state = automaton.walk(0, n);
+            if (state == m_) continue;
+            const DoubleDouble inv = DoubleDouble(1.0) / DoubleDouble(static_cast<double>(n));
+            total += inv;
+            if (digits < kDirectDigits) continue;
+            DoubleDouble pw = inv;
+            for (int k = 1; k <= powers(kDirectDigits); ++k, pw *= inv) at(level, k, state) += pw;
+        }
+        decades_[kDirectDigits] = static_cast<double>(total);
+
+        // Levels 4 … last by the recurrence, then the tail after `last`.
+        std::vector<DoubleDouble> next;
+        for (int j = kDirectDigits; j < last; ++j) {
+            below = total;
+            step(level, powers(j), next, powers(j + 1));
+            level.swap(next);
+            for (int i = 0; i < m_; ++i) total += at(level, 1, i);
+            decades_[static_cast<std::size_t>(j) + 1] = static_cast<double>(total);
+        }
+        limit_ = below + tail(level, powers(last));
+    }
+
+    /// The sum of the series.
+    [[nodiscard]] DoubleDouble limit() const { return limit_; }
+
+    /// Partial sums over n < 10^j, j = 0 … decades.
+    [[nodiscard]] const std::vector<double>& decades() const { return decades_; }
+
+private:
+    int                 m_;
+    DoubleDouble        limit_;
+    std::vector<double> decades_;
+    std::vector<double> digit_powers_;   // [w][i][l]: Σ d^w over digits d taking i to l
+
+    /// Powers of n kept at level j: the series in w is cut where its terms,
+    /// at most (0.9 · 10^(1−j))^w, drop below 10⁻²⁴ of the first.
+    static int powers(int j) { return std::min(kMaxPowers, 2 + 24 / std::max(j - 1, 1)); }
+
+    DoubleDouble& at(std::vector<DoubleDouble>& v, int k, int i) const {
+        return v[static_cast<std::size_t>((k - 1) * m_ + i)];
+    }
+
+    [[nodiscard]] double digitPower(int w, int i, int l) const {
+        return digit_powers_[static_cast<std::size_t>((w * m_ + i) * m_ + l)];
+    }
+
+    void digitPowers(const DigitAutomaton& automaton) {
+        digit_powers_.assign(static_cast<std::size_t>(kMaxPowers * m_ * m_), 0.0);
+        for (int i = 0; i < m_; ++i)
+            for (int d = 0; d < 10; ++d) {
+                const int l = automaton.next(i, d);
+                if (l == m_) continue;
+                double pw = 1.0;   // d^w, exact: 9^15 < 2^53
+                for (int w = 0; w < kMaxPowers; ++w, pw *= d)
+                    digit_powers_[static_cast<std::size_t>((w * m_ + i) * m_ + l)] += pw;
+            }
+    }
+
+    /// (−1)^w C(k+w−1, w) / 10^(k+w): weight of s_(k+w) in the next s_k.
+    static DoubleDouble weight(int k, int w) {
+        double binom = 1.0;
+        for (int t = 1; t <= w; ++t) binom = binom * (k + t - 1) / t;
+        double tens = 1.0;   // exact up to 10²²
+        for (int t = 0; t < k + w; ++t) tens *= 10.0;
+        const DoubleDouble c = DoubleDouble(binom) / DoubleDouble(tens);
+        return w % 2 ? -c : c;
+    }
+
+    /// Σ_w weight(k, w) Σ_i D_w(i, l) u_(k+w)(i) for w in [first, p − k].
+    DoubleDouble mapped(const std::vector<DoubleDouble>& u, int p, int k, int l,
+                        int first) const {
+        DoubleDouble acc = 0.0;
+        for (int w = first; k + w <= p; ++w) {
+            DoubleDouble inner = 0.0;
+            for (int i = 0; i < m_; ++i)
+                if (const double dp = digitPower(w, i, l))
+                    inner += DoubleDouble(dp) * u[static_cast<std::size_t>((k + w - 1) * m_ + i)];
+            acc += weight(k, w) * inner;
+        }
+        return acc;
+    }
+
+    /// Power sums of the next level (`q` powers) from `level` (`p` powers).
+    void step(const std::vector<DoubleDouble>& level, int p, std::vector<DoubleDouble>& next,
+              int q) const {
+        next.assign(static_cast<std::size_t>(q * m_), 0.0);
+        for (int k = 1; k <= q; ++k)
+            for (int l = 0; l < m_; ++l) at(next, k, l) = mapped(level, p, k, l, 0);
+    }
+
+    /// Σ over `level` and every level after it of s_1: u = level + M u,
+    /// for k = p … 1 a small linear system (I − D_0ᵀ / 10^k) u_k = rhs.
+    DoubleDouble tail(const std::vector<DoubleDouble>& level, int p) const {
+        std::vector<DoubleDouble> u(level.size());
+        std::vector<DoubleDouble> a(static_cast<std::size_t>(m_ * (m_ + 1)));
+        for (int k = p; k >= 1; --k) {
+            const DoubleDouble diag = weight(k, 0);
+            for (int l = 0; l < m_; ++l) {
+                DoubleDouble* row = &a[static_cast<std::size_t>(l * (m_ + 1))];
+                for (int i = 0; i < m_; ++i)
+                    row[i] = (i == l ? DoubleDouble(1.0) : DoubleDouble(0.0)) -
+                             diag * DoubleDouble(digitPower(0, i, l));
+                row[m_] = level[static_cast<std::size_t>((k - 1) * m_ + l)] +
+                          mapped(u, p, k, l, 1);
+            }
+            solve(a);
+            for (int l = 0; l < m_; ++l)
+                at(u, k, l) = a[static_cast<std::size_t>(l * (m_ + 1) + m_)];
+        }
+        DoubleDouble sum = 0.0;
+        for (int l = 0; l < m_; ++l) sum += at(u, 1, l);
+        return sum;
+    }
+
+    /// Gaussian elimination with partial pivoting on the m×(m+1) augmented
+    /// matrix `a`, leaving the solution in its last column.
+    void solve(std::vector<DoubleDouble>& a) const {
+        const int w  = m_ + 1;
+        auto      el = [&](int r, int c) -> DoubleDouble& {
+            return a[static_cast<std::size_t>(r * w + c)];
+        };
+        for (int c = 0; c < m_; ++c) {
+            int pivot = c;
+            for (int r = c + 1; r < m_; ++r)
+                if (std::abs(el(r, c).hi) > std::abs(el(pivot, c).hi)) pivot = r;
+            for (int t = 0; t < w; ++t) std::swap(el(c, t), el(pivot, t));
+            for (int r = 0; r < m_; ++r) {
+                if (r == c || el(r, c).hi == 0.0) continue;
+                const DoubleDouble f = el(r, c) / el(c, c);
+                for (int t = c; t < w; ++t) el(r, t) -= f * el(c, t);
+            }
+        }
+        for (int r = 0; r < m_; ++r) el(r, m_) /= el(r, r);
+    }
+};
+
+class KempnerDirect {
+public:
+    static constexpr std::uint64_t kBlock            = 1000;   // numbers per block
+    static constexpr int           kSamplesPerDecade = 20;
+
+    struct Sample {
+        double log10n;   // of the last number summed
+        double sum;
+    };
+
+    /// Start over, summing the series of `automaton`.
+    void reset(const DigitAutomaton& automaton) {
+        automaton_ = automaton;
+        const int m = automaton_.length();
+        allowed_.assign(static_cast<std::size_t>(m) * kBlock, 0.0);
+        for (int s = 0; s < m; ++s)
+            for (std::uint64_t r = 0; r < kBlock; ++r) {
+                int state = s;
+                for (const std::uint64_t d : {r / 100, r / 10 % 10, r % 10})
+                    if (state < m) state = automaton_.next(state, static_cast<int>(d));
+                allowed_[s * kBlock + r] = state < m ? 1.0 : 0.0;
+            }
+        blocks_ = 0;
+        terms_  = 0;
+        carry_  = {};
+        samples_.clear();
+        next_sample_ = 0;
+    }
+
+    /// Continue from a snapshot of `blocks` blocks summed.
+    void restore(std::uint64_t blocks, std::uint64_t terms, const ScanCarry& carry,
+                 std::span<const Sample> samples) {
+        blocks_  = blocks;
+        terms_   = terms;
+        carry_   = carry;
+        samples_.assign(samples.begin(), samples.end());
+        next_sample_ = samples_.empty()
+            ? 0 : static_cast<int>(std::floor(samples_.back().log10n * kSamplesPerDecade)) + 1;
+    }
+
+    /// Sum `blocks` more blocks of kBlock numbers.
+    void run(std::uint64_t blocks, JobSystem* jobs) {
+        block_sums_.resize(blocks);
+        block_terms_.resize(blocks);
+        const std::uint64_t first = blocks_;
+        parallelFor(jobs, 0, blocks, 16, [&](std::size_t lo, std::size_t hi) {
+            for (std::size_t b = lo; b < hi; ++b)
+                sumBlock(first + b, block_sums_[b], block_terms_[b]);
+        });
+        for (std::uint64_t b = 0; b < blocks; ++b) {
+            if (first + b == 0) {
+                sumFirstBlock();
+                continue;
+            }
+            add(block_sums_[b]);
+            terms_ += block_terms_[b];
+            sampleTo((first + b + 1) * kBlock - 1);
+        }
+        blocks_ += blocks;
+    }
+
+    [[nodiscard]] std::uint64_t              count()     const { return blocks_ * kBlock; }
+    [[nodiscard]] std::uint64_t              blocks()    const { return blocks_; }
+    [[nodiscard]] std::uint64_t              terms()     const { return terms_; }
+    [[nodiscard]] double                     sum()       const { return carry_.sum(); }
+    [[nodiscard]] const ScanCarry&           carry()     const { return carry_; }
+    [[nodiscard]] const std::vector<Sample>& samples()   const { return samples_; }
+    [[nodiscard]] const DigitAutomaton&      automaton() const { return automaton_; }
+
+private:
+    using f64x2 = double __attribute__((vector_size(16)));
+
+    DigitAutomaton             automaton_;
+    std::vector<double>        allowed_;   // [state][last three digits]: 1 or 0
+    std::uint64_t              blocks_ = 0;
+    std::uint64_t              terms_  = 0;
+    ScanCarry                  carry_;
+    std::vector<Sample>        samples_;
+    int                        next_sample_ = 0;   // samples at n ≥ 10^(c / 20)
+    std::vector<double>        block_sums_;
+    std::vector<std::uint32_t> block_terms_;
+
+    void add(double x) {
+        const double s  = carry_.hi + x;   // Knuth TwoSum
+        const double bb = s - carry_.hi;
+        carry_.lo += (carry_.hi - (s - bb)) + (x - bb);
+        carry_.hi  = s;
+    }
+
+    /// Record samples due by number `n`.
+    void sampleTo(std::uint64_t n) {
+        const double x = std::log10(static_cast<double>(n));
+        if (x * kSamplesPerDecade < next_sample_) return;
+        samples_.push_back({x, carry_.sum()});
+        next_sample_ = static_cast<int>(std::floor(x * kSamplesPerDecade)) + 1;
+    }
+
+    /// 1 … 999, where leading zeros are not digits.
+    void sumFirstBlock() {
+        for (std::uint64_t n = 1; n < kBlock; ++n) {
+            if (automaton_.walk(0, n) < automaton_.length()) {
+                add(1.0 / static_cast<double>(n));
+                ++terms_;
+            }
+            sampleTo(n);
+        }
+    }
+
+    /// Numbers 1000q … 1000q + 999 that avoid the pattern (q > 0).
+    void sumBlock(std::uint64_t q, double& sum, std::uint32_t& terms) const {
+        sum   = 0.0;
+        terms = 0;
+        const int state = q ? automaton_.walk(0, q) : automaton_.length();
+        if (state == automaton_.length()) return;
+        const double* mask = &allowed_[static_cast<std::size_t>(state) * kBlock];
+        const f64x2   base = f64x2{0.0, 1.0} + static_cast<double>(q * kBlock);
+        f64x2         acc{};
+        f64x2         hits{};
+        for (std::uint64_t r = 0; r < kBlock; r += 2) {
+            const f64x2 m = {mask[r], mask[r + 1]};
+            acc  += m / (base + static_cast<double>(r));
+            hits += m;
+        }
+        sum   = acc[0] + acc[1];
+        terms = static_cast<std::uint32_t>(hits[0] + hits[1]);
+    }
+};
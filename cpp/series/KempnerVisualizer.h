@@ -0,0 +1,256 @@
+// ─── WizSeries: Kempner Series Visualizer ───────────────────────────────────
+// The harmonic series with every term containing a digit string removed
+// ("exclude", zero-padded to "exclude_width" digits: 9 by default), over
+// log₁₀ n.  Two curves head for the same limit:
+//
+//   decades  the exact partial sums below 10^j from the digit recurrence
+//            (KempnerSum), out to "decades" powers of ten, with the limit
+//            itself to 20 digits;
+//   direct   the sum taken term by term (KempnerDirect) as an incremental
+//            task up to 10^"direct" numbers — a sliver at the left that
+//            shows how far plain summation is from the limit.
+//
+// The direct sums are cached across frames and saved in snapshots;
+// plotReadout() hands the limit and the direct frontier to the labels.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include "ISeriesVisualizer.h"
+#include "Kempner.h"
+#include "StatsWriter.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+class KempnerVisualizer : public ISeriesVisualizer {
+public:
+    KempnerVisualizer() {
+        params_["exclude"]       = 9.0f;
+        params_["exclude_width"] = 1.0f;
+        params_["decades"]       = 40.0f;
+        params_["direct"]        = 9.0f;
+    }
+
+    void render(float /*time*/, float /*width*/, float /*height*/,
+                IRenderer& gl) override {
+        const auto value = static_cast<std::uint32_t>(
+            std::clamp(getParam("exclude", 9.0f), 0.0f, 999999.0f));
+        const int  width = std::clamp(static_cast<int>(getParam("exclude_width", 1.0f)), 1,
+                                      DigitAutomaton::kMaxLength);
+        const int  decades = std::clamp(static_cast<int>(getParam("decades", 40.0f)), 4,
+                                        kMaxDecades);
+        const double direct = std::clamp(getParam("direct", 9.0f), 3.0f, 11.0f);
+
+        const std::string pattern = DigitAutomaton::digits(value, width);
+        if (!sum_ || pattern != pattern_ || decades != decades_) {
+            pattern_ = pattern;
+            decades_ = decades;
+            sum_.emplace(DigitAutomaton(pattern_), decades_);
+        }
+        ensureDirect(static_cast<std::uint64_t>(std::pow(10.0, direct)));
+
+        // Clip-space margins — extra left/bottom for axis labels
+        constexpr float mLeft   = 0.14f;
+        constexpr float mRight  = 0.06f;
+        constexpr float mBottom = 0.12f;
+        constexpr float mTop    = 0.08f;
+
+        const float xMin = -1.0f + mLeft;
+        const float xMax =  1.0f - mRight;
+        const float yMin = -1.0f + mBottom;
+        const float yMax =  1.0f - mTop;
+
+        const double limit = static_cast<double>(sum_->limit());
+        const double step  = niceStep(limit / 4.0);
+        const double top   = step * std::ceil(limit * 1.05 / step);
+        auto clipX = [&](double decade) {
+            return xMin + (xMax - xMin) * static_cast<float>(decade / decades_);
+        };
+        auto clipY = [&](double s) {
+            return yMin + (yMax - yMin) * static_cast<float>(s / top);
+        };
+
+        // ── Grid: sums across, powers of ten down ─────────────────────────
+        std::vector<Vertex> grid;
+        for (double v = step; v < top; v += step) {
+            grid.push_back({xMin, clipY(v), 0.78f, 0.76f, 0.74f, 0.25f});
+            grid.push_back({xMax, clipY(v), 0.78f, 0.76f, 0.74f, 0.25f});
+        }
+        const int tick = decadeTick(decades_);
+        for (int j = tick; j <= decades_; j += tick) {
+            grid.push_back({clipX(j), yMin, 0.78f, 0.76f, 0.74f, 0.18f});
+            grid.push_back({clipX(j), yMax, 0.78f, 0.76f, 0.74f, 0.18f});
+        }
+
+        // ── Axes and the limit ────────────────────────────────────────────
+        std::vector<Vertex> axes;
+        axes.push_back({xMin, yMin, 0.30f, 0.28f, 0.26f, 0.8f});
+        axes.push_back({xMax, yMin, 0.30f, 0.28f, 0.26f, 0.8f});
+        axes.push_back({xMin, yMin, 0.30f, 0.28f, 0.26f, 0.8f});
+        axes.push_back({xMin, yMax, 0.30f, 0.28f, 0.26f, 0.8f});
+        axes.push_back({xMin, clipY(limit), 0.15f, 0.60f, 0.15f, 0.8f});
+        axes.push_back({xMax, clipY(limit), 0.15f, 0.60f, 0.15f, 0.8f});
+
+        // ── Sums below each power of ten, dotted while the dots fit ───────
+        const std::vector<double>& sums = sum_->decades();
+        std::vector<Vertex> curve;
+        std::vector<Vertex> dots;
+        const float r = 0.006f;
+        for (int j = 0; j <= decades_; ++j) {
+            const float x = clipX(j), y = clipY(sums[static_cast<std::size_t>(j)]);
+            curve.push_back({x, y, 0.10f, 0.32f, 0.62f, 0.9f});
+            if (decades_ <= kDottedDecades)
+                addQuad(dots, x - r, y - r, x + r, y + r, 0.10f, 0.32f, 0.62f, 0.9f);
+        }
+
+        // ── Direct summation so far, and where it has got to ──────────────
+        std::vector<Vertex> slow;
+        for (const KempnerDirect::Sample& s : direct_.samples())
+            slow.push_back({clipX(s.log10n), clipY(s.sum), 0.80f, 0.50f, 0.05f, 1.0f});
+        if (!slow.empty()) {
+            const float x = slow.back().x;
+            axes.push_back({x, yMin, 0.80f, 0.50f, 0.05f, 0.6f});
+            axes.push_back({x, slow.back().y, 0.80f, 0.50f, 0.05f, 0.6f});
+        }
+
+        gl.setLayer(0);
+        gl.drawLines(grid);
+        gl.setLayer(1);
+        gl.drawQuads(dots);
+        gl.setLayer(2);
+        gl.drawLines(axes);
+        if (curve.size() >= 2) gl.drawLineStrip(curve);
+        if (slow.size() >= 2) gl.drawLineStrip(slow);
+
+        publish(limit, top);
+    }
+
+    [[nodiscard]] float plotYScale() const override {
+        std::lock_guard<std::mutex> lock(readout_mutex_);
+        return scale_;
+    }
+
+    [[nodiscard]] std::string plotReadout() const override {
+        std::lock_guard<std::mutex> lock(readout_mutex_);
+        return readout_;
+    }
+
+    [[nodiscard]] PointStats pointStats() const override {
+        return {started_ ? direct_.count() : 0, rate_};
+    }
+
+    void saveCache(BlobWriter& out) const override {
+        if (!started_) return;
+        out.putString(direct_.automaton().pattern());
+        out.put(static_cast<std::uint64_t>(direct_.blocks()));
+        out.put(static_cast<std::uint64_t>(direct_.terms()));
+        out.put(direct_.carry().hi);
+        out.put(direct_.carry().lo);
+        out.putArray(std::span<const KempnerDirect::Sample>(direct_.samples()));
+    }
+
+    bool loadCache(BlobReader& in) override {
+        const std::string pattern = in.getString();
+        const auto        blocks  = in.get<std::uint64_t>();
+        const auto        terms   = in.get<std::uint64_t>();
+        ScanCarry         carry;
+        carry.hi = in.get<double>();
+        carry.lo = in.get<double>();
+        std::vector<KempnerDirect::Sample> samples;
+        const DigitAutomaton automaton(pattern);
+        if (!in.getArray(samples) || automaton.pattern() != pattern || terms > blocks * 1000)
+            return false;
+        if (tasks_) tasks_->cancel(task_);
+        task_ = 0;
+        startDirect(automaton);
+        direct_.restore(blocks, terms, carry, samples);
+        return true;
+    }
+
+private:
+    static constexpr int           kMaxDecades    = 10000;
+    static constexpr int           kDottedDecades = 60;
+    static constexpr std::uint64_t kBlocksPerRun  = std::uint64_t{1} << 14;
+
+    std::optional<KempnerSum> sum_;
+    std::string               pattern_;
+    int                       decades_ = 0;
+
+    KempnerDirect         direct_;
+    bool                  started_ = false;
+    std::uint64_t         target_  = 0;     // numbers the task sums up to
+    double                rate_    = 0.0;   // numbers per second of the last run
+    TaskScheduler::TaskId task_    = 0;
+
+    mutable std::mutex readout_mutex_;   // the front end reads while frames render
+    std::string        readout_ = "null";
+    float              scale_   = 0.0f;
+
+    /// 1, 2 or 5 × 10^k, at least `x`.
+    static double niceStep(double x) {
+        const double mag = std::pow(10.0, std::floor(std::log10(std::max(x, 1e-12))));
+        for (const double m : {1.0, 2.0, 5.0})
+            if (m * mag >= x) return m * mag;
+        return 10.0 * mag;
+    }
+
+    /// Decades between labelled gridlines, about ten across.
+    static int decadeTick(int decades) {
+        return std::max(1, static_cast<int>(niceStep(decades / 10.0)));
+    }
+
+    void startDirect(const DigitAutomaton& automaton) {
+        direct_.reset(automaton);
+        started_ = true;
+        target_  = 0;
+        rate_    = 0.0;
+    }
+
+    /// Restart for a new pattern, and keep a task summing up to `target`.
+    void ensureDirect(std::uint64_t target) {
+        if (!started_ || direct_.automaton().pattern() != pattern_) {
+            if (tasks_) tasks_->cancel(task_);
+            task_ = 0;
+            startDirect(DigitAutomaton(pattern_));
+        }
+        target_ = target;
+        if (direct_.count() >= target || (tasks_ && task_ && tasks_->pending(task_))) return;
+        task_ = spawnTask(tasks_, "kempner", accumulate(), this);
+    }
+
+    Task accumulate() {
+        while (direct_.count() < target_) {
+            const auto          t0     = std::chrono::steady_clock::now();
+            const std::uint64_t before = direct_.count();
+            const std::uint64_t left   = (target_ - before + KempnerDirect::kBlock - 1) /
+                                         KempnerDirect::kBlock;
+            direct_.run(std::min(kBlocksPerRun, left), jobs_);
+            const std::chrono::duration<double> took = std::chrono::steady_clock::now() - t0;
+            rate_ = static_cast<double>(direct_.count() - before) / took.count();
+            co_await Checkpoint{static_cast<float>(direct_.count()) /
+                                static_cast<float>(target_)};
+        }
+    }
+
+    void publish(double limit, double top) {
+        const std::string json = StatsWriter()
+            .field("pattern",     pattern_)
+            .field("limit",       sum_->limit().toString(21))
+            .field("limitValue",  limit)
+            .field("decades",     decades_)
+            .field("decadeTick",  decadeTick(decades_))
+            .field("directCount", direct_.count())
+            .field("directTerms", direct_.terms())
+            .field("directSum",   DoubleDouble(direct_.sum()).toString(13))
+            .str();
+        std::lock_guard<std::mutex> lock(readout_mutex_);
+        readout_ = json;
+        scale_   = static_cast<float>(top);
+    }
+};
@@ -1,14 +1,28 @@
 // ─── WizSeries: Logistic Map / Bifurcation Diagram ──────────────────────────
 // Iterates  xₙ₊₁ = r·xₙ·(1 − xₙ)  for a sweep of growth-rate values r and
 // plots the resulting attractor as a cloud of coloured points — the classic
-// bifurcation diagram from chaos theory.
+// bifurcation diagram from chaos theory.  The attractor samples depend only
+// on the r range and column count, so they are cached across frames and
+// saved in snapshots.  Recomputing them is an incremental task: columns
+// appear as they are filled rather than stalling the frame.
+//
+// A backend that iterates the map itself (GLRenderer::drawBifurcation) gets
+// a much denser diagram instead, with no CPU work or uploads at all.
+//
+// The period-doubling points b_n and their accumulation point r∞ (the onset
+// of chaos) are marked where FeigenbaumEngine computed them; the levels are
+// found once, on the first frame, and kept.
 // ─────────────────────────────────────────────────────────────────────────────
 #pragma once
 
+#include "Feigenbaum.h"
 #include "ISeriesVisualizer.h"
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <span>
+#include <utility>
 #include <vector>
 
 class LogisticMapVisualizer : public ISeriesVisualizer {
@@ -16,10 +30,10 @@ public:
     LogisticMapVisualizer() { params_["growth_rate"] = 4.0f; }
 
     void render(float time, float width, float height,
-                GLRenderer& gl) override {
+                IRenderer& gl) override {
         const float rMax =
             std::clamp(getParam("growth_rate", 4.0f), 1.0f, 4.0f);
-        constexpr float rMin = 1.0f;
+        constexpr float rMin = kRMin;
 
         // Extra left/bottom margins for axis labels
         constexpr float mLeft   = 0.14f;
@@ -35,12 +49,9 @@ public:
         // Number of columns scales with canvas pixel width
         int cols = std::clamp(static_cast<int>(width * 0.7f), 200, 1400);
 
-        constexpr int warmup  = 300;   // transient iterations to discard
-        constexpr int plotItr = 120;   // attractor samples per column
-
         // Animated left-to-right sweep (completes in ~2 s)
         const float revealFrac = std::clamp(time * 0.5f, 0.0f, 1.0f);
-        const int   visCols    = std::max(1, static_cast<int>(
+        int         visCols    = std::max(1, static_cast<int>(
                                      static_cast<float>(cols) * revealFrac));
 
         // ── Gridlines ─────────────────────────────────────────────────────
@@ -60,33 +71,6 @@ public:
             grid.push_back({gx, yMax, 0.78f, 0.76f, 0.74f, 0.22f});
         }
 
-        std::vector<Vertex> points;
-        points.reserve(static_cast<size_t>(visCols) * plotItr);
-
-        for (int col = 0; col < visCols; ++col) {
-            const float t =
-                static_cast<float>(col) / static_cast<float>(cols - 1);
-            const float r    = rMin + (rMax - rMin) * t;
-            const float clipX = xMin + (xMax - xMin) * t;
-
-            // Iterate the map
-            float x = 0.5f;
-            for (int i = 0; i < warmup; ++i)
-                x = r * x * (1.0f - x);
-
-            for (int i = 0; i < plotItr; ++i) {
-                x = r * x * (1.0f - x);
-                const float clipY = yMin + (yMax - yMin) * x;
-
-                // Deep blue → purple palette for light background
-                float cr{}, cg{}, cb{};
-                float hue = 0.65f + 0.15f * t;
-                hsvToRgb(hue, 0.75f, 0.55f, cr, cg, cb);
-
-                points.push_back({clipX, clipY, cr, cg, cb, 0.60f});
-            }
-        }
-
         // ── Axes (dark for light background) ──────────────────────────────
         std::vector<Vertex> axes;
         axes.push_back({xMin, yMin, 0.30f, 0.28f, 0.26f, 0.8f});
@@ -110,16 +94,158 @@ public:
             axes.push_back({xMin + 0.01f,  ty, 0.30f, 0.28f, 0.26f, 0.7f});
         }
 
-        // Onset-of-chaos marker at r ≈ 3.57
-        if (rMax > 3.57f) {
-            const float chaosT = (3.57f - rMin) / (rMax - rMin);
-            const float cx     = xMin + (xMax - xMin) * chaosT;
-            axes.push_back({cx, yMin, 0.85f, 0.15f, 0.15f, 0.55f});
-            axes.push_back({cx, yMax, 0.85f, 0.15f, 0.15f, 0.55f});
+        // Period-doubling markers at each b_n, faint, and the onset of chaos
+        // at r∞.  Markers closer than kMarkerPx to the last one drawn (or to
+        // r∞) would merge into a smear, so the cascade thins out towards r∞.
+        const auto& levels = feigenbaum_.extend(kFeigenbaumLevels);
+        const float rInf   = static_cast<float>(
+            static_cast<double>(feigenbaum_.accumulation()));
+        const float pxPerR = 0.5f * width * gl.viewScale() * (xMax - xMin) / (rMax - rMin);
+        const auto  clipX  = [&](float r) {
+            return xMin + (xMax - xMin) * (r - rMin) / (rMax - rMin);
+        };
+        float lastR = rMin;
+        for (const FeigenbaumLevel& L : levels) {
+            const auto r = static_cast<float>(L.bifurcation);
+            if (std::isnan(r) || r > rMax) continue;
+            if ((r - lastR) * pxPerR < kMarkerPx || (rInf - r) * pxPerR < kMarkerPx) continue;
+            grid.push_back({clipX(r), yMin, 0.85f, 0.15f, 0.15f, 0.22f});
+            grid.push_back({clipX(r), yMax, 0.85f, 0.15f, 0.15f, 0.22f});
+            lastR = r;
         }
+        if (rMax > rInf) {
+            axes.push_back({clipX(rInf), yMin, 0.85f, 0.15f, 0.15f, 0.55f});
+            axes.push_back({clipX(rInf), yMax, 0.85f, 0.15f, 0.15f, 0.55f});
+        }
+
+        // ── Attractor: on the GPU if the backend can, else cached here ─────
+        BifurcationDraw bif;
+        bif.rMin     = rMin;
+        bif.rMax     = rMax;
+        bif.columns  = std::clamp(static_cast<int>(width * 2.0f), 400, kGpuMaxCols);
+        bif.visible  = std::max(1, static_cast<int>(static_cast<float>(bif.columns) *
+                                                    revealFrac));
+        bif.warmup   = kWarmup;
+        bif.samples  = kGpuSamples;
+        bif.xMin     = xMin;
+        bif.xMax     = xMax;
+        bif.yMin     = yMin;
+        bif.yMax     = yMax;
+        bif.hue      = 0.65f;
+        bif.hueShift = 0.15f;
+        bif.sat      = 0.75f;
+        bif.val      = 0.55f;
+        bif.alpha    = kGpuAlpha;
 
         gl.drawLines(grid);
         gl.drawLines(axes);
+        if (gl.drawBifurcation(bif)) return;
+
+        ensureAttractor(rMax, cols);
+        visCols = std::min(visCols, ready_cols_);
+
+        std::vector<Vertex> points;
+        points.reserve(static_cast<size_t>(visCols) * kPlotItr);
+
+        for (int col = 0; col < visCols; ++col) {
+            const float t =
+                static_cast<float>(col) / static_cast<float>(cols - 1);
+            const float clipX = xMin + (xMax - xMin) * t;
+            const float* xs   = &attractor_[static_cast<size_t>(col) * kPlotItr];
+
+            for (int i = 0; i < kPlotItr; ++i) {
+                const float x     = xs[i];
+                const float clipY = yMin + (yMax - yMin) * x;
+
+                // Deep blue → purple palette for light background
+                float cr{}, cg{}, cb{};
+                float hue = 0.65f + 0.15f * t;
+                hsvToRgb(hue, 0.75f, 0.55f, cr, cg, cb);
+
+                points.push_back({clipX, clipY, cr, cg, cb, 0.60f});
+            }
+        }
+
         gl.drawPoints(points, 1.5f);
     }
+
+    void saveCache(BlobWriter& out) const override {
+        if (ready_cols_ < cache_cols_) return;   // still filling: recompute on load
+        out.put(cache_r_max_);
+        out.put(static_cast<std::int32_t>(cache_cols_));
+        out.putArray(std::span<const float>(attractor_));
+    }
+
+    bool loadCache(BlobReader& in) override {
+        const auto rMax = in.get<float>();
+        const auto cols = in.get<std::int32_t>();
+        std::vector<float> xs;
+        if (!in.getArray(xs) || xs.size() != static_cast<size_t>(cols) * kPlotItr)
+            return false;
+        if (tasks_) tasks_->cancel(task_);
+        cache_r_max_ = rMax;
+        cache_cols_  = cols;
+        ready_cols_  = cols;
+        attractor_   = std::move(xs);
+        return true;
+    }
+
+private:
+    static constexpr int   kWarmup   = 300;   // transient iterations to discard
+    static constexpr int   kPlotItr  = 120;   // attractor samples per column
+    static constexpr float kRMin     = 1.0f;
+    static constexpr int   kTaskCols = 128;   // columns between budget checkpoints
+
+    // Cascade markers: b_1 … b_12 at most, at least kMarkerPx apart.
+    static constexpr int   kFeigenbaumLevels = FeigenbaumEngine::kMaxBifurcationLevel;
+    static constexpr float kMarkerPx         = 2.0f;
+
+    // GPU diagrams: many more, fainter points.
+    static constexpr int   kGpuMaxCols = 8192;
+    static constexpr int   kGpuSamples = 400;
+    static constexpr float kGpuAlpha   = 0.25f;
+
+    std::vector<float>    attractor_;        // cols × kPlotItr samples of x
+    float                 cache_r_max_ = 0.0f;
+    int                   cache_cols_  = 0;
+    int                   ready_cols_  = 0;  // columns filled so far
+    TaskScheduler::TaskId task_        = 0;
+    FeigenbaumEngine      feigenbaum_;
+
+    /// Start refilling the attractor for [kRMin, rMax] unless cached or
+    /// already under way; a fill for stale settings is cancelled.
+    void ensureAttractor(float rMax, int cols) {
+        if (rMax == cache_r_max_ && cols == cache_cols_) return;
+        if (tasks_) tasks_->cancel(task_);
+        attractor_.resize(static_cast<size_t>(cols) * kPlotItr);
+        cache_r_max_ = rMax;
+        cache_cols_  = cols;
+        ready_cols_  = 0;
+        task_        = spawnTask(tasks_, "logistic attractor", fillAttractor(rMax, cols), this);
+    }
+
+    Task fillAttractor(float rMax, int cols) {
+        const auto fill = [&](size_t lo, size_t hi) {
+            for (size_t col = lo; col < hi; ++col) {
+                const float t = static_cast<float>(col) / static_cast<float>(cols - 1);
+                const float r = kRMin + (rMax - kRMin) * t;
+
+                float x = 0.5f;
+                for (int i = 0; i < kWarmup; ++i)
+                    x = r * x * (1.0f - x);
+
+                float* xs = &attractor_[col * kPlotItr];
+                for (int i = 0; i < kPlotItr; ++i) {
+                    x = r * x * (1.0f - x);
+                    xs[i] = x;
+                }
+            }
+        };
+        for (int first = 0; first < cols; first += kTaskCols) {
+            const int last = std::min(cols, first + kTaskCols);
+            parallelFor(jobs_, static_cast<size_t>(first), static_cast<size_t>(last), 32, fill);
+            ready_cols_ = last;
+            co_await Checkpoint{static_cast<float>(last) / static_cast<float>(cols)};
+        }
+    }
 };
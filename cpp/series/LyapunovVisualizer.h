@@ -0,0 +1,280 @@
+// ─── WizSeries: Markus–Lyapunov Fractal ─────────────────────────────────────
+// The two-parameter extension of the logistic map: xₙ₊₁ = rₙ·xₙ·(1 − xₙ)
+// where rₙ alternates between a and b according to a periodic sequence such
+// as "AB" or "AABAB".  Each point of the (a, b) plane is coloured by the
+// Lyapunov exponent λ = mean ln|rₙ·(1 − 2xₙ)|: gold where the orbit is
+// stable (λ < 0), blue where it is chaotic (λ > 0).
+//
+// A backend that evaluates λ per pixel (GLRenderer::drawLyapunov) renders
+// the plane at full resolution — zooming re-evaluates it rather than
+// stretching cells — and refines high iteration counts over several frames.
+// Otherwise λ is computed here on a grid of cells as an incremental task,
+// cached across frames and saved in snapshots.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include "ISeriesVisualizer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <span>
+#include <utility>
+#include <vector>
+
+class LyapunovVisualizer : public ISeriesVisualizer {
+public:
+    LyapunovVisualizer() {
+        params_["sequence"]   = 0.0f;
+        params_["iterations"] = 1000.0f;
+    }
+
+    void render(float /*time*/, float width, float height,
+                IRenderer& gl) override {
+        const int seq = std::clamp(static_cast<int>(getParam("sequence", 0.0f)), 0,
+                                   kSequenceCount - 1);
+        const int iterations =
+            std::clamp(static_cast<int>(getParam("iterations", 1000.0f)), 10, 100000);
+        const Sequence& s = kSequences[seq];
+
+        // Same margins as the logistic map, for the axis labels
+        constexpr float mLeft   = 0.14f;
+        constexpr float mRight  = 0.06f;
+        constexpr float mBottom = 0.12f;
+        constexpr float mTop    = 0.08f;
+
+        const float xMin = -1.0f + mLeft;
+        const float xMax =  1.0f - mRight;
+        const float yMin = -1.0f + mBottom;
+        const float yMax =  1.0f - mTop;
+
+        LyapunovDraw d;
+        d.pattern    = patternBits(s.name);
+        d.length     = static_cast<int>(std::strlen(s.name));
+        d.warmup     = kWarmup;
+        d.iterations = iterations;
+        d.perFrame   = kGpuStepsPerFrame;
+        d.aMin       = s.aMin;
+        d.aMax       = s.aMax;
+        d.bMin       = s.bMin;
+        d.bMax       = s.bMax;
+        d.xMin       = xMin;
+        d.xMax       = xMax;
+        d.yMin       = yMin;
+        d.yMax       = yMax;
+        d.stableHue  = 0.12f;   // gold
+        d.chaosHue   = 0.62f;   // blue
+        d.sat        = 0.85f;
+        d.contrast   = 1.0f;
+
+        // ── The plane: per pixel on the GPU, else cached cells ────────────
+        if (!gl.drawLyapunov(d)) {
+            // Cells of about kCellPx canvas pixels
+            const int cols = std::clamp(
+                static_cast<int>(0.5f * (xMax - xMin) * width / kCellPx), 16, kMaxCells);
+            const int rows = std::clamp(
+                static_cast<int>(0.5f * (yMax - yMin) * height / kCellPx), 16, kMaxCells);
+            ensureExponents(seq, iterations, cols, rows);
+
+            std::vector<Vertex> cells;
+            cells.reserve(static_cast<size_t>(ready_rows_) * cols * 4);
+            const float cw = (xMax - xMin) / static_cast<float>(cols);
+            const float ch = (yMax - yMin) / static_cast<float>(rows);
+            for (int row = 0; row < ready_rows_; ++row) {
+                const float y1 = yMin + ch * static_cast<float>(row);
+                for (int col = 0; col < cols; ++col) {
+                    const float x1 = xMin + cw * static_cast<float>(col);
+                    float cr{}, cg{}, cb{};
+                    colour(d, lambda_[static_cast<size_t>(row) * cols + col], cr, cg, cb);
+                    addQuad(cells, x1, y1, x1 + cw, y1 + ch, cr, cg, cb);
+                }
+            }
+            gl.drawQuads(cells);
+        }
+
+        // ── Axes and ticks (dark for light background) ────────────────────
+        std::vector<Vertex> axes;
+        axes.push_back({xMin, yMin, 0.30f, 0.28f, 0.26f, 0.8f});
+        axes.push_back({xMax, yMin, 0.30f, 0.28f, 0.26f, 0.8f});
+        axes.push_back({xMin, yMin, 0.30f, 0.28f, 0.26f, 0.8f});
+        axes.push_back({xMin, yMax, 0.30f, 0.28f, 0.26f, 0.8f});
+
+        // a ticks along the bottom, b ticks up the left side
+        for (float a : ticks(s.aMin, s.aMax)) {
+            const float tx = xMin + (xMax - xMin) * (a - s.aMin) / (s.aMax - s.aMin);
+            axes.push_back({tx, yMin - 0.015f, 0.30f, 0.28f, 0.26f, 0.7f});
+            axes.push_back({tx, yMin + 0.01f,  0.30f, 0.28f, 0.26f, 0.7f});
+        }
+        for (float b : ticks(s.bMin, s.bMax)) {
+            const float ty = yMin + (yMax - yMin) * (b - s.bMin) / (s.bMax - s.bMin);
+            axes.push_back({xMin - 0.015f, ty, 0.30f, 0.28f, 0.26f, 0.7f});
+            axes.push_back({xMin + 0.01f,  ty, 0.30f, 0.28f, 0.26f, 0.7f});
+        }
+        gl.drawLines(axes);
+    }
+
+    void saveCache(BlobWriter& out) const override {
+        if (ready_rows_ < cache_rows_) return;   // still filling: recompute on load
+        out.put(static_cast<std::int32_t>(cache_seq_));
+        out.put(static_cast<std::int32_t>(cache_iterations_));
+        out.put(static_cast<std::int32_t>(cache_cols_));
+        out.put(static_cast<std::int32_t>(cache_rows_));
+        out.putArray(std::span<const float>(lambda_));
+    }
+
+    bool loadCache(BlobReader& in) override {
+        const auto seq        = in.get<std::int32_t>();
+        const auto iterations = in.get<std::int32_t>();
+        const auto cols       = in.get<std::int32_t>();
+        const auto rows       = in.get<std::int32_t>();
+        std::vector<float> ls;
+        if (!in.getArray(ls) || ls.size() != static_cast<size_t>(cols) * rows) return false;
+        if (tasks_) tasks_->cancel(task_);
+        cache_seq_        = seq;
+        cache_iterations_ = iterations;
+        cache_cols_       = cols;
+        cache_rows_       = rows;
+        ready_rows_       = rows;
+        lambda_           = std::move(ls);
+        return true;
+    }
+
+private:
+    /// A growth-rate sequence ('A' → a, 'B' → b) and the window of the
+    /// (a, b) plane that shows it best.
+    struct Sequence {
+        const char* name;
+        float       aMin, aMax, bMin, bMax;
+    };
+
+    // Indexed by the "sequence" parameter; the front end lists the same.
+    static constexpr Sequence kSequences[] = {
+        {"AB",           2.0f, 4.0f, 2.0f, 4.0f},
+        {"AABAB",        2.0f, 4.0f, 2.0f, 4.0f},
+        {"BBBBBBAAAAAA", 3.4f, 4.0f, 2.5f, 3.4f},   // "Zircon Zity"
+        {"AABB",         2.0f, 4.0f, 2.0f, 4.0f},
+        {"ABBBB",        2.0f, 4.0f, 2.0f, 4.0f},
+    };
+    static constexpr int kSequenceCount = static_cast<int>(std::size(kSequences));
+
+    static constexpr int   kWarmup           = 200;      // transient steps to discard
+    static constexpr int   kGpuStepsPerFrame = 250;      // per pixel, when refining
+    static constexpr float kCellPx           = 3.0f;     // CPU cell size in pixels
+    static constexpr int   kMaxCells         = 400;      // per axis
+    static constexpr int   kFirstRunSteps    = 1 << 16;  // CPU steps before a rate is known
+    static constexpr int   kGrainSteps       = 1 << 18;  // CPU steps per job
+
+    std::vector<float>    lambda_;               // rows × cols exponents
+    int                   cache_seq_        = -1;
+    int                   cache_iterations_ = 0;
+    int                   cache_cols_       = 0;
+    int                   cache_rows_       = 0;
+    int                   ready_rows_       = 0;  // rows filled so far
+    TaskScheduler::TaskId task_             = 0;
+
+    /// Bit i set where step i of the sequence uses b.
+    static std::uint32_t patternBits(const char* seq) {
+        std::uint32_t bits = 0;
+        for (int i = 0; seq[i]; ++i)
+            if (seq[i] == 'B') bits |= std::uint32_t{1} << i;
+        return bits;
+    }
+
+    /// Multiples of 0.5 (0.1 for narrow windows) inside [lo, hi].
+    static std::vector<float> ticks(float lo, float hi) {
+        const float step = hi - lo > 1.0f ? 0.5f : 0.1f;
+        std::vector<float> out;
+        for (int k = static_cast<int>(std::ceil(lo / step - 1e-3f));
+             static_cast<float>(k) * step <= hi + 1e-3f; ++k)
+            out.push_back(static_cast<float>(k) * step);
+        return out;
+    }
+
+    /// The palette LyapunovDraw documents, for cells computed here.
+    static void colour(const LyapunovDraw& d, float lambda, float& r, float& g, float& b) {
+        if (lambda <= 0.0f)
+            hsvToRgb(d.stableHue, d.sat, 0.95f - 0.8f * (1.0f - std::exp(lambda * d.contrast)),
+                     r, g, b);
+        else
+            hsvToRgb(d.chaosHue, d.sat, 0.6f - 0.5f * (1.0f - std::exp(-lambda * d.contrast)),
+                     r, g, b);
+    }
+
+    /// λ at growth rates (a, b) under `seq`.
+    static float exponent(const char* seq, int length, double a, double b, int iterations) {
+        double x   = 0.5;
+        double sum = 0.0;
+        int    i   = 0;
+        for (int k = 0; k < kWarmup; ++k, i = (i + 1) % length) {
+            const double r = seq[i] == 'B' ? b : a;
+            x = r * x * (1.0 - x);
+        }
+        for (int k = 0; k < iterations; ++k, i = (i + 1) % length) {
+            const double r = seq[i] == 'B' ? b : a;
+            sum += std::log(std::max(std::abs(r * (1.0 - 2.0 * x)), 1e-30));
+            x    = r * x * (1.0 - x);
+        }
+        return static_cast<float>(sum / iterations);
+    }
+
+    /// Start refilling the exponent grid unless cached or already under
+    /// way; a fill for stale settings is cancelled.
+    void ensureExponents(int seq, int iterations, int cols, int rows) {
+        if (seq == cache_seq_ && iterations == cache_iterations_ && cols == cache_cols_ &&
+            rows == cache_rows_)
+            return;
+        if (tasks_) tasks_->cancel(task_);
+        lambda_.resize(static_cast<size_t>(cols) * rows);
+        cache_seq_        = seq;
+        cache_iterations_ = iterations;
+        cache_cols_       = cols;
+        cache_rows_       = rows;
+        ready_rows_       = 0;
+        task_ = spawnTask(tasks_, "lyapunov exponents", fillExponents(seq, iterations, cols, rows),
+                          this);
+    }
+
+    /// Cells that fit in `seconds` at `rate` cells per second; before any
+    /// rate is known, the cells of kFirstRunSteps steps.  At least one.
+    static size_t cellsPerRun(double rate, double seconds, int stepsPerCell, size_t left) {
+        const double fits = rate > 0.0 ? rate * seconds
+                                       : static_cast<double>(kFirstRunSteps / stepsPerCell);
+        return fits >= static_cast<double>(left) ? left
+                                                 : std::max<size_t>(1, static_cast<size_t>(fits));
+    }
+
+    Task fillExponents(int seq, int iterations, int cols, int rows) {
+        const Sequence& s      = kSequences[seq];
+        const int       length = static_cast<int>(std::strlen(s.name));
+        const auto fill = [&](size_t lo, size_t hi) {
+            for (size_t cell = lo; cell < hi; ++cell) {
+                const size_t row = cell / static_cast<size_t>(cols);
+                const size_t col = cell % static_cast<size_t>(cols);
+                const double b = s.bMin + (s.bMax - s.bMin) * (static_cast<double>(row) + 0.5) /
+                                          rows;
+                const double a = s.aMin + (s.aMax - s.aMin) * (static_cast<double>(col) + 0.5) /
+                                          cols;
+                lambda_[cell] = exponent(s.name, length, a, b, iterations);
+            }
+        };
+        // Runs are sized in cells, not rows, from the measured rate: a row
+        // at 10⁵ iterations alone takes seconds.
+        const int    stepsPerCell = iterations + kWarmup;
+        const size_t grain = std::max<size_t>(1, static_cast<size_t>(kGrainSteps / stepsPerCell));
+        const size_t cells = static_cast<size_t>(cols) * static_cast<size_t>(rows);
+        double       rate  = 0.0;   // cells per second of the last run
+        for (size_t done = 0; done < cells;) {
+            const size_t n  = cellsPerRun(rate, co_await SliceLeft{}, stepsPerCell, cells - done);
+            const auto   t0 = std::chrono::steady_clock::now();
+            parallelFor(jobs_, done, done + n, grain, fill);
+            const std::chrono::duration<double> took = std::chrono::steady_clock::now() - t0;
+            rate        = static_cast<double>(n) / std::max(took.count(), 1e-9);
+            done       += n;
+            ready_rows_ = static_cast<int>(done / static_cast<size_t>(cols));
+            co_await Checkpoint{static_cast<float>(done) / static_cast<float>(cells)};
+        }
+    }
+};
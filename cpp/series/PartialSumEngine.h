@@ -0,0 +1,130 @@
+// ─── WizSeries: Partial-Sum Engine ──────────────────────────────────────────
+// Shared term generator and compensated running sum for every summable
+// series the visualizers plot.  Terms are produced sequentially in double
+// precision and accumulated with Neumaier summation, so partial sums stay
+// accurate to a few ulps even after millions of terms.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <string_view>
+
+enum class SeriesKind {
+    Harmonic,         // Σ 1/k,              k ≥ 1   (diverges)
+    Geometric,        // Σ r^k,              k ≥ 0   → 1/(1−r) for |r| < 1
+    Basel,            // Σ 1/k²,             k ≥ 1   → π²/6
+    AltHarmonic,      // Σ (−1)^(k+1)/k,     k ≥ 1   → ln 2
+    ESeries,          // Σ 1/k!,             k ≥ 0   → e
+    InvGeometric,     // Σ 1/2^k,            k ≥ 1   → 1
+    GregoryLeibniz,   // Σ (−1)^k/(2k+1),    k ≥ 0   → π/4
+    Apery,            // Σ 1/k³,             k ≥ 1   → ζ(3)
+};
+
+struct SeriesInfo {
+    SeriesKind    kind;
+    const char*   key;          // matches the visualizer registry key
+    std::uint64_t firstIndex;
+};
+
+inline constexpr SeriesInfo kSeriesTable[] = {
+    {SeriesKind::Harmonic,       "harmonic",        1},
+    {SeriesKind::Geometric,      "geometric",       0},
+    {SeriesKind::Basel,          "basel",           1},
+    {SeriesKind::AltHarmonic,    "alt_harmonic",    1},
+    {SeriesKind::ESeries,        "e_series",        0},
+    {SeriesKind::InvGeometric,   "inv_geometric",   1},
+    {SeriesKind::GregoryLeibniz, "gregory_leibniz", 0},
+    {SeriesKind::Apery,          "apery",           1},
+};
+
+/// Look up a series by visualizer key; nullptr if the key is not a series.
+inline const SeriesInfo* findSeries(std::string_view key) {
+    for (const SeriesInfo& s : kSeriesTable)
+        if (key == s.key) return &s;
+    return nullptr;
+}
+
+/// Limit of the series, or NaN when it diverges.
+inline double seriesLimit(SeriesKind kind, double ratio = 0.0) {
+    constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+    switch (kind) {
+        case SeriesKind::Harmonic:       return nan;
+        case SeriesKind::Geometric:      return std::abs(ratio) < 1.0 ? 1.0 / (1.0 - ratio) : nan;
+        case SeriesKind::Basel:          return std::numbers::pi * std::numbers::pi / 6.0;
+        case SeriesKind::AltHarmonic:    return std::numbers::ln2;
+        case SeriesKind::ESeries:        return std::numbers::e;
+        case SeriesKind::InvGeometric:   return 1.0;
+        case SeriesKind::GregoryLeibniz: return std::numbers::pi / 4.0;
+        case SeriesKind::Apery:          return 1.2020569031595942854;
+    }
+    return nan;
+}
+
+// ─── PartialSumCursor ───────────────────────────────────────────────────────
+// Walks one series term by term.  Holds O(1) state, so arbitrarily long
+// prefixes can be streamed without materialising them.
+
+class PartialSumCursor {
+public:
+    /// `ratio` is only used by SeriesKind::Geometric.
+    explicit PartialSumCursor(SeriesKind kind, double ratio = 0.0)
+        : kind_(kind), ratio_(ratio), limit_(seriesLimit(kind, ratio)) {
+        for (const SeriesInfo& s : kSeriesTable)
+            if (s.kind == kind) index_ = s.firstIndex;
+        // Geometric / e / 2^−k terms come from a recurrence seeded here.
+        recur_ = kind == SeriesKind::InvGeometric ? 0.5 : 1.0;
+    }
+
+    /// Index k of the term the next call to next() returns.
+    [[nodiscard]] std::uint64_t index() const { return index_; }
+
+    /// Partial sum of every term consumed so far.
+    [[nodiscard]] double sum() const { return sum_ + comp_; }
+
+    [[nodiscard]] double limit() const { return limit_; }
+
+    /// Produce term k = index(), add it to the running sum and advance.
+    double next() {
+        const double t = term();
+        const double s = sum_ + t;
+        // Neumaier: recover the low-order bits lost by whichever addend is smaller.
+        comp_ += std::abs(sum_) >= std::abs(t) ? (sum_ - s) + t : (t - s) + sum_;
+        sum_ = s;
+        ++index_;
+        return t;
+    }
+
+private:
+    SeriesKind    kind_;
+    double        ratio_;
+    double        limit_;
+    std::uint64_t index_ = 0;
+    double        recur_ = 1.0;
+    double        sum_   = 0.0;
+    double        comp_  = 0.0;
+
+    double term() {
+        const auto k = static_cast<double>(index_);
+        switch (kind_) {
+            case SeriesKind::Harmonic:       return 1.0 / k;
+            case SeriesKind::Basel:          return 1.0 / (k * k);
+            case SeriesKind::Apery:          return 1.0 / (k * k * k);
+            case SeriesKind::AltHarmonic:    return (index_ & 1 ? 1.0 : -1.0) / k;
+            case SeriesKind::GregoryLeibniz: return (index_ & 1 ? -1.0 : 1.0) / (2.0 * k + 1.0);
+            case SeriesKind::Geometric:      return advance(ratio_);
+            case SeriesKind::InvGeometric:   return advance(0.5);
+            case SeriesKind::ESeries:        return advance(1.0 / (k + 1.0));
+        }
+        return 0.0;
+    }
+
+    /// Return the current recurrence term and multiply in the next factor.
+    double advance(double factor) {
+        const double t = recur_;
+        recur_ *= factor;
+        return t;
+    }
+};
@@ -0,0 +1,142 @@
+// ─── WizSeries: Streaming Partial-Sum Export ────────────────────────────────
+// Streams (index, term, partial sum, error vs. limit) rows from a
+// PartialSumScan to a chunk callback, as CSV text or as little-endian
+// float64 columns.  Only one chunk is ever buffered, so memory stays bounded
+// no matter how many terms are exported; each chunk's columns are filled in
+// parallel when a JobSystem is supplied, with the compensated carry handed
+// from chunk to chunk.
+//
+// Binary chunk layout (SoA), `rows` values per column, 8 bytes each:
+//   [index × rows][term × rows][partial sum × rows][error × rows]
+// `error` is sum − limit, NaN for divergent series.
+// CSV chunks are UTF-8; the first one starts with the header line
+//   index,term,partial_sum,error
+// and non-finite values (e.g. `error` of a divergent series) are left empty.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include "JobSystem.h"
+#include "PartialSumScan.h"
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <span>
+#include <vector>
+
+enum class ExportFormat { Binary, Csv };
+
+/// Receives each encoded chunk; `bytes` is only valid during the call.
+/// Return false to stop the export early.
+using ChunkSink = std::function<bool(std::span<const std::uint8_t> bytes,
+                                     std::uint64_t firstRow, std::uint32_t rows)>;
+
+struct ExportResult {
+    std::uint64_t rows      = 0;
+    double        sum       = 0.0;   // partial sum after the last row
+    std::uint64_t bytes     = 0;
+    std::uint32_t chunks    = 0;
+    bool          cancelled = false;
+    double        ms        = 0.0;
+};
+
+class PartialSumExporter {
+public:
+    static constexpr std::uint32_t kMaxChunkRows = 1u << 20;   // 32 MiB binary
+
+    PartialSumExporter(ExportFormat format, std::uint32_t chunkRows)
+        : format_(format), chunk_rows_(std::clamp(chunkRows, 1u, kMaxChunkRows)) {}
+
+    /// Scan the first `rows` terms and hand them to `sink` chunk by chunk.
+    ExportResult run(PartialSumScan& scan, std::uint64_t rows, const ChunkSink& sink,
+                     JobSystem* jobs = nullptr) {
+        const auto t0 = std::chrono::steady_clock::now();
+        ExportResult res;
+        const double limit = scan.limit();
+        ScanCarry    carry;
+
+        cols_.resize(std::size_t{4} * chunk_rows_);
+        while (res.rows < rows) {
+            const auto n = static_cast<std::uint32_t>(
+                std::min<std::uint64_t>(chunk_rows_, rows - res.rows));
+            double* index = cols_.data();
+            double* term  = index + n;
+            double* sum   = term + n;
+            double* error = sum + n;
+            carry = scan.run(res.rows, {sum, n}, {term, n}, carry, jobs);
+            const double k0 = static_cast<double>(scan.firstIndex() + res.rows);
+            for (std::uint32_t i = 0; i < n; ++i) {
+                index[i] = k0 + i;
+                error[i] = sum[i] - limit;
+            }
+
+            const std::span<const std::uint8_t> bytes =
+                format_ == ExportFormat::Binary ? encodeBinary(n)
+                                                : encodeCsv(n, res.rows == 0);
+            ++res.chunks;
+            res.bytes += bytes.size();
+            const bool more = sink(bytes, res.rows, n);
+            res.rows += n;
+            if (!more) {
+                res.cancelled = res.rows < rows;
+                break;
+            }
+        }
+
+        res.sum = carry.sum();
+        res.ms  = std::chrono::duration<double, std::milli>(
+                     std::chrono::steady_clock::now() - t0).count();
+        return res;
+    }
+
+private:
+    ExportFormat              format_;
+    std::uint32_t             chunk_rows_;
+    std::vector<double>       cols_;
+    std::vector<std::uint8_t> bytes_;
+
+    std::span<const std::uint8_t> encodeBinary(std::uint32_t n) {
+        const std::size_t count = std::size_t{4} * n;
+        if constexpr (std::endian::native == std::endian::little) {
+            return {reinterpret_cast<const std::uint8_t*>(cols_.data()), count * 8};
+        } else {
+            bytes_.resize(count * 8);
+            for (std::size_t i = 0; i < count; ++i) {
+                const auto bits = std::bit_cast<std::uint64_t>(cols_[i]);
+                for (int b = 0; b < 8; ++b)
+                    bytes_[i * 8 + b] = static_cast<std::uint8_t>(bits >> (8 * b));
+            }
+            return bytes_;
+        }
+    }
+
+    std::span<const std::uint8_t> encodeCsv(std::uint32_t n, bool header) {
+        static constexpr char kHeader[] = "index,term,partial_sum,error\n";
+        // 4 shortest-round-trip doubles (≤ 24 chars each) plus separators.
+        bytes_.resize((header ? sizeof(kHeader) : 0) + std::size_t{n} * 100);
+        char* const begin = reinterpret_cast<char*>(bytes_.data());
+        char* const end   = begin + bytes_.size();
+        char*       out   = begin;
+        if (header) {
+            std::memcpy(out, kHeader, sizeof(kHeader) - 1);
+            out += sizeof(kHeader) - 1;
+        }
+
+        const double* cols = cols_.data();
+        for (std::uint32_t i = 0; i < n; ++i) {
+            out = std::to_chars(out, end, static_cast<std::uint64_t>(cols[i])).ptr;
+            for (int c = 1; c < 4; ++c) {
+                const double v = cols[static_cast<std::size_t>(c) * n + i];
+                *out++ = ',';
+                if (std::isfinite(v)) out = std::to_chars(out, end, v).ptr;
+            }
+            *out++ = '\n';
+        }
+        return {bytes_.data(), static_cast<std::size_t>(out - begin)};
+    }
+};
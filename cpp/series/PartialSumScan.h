@@ -0,0 +1,229 @@
+// ─── WizSeries: Parallel Partial-Sum Scan ───────────────────────────────────
+// Fills arrays of partial sums (and optionally terms) for long prefixes of a
+// series — the parallel counterpart of PartialSumCursor.  Reduce-then-scan:
+//
+//   1. reduce   every block (in parallel) splits into four lane segments
+//               plus a short scalar tail; the lanes run side by side in one
+//               4-wide vector, generating terms and accumulating each
+//               segment's total
+//   2. offsets  a serial compensated prefix over the segment totals gives
+//               every segment its starting (hi, lo) sum
+//   3. scan     every block (in parallel) regenerates its terms and writes
+//               running sums seeded from those offsets
+//
+// Accumulation is Knuth's branch-free TwoSum throughout, carrying the lost
+// low-order bits in a second vector, so results match the sequential
+// Neumaier cursor to a few ulps.  Vectors use the GCC/Clang vector extension
+// (SSE2/AVX natively, SIMD128 under Emscripten with -msimd128, scalarised
+// otherwise).
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include "JobSystem.h"
+#include "PartialSumEngine.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/// Running compensated sum: value hi + lo.
+struct ScanCarry {
+    double hi = 0.0;
+    double lo = 0.0;
+
+    [[nodiscard]] double sum() const { return hi + lo; }
+};
+
+class PartialSumScan {
+public:
+    static constexpr std::size_t kBlock = std::size_t{1} << 15;   // terms per job
+
+    /// `ratio` is only used by SeriesKind::Geometric.
+    explicit PartialSumScan(SeriesKind kind, double ratio = 0.0)
+        : kind_(kind), ratio_(ratio), limit_(seriesLimit(kind, ratio)) {
+        for (const SeriesInfo& s : kSeriesTable)
+            if (s.kind == kind) first_index_ = s.firstIndex;
+    }
+
+    /// Index of the series' first term (k of row 0).
+    [[nodiscard]] std::uint64_t firstIndex() const { return first_index_; }
+
+    [[nodiscard]] double limit() const { return limit_; }
+
+    /// Term k, computed directly (no recurrence state).
+    [[nodiscard]] double term(std::uint64_t k) const {
+        const auto kd = static_cast<double>(k);
+        switch (kind_) {
+            case SeriesKind::Harmonic:       return 1.0 / kd;
+            case SeriesKind::Basel:          return 1.0 / (kd * kd);
+            case SeriesKind::Apery:          return 1.0 / (kd * kd * kd);
+            case SeriesKind::AltHarmonic:    return (k & 1 ? 1.0 : -1.0) / kd;
+            case SeriesKind::GregoryLeibniz: return (k & 1 ? -1.0 : 1.0) / (2.0 * kd + 1.0);
+            case SeriesKind::Geometric:      return std::pow(ratio_, kd);
+            case SeriesKind::InvGeometric:   return std::ldexp(1.0, -static_cast<int>(
+                                                        std::min<std::uint64_t>(k, 2000)));
+            case SeriesKind::ESeries:        return k < 171 ? 1.0 / std::tgamma(kd + 1.0) : 0.0;
+        }
+        return 0.0;
+    }
+
+    /// Write partial sums for rows [row, row + sums.size()) — row r holds
+    /// term firstIndex() + r — continuing from `carry`, the compensated sum
+    /// of every earlier row.  `terms` is filled too unless empty (else it
+    /// must match `sums` in size).  Returns the carry after the last row.
+    ScanCarry run(std::uint64_t row, std::span<double> sums, std::span<double> terms,
+                  ScanCarry carry, JobSystem* jobs) {
+        using K = SeriesKind;
+        switch (kind_) {
+            case K::Harmonic:       return runKind<K::Harmonic>(row, sums, terms, carry, jobs);
+            case K::Geometric:      return runKind<K::Geometric>(row, sums, terms, carry, jobs);
+            case K::Basel:          return runKind<K::Basel>(row, sums, terms, carry, jobs);
+            case K::AltHarmonic:    return runKind<K::AltHarmonic>(row, sums, terms, carry, jobs);
+            case K::ESeries:        return runKind<K::ESeries>(row, sums, terms, carry, jobs);
+            case K::InvGeometric:   return runKind<K::InvGeometric>(row, sums, terms, carry, jobs);
+            case K::GregoryLeibniz: return runKind<K::GregoryLeibniz>(row, sums, terms, carry, jobs);
+            case K::Apery:          return runKind<K::Apery>(row, sums, terms, carry, jobs);
+        }
+        return carry;
+    }
+
+private:
+    using f64x4 = double __attribute__((vector_size(32)));
+
+    static constexpr int kSegments = 5;   // four vector lanes + scalar tail
+
+    struct Block {
+        std::size_t begin, end;   // rows
+        std::size_t lane;         // rows per vector lane
+    };
+
+    SeriesKind    kind_;
+    double        ratio_;
+    double        limit_;
+    std::uint64_t first_index_ = 0;
+
+    std::vector<ScanCarry> totals_;   // kSegments per block
+
+    static Block block(std::size_t b, std::size_t count) {
+        const std::size_t begin = b * kBlock;
+        const std::size_t end   = std::min(count, begin + kBlock);
+        return {begin, end, (end - begin) / 4};
+    }
+
+    /// run() with the series fixed at compile time, so the inner loops
+    /// carry no per-term dispatch.
+    template <SeriesKind K>
+    ScanCarry runKind(std::uint64_t row, std::span<double> sums, std::span<double> terms,
+                      ScanCarry carry, JobSystem* jobs) {
+        const std::size_t count   = sums.size();
+        const std::size_t nBlocks = (count + kBlock - 1) / kBlock;
+        const std::uint64_t k0    = first_index_ + row;
+        totals_.assign(nBlocks * kSegments, {});
+
+        // 1. Segment totals.
+        parallelFor(jobs, 0, nBlocks, 1, [&](std::size_t lo, std::size_t hi) {
+            for (std::size_t b = lo; b < hi; ++b) {
+                const Block blk = block(b, count);
+                ScanCarry* out  = &totals_[b * kSegments];
+                Lanes<K> lanes(*this, k0 + blk.begin, blk.lane);
+                f64x4 h{}, l{}, x;
+                for (std::size_t i = 0; i < blk.lane; ++i) {
+                    lanes.next(x);
+                    twoSum(h, l, x);
+                }
+                for (int j = 0; j < 4; ++j) out[j] = {h[j], l[j]};
+                for (std::size_t i = blk.begin + 4 * blk.lane; i < blk.end; ++i)
+                    add(out[4], term(k0 + i));
+            }
+        });
+
+        // 2. Exclusive prefix of the totals → each segment's starting sum.
+        for (ScanCarry& t : totals_) {
+            const ScanCarry segment = t;
+            t = carry;
+            add(carry, segment.hi);
+            carry.lo += segment.lo;
+        }
+
+        // 3. Running sums seeded per segment.
+        parallelFor(jobs, 0, nBlocks, 1, [&](std::size_t lo, std::size_t hi) {
+            for (std::size_t b = lo; b < hi; ++b) {
+                const Block      blk   = block(b, count);
+                const ScanCarry* start = &totals_[b * kSegments];
+                Lanes<K> lanes(*this, k0 + blk.begin, blk.lane);
+                f64x4 h{start[0].hi, start[1].hi, start[2].hi, start[3].hi};
+                f64x4 l{start[0].lo, start[1].lo, start[2].lo, start[3].lo};
+                double* s = sums.data() + blk.begin;
+                double* t = terms.empty() ? nullptr : terms.data() + blk.begin;
+                f64x4   x;
+                for (std::size_t i = 0; i < blk.lane; ++i) {
+                    lanes.next(x);
+                    twoSum(h, l, x);
+                    const f64x4 v = h + l;
+                    for (int j = 0; j < 4; ++j) s[j * blk.lane + i] = v[j];
+                    if (t)
+                        for (int j = 0; j < 4; ++j) t[j * blk.lane + i] = x[j];
+                }
+                ScanCarry tail = start[4];
+                for (std::size_t i = blk.begin + 4 * blk.lane; i < blk.end; ++i) {
+                    const double x = term(k0 + i);
+                    add(tail, x);
+                    sums[i] = tail.sum();
+                    if (t) terms[i] = x;
+                }
+            }
+        });
+        return carry;
+    }
+
+    /// Knuth TwoSum: hi + x exactly as (hi', lo += error).  No branches, so
+    /// it vectorises and works for either operand being larger.
+    template <typename T>
+    static void twoSum(T& hi, T& lo, const T& x) {
+        const T s  = hi + x;
+        const T bb = s - hi;
+        lo += (hi - (s - bb)) + (x - bb);
+        hi = s;
+    }
+
+    static void add(ScanCarry& c, double x) { twoSum(c.hi, c.lo, x); }
+
+    /// Terms for four segments of `len` rows starting at index k, one
+    /// vector per step: lane j yields k + j·len, k + j·len + 1, …
+    template <SeriesKind K>
+    class Lanes {
+    public:
+        Lanes(const PartialSumScan& scan, std::uint64_t k, std::size_t len)
+            : ratio_(scan.ratio_) {
+            for (int j = 0; j < 4; ++j) {
+                const std::uint64_t kj = k + static_cast<std::uint64_t>(j) * len;
+                k_[j]    = static_cast<double>(kj);
+                sign_[j] = K == SeriesKind::GregoryLeibniz ? (kj & 1 ? -1.0 : 1.0)
+                                                           : (kj & 1 ? 1.0 : -1.0);
+                t_[j]    = scan.term(kj);   // seeds the recurrences
+            }
+        }
+
+        // Vectors go by reference: 32-byte by-value vectors change the ABI
+        // on targets without AVX.
+        void next(f64x4& t) {
+            if constexpr (K == SeriesKind::Harmonic)       t = 1.0 / k_;
+            if constexpr (K == SeriesKind::Basel)          t = 1.0 / (k_ * k_);
+            if constexpr (K == SeriesKind::Apery)          t = 1.0 / (k_ * k_ * k_);
+            if constexpr (K == SeriesKind::AltHarmonic)    t = sign_ / k_;
+            if constexpr (K == SeriesKind::GregoryLeibniz) t = sign_ / (2.0 * k_ + 1.0);
+            if constexpr (K == SeriesKind::Geometric)      { t = t_; t_ *= ratio_; }
+            if constexpr (K == SeriesKind::InvGeometric)   { t = t_; t_ *= 0.5; }
+            if constexpr (K == SeriesKind::ESeries)        { t = t_; t_ /= k_ + 1.0; }
+            k_ += 1.0;
+            sign_ = -sign_;
+        }
+
+    private:
+        double ratio_;
+        f64x4  k_{}, sign_{}, t_{};
+    };
+};
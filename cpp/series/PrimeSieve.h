@@ -0,0 +1,106 @@
+// ─── WizSeries: Segmented Prime Sieve ───────────────────────────────────────
+// The primes in order, from a sieve of Eratosthenes run one segment at a
+// time: kSegment numbers, odd ones only, sieved by the base primes up to the
+// square root of the segment's end.  Memory stays at one segment plus the
+// base primes however far the stream goes (10⁷ primes reach 1.8·10⁸), and
+// each segment records how many primes come before it, so the stream can
+// be rewound to any prime it has passed by re-sieving a single segment.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class PrimeSieve {
+public:
+    static constexpr std::uint64_t kSegment = std::uint64_t{1} << 19;   // numbers per segment
+
+    PrimeSieve() { fill(0); }
+
+    /// Every prime up to `limit`.
+    static std::vector<std::uint32_t> upTo(std::uint32_t limit) {
+        std::vector<std::uint32_t> primes;
+        PrimeSieve                 sieve;
+        for (std::uint64_t p = sieve.next(); p <= limit; p = sieve.next())
+            primes.push_back(static_cast<std::uint32_t>(p));
+        return primes;
+    }
+
+    /// Primes returned so far: the next is prime number count() + 1.
+    [[nodiscard]] std::uint64_t count() const { return before_[segment_] + at_; }
+
+    /// The next prime.
+    std::uint64_t next() {
+        while (at_ == primes_.size()) {
+            if (segment_ + 1 == before_.size()) before_.push_back(before_[segment_] + at_);
+            fill(segment_ + 1);
+        }
+        return primes_[at_++];
+    }
+
+    /// Go back to `primes` primes in, if the stream is further along.
+    void rewind(std::uint64_t primes) {
+        if (primes >= count()) return;
+        const auto s = static_cast<std::size_t>(
+            std::upper_bound(before_.begin(), before_.end(), primes) - before_.begin() - 1);
+        fill(s);
+        at_ = static_cast<std::size_t>(primes - before_[s]);
+    }
+
+private:
+    std::vector<std::uint32_t> base_;                        // odd primes up to base_limit_
+    std::uint64_t              base_limit_ = 1;
+    std::vector<std::uint8_t>  composite_;                   // odd numbers of the segment
+    std::vector<std::uint64_t> primes_;                      // primes of the segment
+    std::size_t                sieved_     = ~std::size_t{0};   // segment primes_ holds
+    std::size_t                segment_    = 0;
+    std::size_t                at_         = 0;              // primes_ returned
+    std::vector<std::uint64_t> before_     = {0};            // primes below each segment
+
+    /// Sieve segment `s` into primes_.
+    void fill(std::size_t s) {
+        if (s != sieved_) {
+            const std::uint64_t low  = s * kSegment;
+            const std::uint64_t high = low + kSegment;
+            extendBase(high);
+
+            composite_.assign(kSegment / 2, 0);   // index i: low + 2i + 1
+            for (const std::uint32_t p : base_) {
+                const std::uint64_t pp = std::uint64_t{p} * p;
+                if (pp >= high) break;
+                // First odd multiple of p at least max(p², low).
+                std::uint64_t m = std::max(pp, (low + p - 1) / p * p);
+                if (m % 2 == 0) m += p;
+                for (std::uint64_t i = (m - low) / 2; i < kSegment / 2; i += p) composite_[i] = 1;
+            }
+
+            primes_.clear();
+            if (low == 0) {
+                primes_.push_back(2);
+                composite_[0] = 1;   // 1 is not prime
+            }
+            for (std::size_t i = 0; i < composite_.size(); ++i)
+                if (!composite_[i]) primes_.push_back(low + 2 * i + 1);
+            sieved_ = s;
+        }
+        segment_ = s;
+        at_      = 0;
+    }
+
+    /// Make base_ hold every odd prime whose square is below `high`.
+    void extendBase(std::uint64_t high) {
+        if (base_limit_ * base_limit_ >= high) return;
+        std::uint64_t limit = base_limit_;
+        while (limit * limit < high) limit *= 2;
+        std::vector<std::uint8_t> composite(limit + 1, 0);
+        base_.clear();
+        for (std::uint64_t n = 3; n <= limit; n += 2) {
+            if (composite[n]) continue;
+            base_.push_back(static_cast<std::uint32_t>(n));
+            for (std::uint64_t m = n * n; m <= limit; m += 2 * n) composite[m] = 1;
+        }
+        base_limit_ = limit;
+    }
+};
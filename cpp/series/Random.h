@@ -0,0 +1,123 @@
+// ─── WizSeries: Random Streams ──────────────────────────────────────────────
+// Stateful and counter-based generators for Monte Carlo visualizers,
+// reproducible from a seed whatever the thread count: work is split into
+// independent streams, each seeded from (seed, stream index), never by
+// which thread runs it.
+//
+//   SplitMix64    seeds the others: consecutive inputs give unrelated
+//                 64-bit outputs (Steele, Lea & Flood).
+//   Xoshiro128x4  four xoshiro128+ generators side by side in one 4-wide
+//                 vector (Blackman & Vigna), one uint32 per lane per step
+//                 with nothing but adds, shifts and xors — SSE2 natively,
+//                 SIMD128 under Emscripten with -msimd128.  The upper bits
+//                 are the good ones: unitFloat() uses the top 24.
+//   Philox4x32x4  the counter-based Philox4x32-10 (Salmon et al., "Parallel
+//                 random numbers: as easy as 1, 2, 3") on four counters at
+//                 once: 128 random bits are a pure function of (key,
+//                 counter), so any sample can be drawn directly — by path
+//                 and term, say — without stepping a stream to it.  The
+//                 32×32→64 multiplies run as two 2-wide 64-bit products.
+//
+// Vectors use the GCC/Clang vector extension at 16 bytes, the width every
+// target has: wider ones are split into scalar code without AVX.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include <bit>
+#include <cstdint>
+
+using u32x4 = std::uint32_t __attribute__((vector_size(16)));
+using f32x4 = float __attribute__((vector_size(16)));
+using i32x4 = std::int32_t __attribute__((vector_size(16)));
+using u64x2 = std::uint64_t __attribute__((vector_size(16)));
+
+struct SplitMix64 {
+    std::uint64_t state = 0;
+
+    std::uint64_t next() {
+        std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+};
+
+class Xoshiro128x4 {
+public:
+    Xoshiro128x4() = default;
+
+    /// Lanes of stream `stream` under `seed`; distinct (seed, stream) pairs
+    /// give independent lanes.
+    Xoshiro128x4(std::uint64_t seed, std::uint64_t stream) {
+        SplitMix64 mix{seed ^ (stream * 0xD1342543DE82EF95ull)};
+        for (int lane = 0; lane < 4; ++lane) {
+            const std::uint64_t a = mix.next();
+            const std::uint64_t b = mix.next();
+            s_[0][lane] = static_cast<std::uint32_t>(a);
+            s_[1][lane] = static_cast<std::uint32_t>(a >> 32);
+            s_[2][lane] = static_cast<std::uint32_t>(b);
+            s_[3][lane] = static_cast<std::uint32_t>(b >> 32) | 1u;   // never all zero
+        }
+    }
+
+    /// Four uniform 32-bit values.
+    u32x4 next() {
+        const u32x4 out = s_[0] + s_[3];
+        const u32x4 t = s_[1] << 9;
+        s_[2] ^= s_[0];
+        s_[3] ^= s_[1];
+        s_[1] ^= s_[2];
+        s_[0] ^= s_[3];
+        s_[2] ^= t;
+        s_[3]  = (s_[3] << 11) | (s_[3] >> 21);
+        return out;
+    }
+
+    /// Four uniform floats in [0, 1).
+    f32x4 unitFloat() {
+        return __builtin_convertvector(next() >> 8, f32x4) * (1.0f / 16777216.0f);
+    }
+
+private:
+    u32x4 s_[4] = {};
+};
+
+class Philox4x32x4 {
+public:
+    /// Four 128-bit blocks: word j of counter (or output) i is w[j][i].
+    struct Block {
+        u32x4 w[4];
+    };
+
+    /// Philox4x32-10 of the four counters in `ctr` under `key`.
+    static Block generate(Block ctr, std::uint64_t key) {
+        std::uint32_t k0 = static_cast<std::uint32_t>(key);
+        std::uint32_t k1 = static_cast<std::uint32_t>(key >> 32);
+        for (int round = 0; round < 10; ++round) {
+            u32x4 hi0, lo0, hi1, lo1;
+            mulhilo(ctr.w[0], kM0, hi0, lo0);
+            mulhilo(ctr.w[2], kM1, hi1, lo1);
+            ctr = {{hi1 ^ ctr.w[1] ^ k0, lo1, hi0 ^ ctr.w[3] ^ k1, lo0}};
+            k0 += kW0;
+            k1 += kW1;
+        }
+        return ctr;
+    }
+
+private:
+    static constexpr std::uint32_t kM0 = 0xD2511F53u;
+    static constexpr std::uint32_t kM1 = 0xCD9E8D57u;
+    static constexpr std::uint32_t kW0 = 0x9E3779B9u;   // Weyl key increments
+    static constexpr std::uint32_t kW1 = 0xBB67AE85u;
+
+    /// Full 64-bit products a·m, split into high and low words per lane:
+    /// even and odd lanes are multiplied as two 64-bit lanes each.
+    static void mulhilo(u32x4 a, std::uint32_t m, u32x4& hi, u32x4& lo) {
+        const u64x2 wide = std::bit_cast<u64x2>(a);
+        const u64x2 even = (wide & 0xFFFFFFFFull) * m;
+        const u64x2 odd  = (wide >> 32) * m;
+        const u64x2 high = (even >> 32) | (odd & 0xFFFFFFFF00000000ull);
+        hi = std::bit_cast<u32x4>(high);
+        lo = a * m;
+    }
+};
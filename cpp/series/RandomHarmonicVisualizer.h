@@ -0,0 +1,196 @@
+// ─── WizSeries: Random Harmonic Series Visualizer ───────────────────────────
+// Σ ±1/n with fair random signs, by Monte Carlo (RandomSignSeries): the fan
+// of partial-sum paths over log n as a density image, narrowing as the
+// paths settle, and beside it the histogram of where they end — the limit
+// distribution, with variance π²/6.
+//
+// Paths accumulate as an incremental task up to "paths" thousand, each
+// reproducible from "seed"; raising the count continues from the paths
+// already summed.  The counts are cached across frames and saved in
+// snapshots.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include "ISeriesVisualizer.h"
+#include "RandomSignSeries.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+class RandomHarmonicVisualizer : public ISeriesVisualizer {
+public:
+    RandomHarmonicVisualizer() {
+        params_["paths"] = 100.0f;
+        params_["terms"] = 4096.0f;
+        params_["seed"]  = 1.0f;
+    }
+
+    void render(float /*time*/, float width, float height,
+                IRenderer& gl) override {
+        const double thousands = std::clamp(getParam("paths", 100.0f), 0.01f, 10000.0f);
+        const int    terms     = std::clamp(static_cast<int>(getParam("terms", 4096.0f)), 16,
+                                            kMaxTerms);
+        const auto   seed      = static_cast<std::uint64_t>(std::max(getParam("seed", 1.0f), 0.0f));
+
+        // Clip-space margins — extra left/bottom for axis labels
+        constexpr float mLeft   = 0.14f;
+        constexpr float mRight  = 0.06f;
+        constexpr float mBottom = 0.12f;
+        constexpr float mTop    = 0.08f;
+
+        const float xMin   = -1.0f + mLeft;
+        const float xMax   =  1.0f - mRight;
+        const float yMin   = -1.0f + mBottom;
+        const float yMax   =  1.0f - mTop;
+        const float xSplit = xMin + kFanShare * (xMax - xMin);   // fan | histogram
+        const float xHist  = xSplit + kHistGap;
+
+        ensurePaths(seed, terms,
+                    std::clamp(static_cast<int>(0.5f * (xSplit - xMin) * width), 16, kMaxBins),
+                    std::clamp(static_cast<int>(0.5f * (yMax - yMin) * height), 16, kMaxBins),
+                    static_cast<std::uint64_t>(thousands * 1e3));
+
+        // ── Gridlines at whole values of the sum ──────────────────────────
+        const float range = RandomSignSeries::kRange;
+        auto clipY = [&](float s) { return yMin + (yMax - yMin) * (s + range) / (2.0f * range); };
+        std::vector<Vertex> grid;
+        for (int s = -3; s <= 3; ++s) {
+            const float y = clipY(static_cast<float>(s));
+            const float a = s == 0 ? 0.45f : 0.22f;
+            grid.push_back({xMin, y, 0.78f, 0.76f, 0.74f, a});
+            grid.push_back({xMax, y, 0.78f, 0.76f, 0.74f, a});
+        }
+
+        // ── Limit histogram, one bar per fan row ──────────────────────────
+        std::vector<Vertex> bars;
+        const std::span<const std::uint32_t> limits = series_.limits();
+        if (series_.limitMax() > 0) {
+            float cr{}, cg{}, cb{};
+            hsvToRgb(kLimitHue, 0.65f, 0.62f, cr, cg, cb);
+            const float rowH = (yMax - yMin) / static_cast<float>(limits.size());
+            const float unit = (xMax - xHist) / static_cast<float>(series_.limitMax());
+            for (std::size_t i = 0; i < limits.size(); ++i) {
+                if (!limits[i]) continue;
+                const float y1 = yMin + rowH * static_cast<float>(i);
+                addQuad(bars, xHist, y1, xHist + unit * static_cast<float>(limits[i]), y1 + rowH,
+                        cr, cg, cb, 0.85f);
+            }
+        }
+
+        // ── Axes, and ±σ = ±π/√6 on the histogram ─────────────────────────
+        std::vector<Vertex> axes;
+        axes.push_back({xMin,   yMin, 0.30f, 0.28f, 0.26f, 0.8f});
+        axes.push_back({xSplit, yMin, 0.30f, 0.28f, 0.26f, 0.8f});
+        axes.push_back({xMin,   yMin, 0.30f, 0.28f, 0.26f, 0.8f});
+        axes.push_back({xMin,   yMax, 0.30f, 0.28f, 0.26f, 0.8f});
+        axes.push_back({xHist,  yMin, 0.30f, 0.28f, 0.26f, 0.8f});
+        axes.push_back({xHist,  yMax, 0.30f, 0.28f, 0.26f, 0.8f});
+        const float sigma = static_cast<float>(std::sqrt(kPi * kPi / 6.0));
+        for (const float s : {-sigma, sigma}) {
+            axes.push_back({xHist - 0.015f, clipY(s), 0.10f, 0.48f, 0.18f, 0.9f});
+            axes.push_back({xMax,           clipY(s), 0.10f, 0.48f, 0.18f, 0.9f});
+        }
+
+        DensityDraw d = series_.fan().draw(xMin, xSplit, yMin, yMax);
+        d.hue      = kFanHue;
+        d.hueShift = -0.15f;
+        d.sat      = 0.70f;
+        d.val      = 0.48f;
+
+        gl.setLayer(0);
+        gl.drawLines(grid);
+        gl.setLayer(1);
+        drawDensity(gl, d);
+        gl.drawQuads(bars);
+        gl.setLayer(2);
+        gl.drawLines(axes);
+    }
+
+    [[nodiscard]] PointStats pointStats() const override {
+        return {series_.paths() * static_cast<std::uint64_t>(series_.terms()), rate_};
+    }
+
+    void saveCache(BlobWriter& out) const override {
+        if (!started_) return;
+        const DensityBuffer& fan = series_.fan();
+        out.put(static_cast<std::uint64_t>(series_.seed()));
+        out.put(static_cast<std::int32_t>(series_.terms()));
+        out.put(static_cast<std::int32_t>(fan.width()));
+        out.put(static_cast<std::int32_t>(fan.height()));
+        out.put(static_cast<std::uint64_t>(series_.paths()));
+        out.putArray(fan.counts());
+        out.putArray(series_.limits());
+    }
+
+    bool loadCache(BlobReader& in) override {
+        const auto seed  = in.get<std::uint64_t>();
+        const auto terms = in.get<std::int32_t>();
+        const auto w     = in.get<std::int32_t>();
+        const auto h     = in.get<std::int32_t>();
+        const auto paths = in.get<std::uint64_t>();
+        std::vector<std::uint32_t> fan, limits;
+        if (!in.getArray(fan) || !in.getArray(limits) || terms < 16 || terms > kMaxTerms ||
+            w <= 0 || h <= 0 || w > kMaxBins || h > kMaxBins)
+            return false;
+        if (tasks_) tasks_->cancel(task_);
+        task_ = 0;
+        startPaths(seed, terms, w, h);
+        return series_.restore(fan, limits, paths);
+    }
+
+private:
+    static constexpr double        kPi          = 3.14159265358979323846;
+    static constexpr float         kFanShare    = 0.74f;   // of the plot width
+    static constexpr float         kHistGap     = 0.03f;   // clip units
+    static constexpr float         kFanHue      = 0.60f;
+    static constexpr float         kLimitHue    = 0.36f;
+    static constexpr int           kMaxBins     = 2048;    // per axis
+    static constexpr int           kMaxTerms    = 65536;
+    static constexpr std::uint64_t kTermsPerRun = std::uint64_t{1} << 23;
+
+    RandomSignSeries      series_;
+    bool                  started_ = false;
+    std::uint64_t         target_  = 0;     // paths the task works towards
+    double                rate_    = 0.0;   // terms per second of the last run
+    TaskScheduler::TaskId task_    = 0;
+
+    void startPaths(std::uint64_t seed, int terms, int w, int h) {
+        series_.reset(seed, terms, w, h);
+        started_ = true;
+        target_  = 0;
+        rate_    = 0.0;
+    }
+
+    /// Restart for a new seed, term count or bin size, and keep a task
+    /// summing paths until `target` are in.
+    void ensurePaths(std::uint64_t seed, int terms, int w, int h, std::uint64_t target) {
+        const DensityBuffer& fan = series_.fan();
+        if (!started_ || seed != series_.seed() || terms != series_.terms() ||
+            w != fan.width() || h != fan.height()) {
+            if (tasks_) tasks_->cancel(task_);
+            task_ = 0;
+            startPaths(seed, terms, w, h);
+        }
+        target_ = target;
+        if (series_.paths() >= target || (tasks_ && task_ && tasks_->pending(task_))) return;
+        task_ = spawnTask(tasks_, "random signs", accumulate(), this);
+    }
+
+    Task accumulate() {
+        const auto          terms  = static_cast<std::uint64_t>(series_.terms());
+        const std::uint64_t perRun = std::max<std::uint64_t>(4, kTermsPerRun / terms);
+        while (series_.paths() < target_) {
+            const auto          t0     = std::chrono::steady_clock::now();
+            const std::uint64_t before = series_.paths();
+            series_.run(std::min(perRun, target_ - series_.paths()), jobs_);
+            const std::chrono::duration<double> took = std::chrono::steady_clock::now() - t0;
+            rate_ = static_cast<double>((series_.paths() - before) * terms) / took.count();
+            co_await Checkpoint{static_cast<float>(series_.paths()) /
+                                static_cast<float>(target_)};
+        }
+    }
+};
@@ -0,0 +1,154 @@
+// ─── WizSeries: Random Harmonic Series ──────────────────────────────────────
+// Monte Carlo of Σ ±1/n with independent fair signs, which converges with
+// probability one (Σ 1/n² < ∞) to a limit with a smooth, flat-topped
+// distribution of variance π²/6.
+//
+// Path p's signs come from Philox4x32x4 keyed by the seed: counter
+// (block, p mod 2³², p / 2³², 0) gives the 128 signs of terms 128·block + 1
+// … + 128, so a path is the same whichever thread runs it or whatever else
+// ran first.
+// Four paths are summed side by side, one per vector lane, a sign applied
+// by xoring it into the float bits of 1/n.
+//
+// Two histograms are filled as paths finish:
+//   fan    partial sums S_n over (log n, S) — one count per column, so
+//          every path weighs the same across the plot — in a DensityBuffer
+//          with a slice per thread's share of the paths, merged without
+//          locks;
+//   limit  S_N over the fan's rows, so it lines up with the fan's right edge.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include "DensityBuffer.h"
+#include "JobSystem.h"
+#include "Random.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+class RandomSignSeries {
+public:
+    static constexpr float kRange    = 4.0f;   // sums binned over [−4, 4]
+    static constexpr int   kMaxTerms = 1 << 20;
+
+    /// Start over: paths of `terms` terms under `seed`, the fan in
+    /// `width`×`height` bins and the limits in `height`.
+    void reset(std::uint64_t seed, int terms, int width, int height) {
+        seed_  = seed;
+        terms_ = std::clamp(terms, 1, kMaxTerms);
+        paths_ = 0;
+        fan_.resize(width, height);
+        limits_.assign(static_cast<std::size_t>(std::max(height, 0)), 0);
+        limit_max_ = 0;
+
+        inverse_.resize(static_cast<std::size_t>(terms_));
+        for (int n = 0; n < terms_; ++n)
+            inverse_[n] = static_cast<float>(1.0 / static_cast<double>(n + 1));
+
+        // Column c shows S_n at n ≈ N^((c + 1) / width); early columns
+        // repeat the same n (a step of the path).
+        sample_terms_.resize(static_cast<std::size_t>(std::max(width, 0)));
+        const double logN = std::log(static_cast<double>(terms_));
+        for (int c = 0; c < width; ++c) {
+            const double n = std::exp(logN * (c + 1) / static_cast<double>(width));
+            sample_terms_[c] = std::clamp(static_cast<int>(std::lround(n)), 1, terms_);
+        }
+    }
+
+    /// Continue after a snapshot restored `paths` paths' worth of counts.
+    bool restore(std::span<const std::uint32_t> fan, std::span<const std::uint32_t> limits,
+                 std::uint64_t paths) {
+        if (limits.size() != limits_.size() || !fan_.assign(fan)) return false;
+        limits_.assign(limits.begin(), limits.end());
+        limit_max_ = limits_.empty() ? 0 : *std::max_element(limits_.begin(), limits_.end());
+        paths_     = paths;
+        return true;
+    }
+
+    /// Sum at least `paths` more paths (whole groups of four) into the
+    /// histograms.
+    void run(std::uint64_t paths, JobSystem* jobs) {
+        if (!fan_.bins()) return;
+        const std::uint64_t quads  = (paths + 3) / 4;
+        const std::size_t   slices = static_cast<std::size_t>(std::min<std::uint64_t>(
+            quads, jobs ? static_cast<std::uint64_t>(jobs->workerCount()) + 1 : 1));
+        fan_.prepareSlices(slices);
+        limit_slices_.resize(slices);
+        for (std::vector<std::uint32_t>& s : limit_slices_) s.assign(limits_.size(), 0);
+
+        parallelFor(jobs, 0, slices, 1, [&](std::size_t lo, std::size_t hi) {
+            for (std::size_t s = lo; s < hi; ++s)
+                for (std::uint64_t q = s * quads / slices; q < (s + 1) * quads / slices; ++q)
+                    sumPaths(paths_ + 4 * q, fan_.slice(s), limit_slices_[s]);
+        });
+        fan_.mergeSlices(slices, jobs);
+        for (std::size_t s = 0; s < slices; ++s)
+            for (std::size_t i = 0; i < limits_.size(); ++i) limits_[i] += limit_slices_[s][i];
+        limit_max_ = limits_.empty() ? 0 : *std::max_element(limits_.begin(), limits_.end());
+        paths_ += 4 * quads;
+    }
+
+    [[nodiscard]] const DensityBuffer&          fan()      const { return fan_; }
+    [[nodiscard]] std::span<const std::uint32_t> limits()   const { return limits_; }
+    [[nodiscard]] std::uint32_t                  limitMax() const { return limit_max_; }
+    [[nodiscard]] std::uint64_t                  paths()    const { return paths_; }
+    [[nodiscard]] int                            terms()    const { return terms_; }
+    [[nodiscard]] std::uint64_t                  seed()     const { return seed_; }
+
+private:
+    std::uint64_t                           seed_  = 0;
+    int                                     terms_ = 0;
+    std::uint64_t                           paths_ = 0;
+    DensityBuffer                           fan_;
+    std::vector<std::uint32_t>              limits_;
+    std::vector<std::vector<std::uint32_t>> limit_slices_;
+    std::uint32_t                           limit_max_ = 0;
+    std::vector<float>                      inverse_;        // 1/n for n = 1 … N
+    std::vector<int>                        sample_terms_;   // n shown in each fan column
+
+    /// Paths p … p + 3, one per lane, binned into `fan` and `limits`.
+    void sumPaths(std::uint64_t p, std::span<std::uint32_t> fan,
+                  std::vector<std::uint32_t>& limits) const {
+        const int   w     = fan_.width();
+        const int   h     = fan_.height();
+        const float scale = static_cast<float>(h) / (2.0f * kRange);
+        const auto  path  = static_cast<std::uint32_t>(p);
+
+        Philox4x32x4::Block ctr{};
+        ctr.w[1] = u32x4{path, path + 1, path + 2, path + 3};
+        ctr.w[2] = u32x4{} + static_cast<std::uint32_t>(p >> 32);
+
+        f32x4 sum{};
+        int   column = 0;
+        auto  bin    = [&](f32x4 s) {
+            const f32x4 fy = (s + kRange) * scale;
+            for (int lane = 0; lane < 4; ++lane)
+                if (fy[lane] >= 0.0f && fy[lane] < static_cast<float>(h))
+                    ++fan[static_cast<std::size_t>(fy[lane]) * w + column];
+        };
+
+        for (int n = 0; n < terms_;) {
+            ctr.w[0] = u32x4{} + static_cast<std::uint32_t>(n / 128);
+            const Philox4x32x4::Block signs = Philox4x32x4::generate(ctr, seed_);
+            for (int j = 0; j < 4 && n < terms_; ++j) {
+                u32x4 bits = signs.w[j];
+                for (int b = 0; b < 32 && n < terms_; ++b, ++n) {
+                    const u32x4 term = std::bit_cast<u32x4>(f32x4{} + inverse_[n]);
+                    sum += std::bit_cast<f32x4>(term ^ (bits << 31));
+                    bits >>= 1;
+                    for (; column < w && sample_terms_[column] == n + 1; ++column) bin(sum);
+                }
+            }
+        }
+
+        const f32x4 fy = (sum + kRange) * scale;
+        for (int lane = 0; lane < 4; ++lane)
+            if (fy[lane] >= 0.0f && fy[lane] < static_cast<float>(h))
+                ++limits[static_cast<std::size_t>(fy[lane])];
+    }
+};
@@ -0,0 +1,108 @@
+// ─── WizSeries: Range Min/Max ───────────────────────────────────────────────
+// Constant-time min/max over any index range of a float array, for
+// autoscaling and decimating whatever slice of a long series is on screen.
+//
+// The array is cut into kBlock-value blocks.  A sparse table over the block
+// extents answers the whole-block middle of a query with two overlapping
+// lookups; the partial blocks at either end are scanned directly (at most
+// 2·kBlock values).  Memory is ~(n / kBlock)·log2(n / kBlock) pairs — about
+// 10 MB at 10⁷ values — instead of the n·log2 n of a plain sparse table.
+//
+// The values stay owned by the caller.  update() re-binds them after they
+// grow or shrink and rebuilds only the table entries the changed blocks
+// touch, so a series extended term by term stays cheap to index.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+struct ValueRange {
+    float min = 0.0f;
+    float max = 0.0f;
+
+    void include(const ValueRange& o) {
+        min = std::min(min, o.min);
+        max = std::max(max, o.max);
+    }
+};
+
+class RangeMinMax {
+public:
+    static constexpr std::size_t kBlock = 128;
+
+    [[nodiscard]] std::size_t size() const { return values_.size(); }
+
+    /// Index `values`, which keep the prefix last passed here unless
+    /// `restart` (e.g. the series was recomputed from scratch).  The span
+    /// must stay valid until the next update().
+    void update(std::span<const float> values, bool restart = false) {
+        const std::size_t kept = restart ? 0 : std::min(values_.size(), values.size());
+        values_ = values;
+        rebuild(kept / kBlock);
+    }
+
+    /// Min and max of values [lo, hi); hi is clamped to size().  An empty
+    /// range yields {0, 0}.
+    [[nodiscard]] ValueRange query(std::size_t lo, std::size_t hi) const {
+        hi = std::min(hi, values_.size());
+        if (lo >= hi) return {};
+
+        const std::size_t bLo = (lo + kBlock - 1) / kBlock;   // first whole block
+        const std::size_t bHi = hi / kBlock;                  // one past the last
+        if (bLo >= bHi) return scan(lo, hi);
+
+        ValueRange r = blocks(bLo, bHi);
+        if (lo < bLo * kBlock) r.include(scan(lo, bLo * kBlock));
+        if (hi > bHi * kBlock) r.include(scan(bHi * kBlock, hi));
+        return r;
+    }
+
+private:
+    std::span<const float> values_;
+    // levels_[j][b]: extent of blocks [b, b + 2^j); level 0 covers partial
+    // trailing blocks too.
+    std::vector<std::vector<ValueRange>> levels_;
+
+    ValueRange scan(std::size_t lo, std::size_t hi) const {
+        const auto sub      = values_.subspan(lo, hi - lo);
+        const auto [mn, mx] = std::minmax_element(sub.begin(), sub.end());
+        return {*mn, *mx};
+    }
+
+    ValueRange blocks(std::size_t lo, std::size_t hi) const {
+        const auto j = static_cast<std::size_t>(std::bit_width(hi - lo) - 1);
+        ValueRange r = levels_[j][lo];
+        r.include(levels_[j][hi - (std::size_t{1} << j)]);
+        return r;
+    }
+
+    /// Recompute every table entry covering block `first` or later.
+    void rebuild(std::size_t first) {
+        const std::size_t n = (values_.size() + kBlock - 1) / kBlock;
+        const auto depth    = n ? static_cast<std::size_t>(std::bit_width(n)) : 0;
+        levels_.resize(depth);
+        if (!depth) return;
+
+        levels_[0].resize(n);
+        for (std::size_t b = first; b < n; ++b)
+            levels_[0][b] = scan(b * kBlock, std::min(values_.size(), (b + 1) * kBlock));
+
+        for (std::size_t j = 1; j < depth; ++j) {
+            const std::size_t span  = std::size_t{1} << j;
+            const std::size_t count = n - span + 1;
+            std::vector<ValueRange>&       cur  = levels_[j];
+            const std::vector<ValueRange>& prev = levels_[j - 1];
+            cur.resize(count);
+            // Entries starting before `first` are stale only if they reach it.
+            const std::size_t from = first >= span ? first - span + 1 : 0;
+            for (std::size_t b = from; b < count; ++b) {
+                cur[b] = prev[b];
+                cur[b].include(prev[b + span / 2]);
+            }
+        }
+    }
+};
@@ -0,0 +1,132 @@
+// ─── WizSeries: Riemann Rearrangement ───────────────────────────────────────
+// Riemann's rearrangement theorem: the terms of a conditionally convergent
+// series can be reordered to sum to any target T.  For the alternating
+// harmonic series the greedy order does it — take the next unused positive
+// term 1/(2p + 1) while the sum is at most T, otherwise the next unused
+// negative term −1/(2q + 2) — since the sum then crosses T infinitely often
+// by ever smaller steps.
+//
+// Terms stream out in order from O(1) state (p, q and the compensated sum),
+// so any number are generated a chunk at a time into the caller's buffer.
+// Every kSegment terms the state is checkpointed, with the least and
+// greatest sum the segment decided on.  Decisions under T and T′ first
+// differ at a sum lying between the two, so retarget() skips the segments
+// whose sums stay clear of that band, replays the first that might not from
+// its checkpoint, and stops the stream at the first sum inside: moving the
+// target regenerates only the tail, and the terms match a fresh run at the
+// new target bit for bit.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include "PartialSumScan.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+class Rearrangement {
+public:
+    static constexpr std::size_t kSegment = 4096;   // terms per checkpoint
+
+    explicit Rearrangement(double target = 0.0) : target_(target) {}
+
+    /// Aim the terms at `target`, keeping those it would have chosen the
+    /// same: the stream stops before the first sum between the old target
+    /// and the new.
+    void retarget(double target) {
+        if (target == target_) return;
+        const double lo  = std::min(target, target_);
+        const double hi  = std::max(target, target_);
+        const double old = target_;
+        target_ = target;
+
+        // A sum decides alike for both targets unless lo < sum ≤ hi.
+        for (std::size_t s = 0; s < segments_.size(); ++s) {
+            if (segments_[s].max <= lo || segments_[s].min > hi) continue;
+            Segment           seg  = {segments_[s].start, kEmpty, -kEmpty};
+            const std::size_t stop = std::min(position_, (s + 1) * kSegment);
+            for (std::size_t at = s * kSegment; at < stop; ++at) {
+                const double sum = seg.start.sum.sum();
+                if (lo < sum && sum <= hi) {
+                    state_    = seg.start;
+                    position_ = at;
+                    seg.start = segments_[s].start;
+                    segments_.resize(s);
+                    segments_.push_back(seg);
+                    return;
+                }
+                seg.min = std::min(seg.min, sum);
+                seg.max = std::max(seg.max, sum);
+                advance(seg.start, old);
+            }
+        }
+    }
+
+    /// Go back to `terms` terms in, if the stream is further along, and
+    /// return where it now stands.
+    std::size_t seek(std::size_t terms) {
+        if (terms >= position_) return position_;
+        const std::size_t s = terms / kSegment;
+        state_    = segments_[s].start;
+        position_ = s * kSegment;
+        segments_.resize(s);
+        std::vector<float> replay(terms - position_);
+        generate(replay);
+        return position_;
+    }
+
+    /// The next `out.size()` terms.
+    void generate(std::span<float> out) {
+        for (float& term : out) {
+            if (segments_.size() == position_ / kSegment)
+                segments_.push_back({state_, kEmpty, -kEmpty});
+            Segment&     seg = segments_.back();
+            const double sum = state_.sum.sum();
+            seg.min = std::min(seg.min, sum);
+            seg.max = std::max(seg.max, sum);
+            term = static_cast<float>(advance(state_, target_));
+            ++position_;
+        }
+    }
+
+    [[nodiscard]] double        target()    const { return target_; }
+    [[nodiscard]] std::size_t   position()  const { return position_; }
+    [[nodiscard]] double        sum()       const { return state_.sum.sum(); }
+    [[nodiscard]] std::uint64_t positives() const { return state_.positives; }
+    [[nodiscard]] std::uint64_t negatives() const { return state_.negatives; }
+
+private:
+    struct State {
+        std::uint64_t positives = 0;   // 1, 1/3, 1/5 … taken
+        std::uint64_t negatives = 0;   // −1/2, −1/4 … taken
+        ScanCarry     sum;
+    };
+
+    struct Segment {
+        State  start;
+        double min;   // of the sums deciding its terms
+        double max;
+    };
+
+    static constexpr double kEmpty = std::numeric_limits<double>::infinity();
+
+    double               target_;
+    State                state_;
+    std::size_t          position_ = 0;
+    std::vector<Segment> segments_;
+
+    /// Take the next term for `target` into `st` and return it.
+    static double advance(State& st, double target) {
+        const double t = st.sum.sum() <= target
+            ?  1.0 / static_cast<double>(2 * st.positives++ + 1)
+            : -1.0 / static_cast<double>(2 * st.negatives++ + 2);
+        const double s  = st.sum.hi + t;   // Knuth TwoSum
+        const double bb = s - st.sum.hi;
+        st.sum.lo += (st.sum.hi - (s - bb)) + (t - bb);
+        st.sum.hi  = s;
+        return t;
+    }
+};
@@ -0,0 +1,246 @@
+// ─── WizSeries: Recording Renderer ──────────────────────────────────────────
+// IRenderer that only captures draw calls into one contiguous vertex array.
+// Running a visualizer against it measures pure CPU geometry cost, and the
+// captured frame can be replayed into any other renderer afterwards.
+//
+// Typed draws (series data, bifurcation, Lyapunov, density) are recorded
+// too when setTypedDraws() says the replay target takes them; otherwise
+// they are refused and the visualizer draws vertices as usual.  The arrays
+// they point into are copied, since the visualizer may change them before
+// the replay: an owner's arrays only grow while its revision stays the
+// same, so recorders sharing their copies (shareCopies()) append to the
+// last frame's copy rather than copy every frame.  A target that refuses a
+// recorded draw on replay (e.g. GLRenderer failing its bifurcation check)
+// loses that part of the one frame; the next recording sees it refuse.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include "IRenderer.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+class RecordingRenderer : public IRenderer {
+public:
+    enum class Op { Vertices, SeriesData, Bifurcation, Lyapunov, Density };
+
+    struct Command {
+        Op          op;
+        Primitive   mode;
+        std::size_t first;       // Vertices: first vertex; else index into its draws
+        std::size_t count;
+        float       pointSize;
+        int         layer;
+    };
+
+    void beginFrame(float width, float height) override {
+        width_  = width;
+        height_ = height;
+        verts_.clear();
+        commands_.clear();
+        series_.clear();
+        bifurcations_.clear();
+        lyapunovs_.clear();
+        densities_.clear();
+        copies_->nextFrame();
+    }
+
+    /// Record the typed draws `support` allows instead of refusing them.
+    void setTypedDraws(TypedDrawSupport support) { support_ = support; }
+
+    [[nodiscard]] TypedDrawSupport typedDraws() const override { return support_; }
+
+    /// Keep array copies with `other`, so either can extend the last copy.
+    /// Both must record on one thread at a time.
+    void shareCopies(const RecordingRenderer& other) { copies_ = other.copies_; }
+
+    /// Issue the captured frame on `target`, including beginFrame/endFrame.
+    void replay(IRenderer& target) const {
+        target.beginFrame(width_, height_);
+        replayDraws(target);
+        target.endFrame();
+    }
+
+    /// Issue only the captured draw calls (caller brackets the frame).
+    void replayDraws(IRenderer& target) const {
+        for (const Command& c : commands_) {
+            target.setLayer(c.layer);
+            switch (c.op) {
+                case Op::Vertices:
+                    target.submit(c.mode,
+                                  std::span<const Vertex>(verts_).subspan(c.first, c.count),
+                                  c.pointSize);
+                    break;
+                case Op::SeriesData: {
+                    const SeriesCopy& s = series_[c.first];
+                    SeriesDataDraw    d = s.draw;
+                    d.terms = s.terms.view();
+                    d.sums  = s.sums.view();
+                    target.drawSeriesData(d);
+                    break;
+                }
+                case Op::Bifurcation:
+                    target.drawBifurcation(bifurcations_[c.first]);
+                    break;
+                case Op::Lyapunov:
+                    target.drawLyapunov(lyapunovs_[c.first]);
+                    break;
+                case Op::Density: {
+                    const DensityCopy& s = densities_[c.first];
+                    DensityDraw        d = s.draw;
+                    d.counts = s.counts.view();
+                    target.drawDensity(d);
+                    break;
+                }
+            }
+        }
+    }
+
+    bool drawSeriesData(const SeriesDataDraw& d) override {
+        if (!support_.seriesData) return false;
+        // Terms and sums share the owner's revision; the key keeps them apart.
+        SeriesCopy s{d, copies_->floats.hold(d.source * 2, d.revision, d.terms),
+                     copies_->floats.hold(d.source * 2 + 1, d.revision, d.sums)};
+        s.draw.terms = {};
+        s.draw.sums  = {};
+        record(Op::SeriesData, series_.size());
+        series_.push_back(std::move(s));
+        return true;
+    }
+
+    bool drawBifurcation(const BifurcationDraw& d) override {
+        if (!support_.bifurcation) return false;
+        record(Op::Bifurcation, bifurcations_.size());
+        bifurcations_.push_back(d);
+        return true;
+    }
+
+    bool drawLyapunov(const LyapunovDraw& d) override {
+        if (!support_.lyapunov) return false;
+        record(Op::Lyapunov, lyapunovs_.size());
+        lyapunovs_.push_back(d);
+        return true;
+    }
+
+    bool drawDensity(const DensityDraw& d) override {
+        if (!support_.density) return false;
+        DensityCopy s{d, copies_->counts.hold(d.source, d.revision, d.counts)};
+        s.draw.counts = {};
+        record(Op::Density, densities_.size());
+        densities_.push_back(std::move(s));
+        return true;
+    }
+
+    [[nodiscard]] const std::vector<Command>& commands() const { return commands_; }
+    [[nodiscard]] std::size_t vertexCount() const { return verts_.size(); }
+    [[nodiscard]] float width()  const { return width_; }
+    [[nodiscard]] float height() const { return height_; }
+
+protected:
+    void draw(std::span<const Vertex> verts, Primitive mode,
+              float pointSize) override {
+        commands_.push_back({Op::Vertices, mode, verts_.size(), verts.size(), pointSize, layer_});
+        verts_.insert(verts_.end(), verts.begin(), verts.end());
+    }
+
+private:
+    /// One owner's array as of some revision.  Only the recording thread
+    /// writes it, past the `size` any recorded draw already reads.
+    template <typename T>
+    struct Block {
+        std::uint64_t        key      = 0;
+        std::uint64_t        revision = 0;
+        std::unique_ptr<T[]> data;
+        std::size_t          capacity = 0;
+        std::size_t          size     = 0;
+        std::uint64_t        used     = 0;   // frame it was last held in
+    };
+
+    /// A recorded draw's view of a block: its first `size` elements.
+    template <typename T>
+    struct Held {
+        std::shared_ptr<const Block<T>> block;
+        std::size_t                     size = 0;
+
+        [[nodiscard]] std::span<const T> view() const {
+            return size ? std::span<const T>(block->data.get(), size) : std::span<const T>();
+        }
+    };
+
+    /// The latest block per owner, dropped once a frame goes by without it.
+    template <typename T>
+    class Blocks {
+    public:
+        Held<T> hold(std::uint64_t key, std::uint64_t revision, std::span<const T> values) {
+            auto it = std::find_if(blocks_.begin(), blocks_.end(),
+                                   [key](const auto& b) { return b->key == key; });
+            if (it == blocks_.end()) it = blocks_.insert(blocks_.end(), nullptr);
+            std::shared_ptr<Block<T>>& b = *it;
+            const std::size_t n = values.size();
+            if (!b || b->revision != revision || n < b->size || n > b->capacity) {
+                // Grow geometrically while the revision holds, so appends stay O(new).
+                const bool grow = b && b->revision == revision && n > b->size;
+                auto       next = std::make_shared<Block<T>>();
+                next->key      = key;
+                next->revision = revision;
+                next->capacity = grow ? std::max(n, 2 * b->capacity) : n;
+                next->data     = std::unique_ptr<T[]>(new T[next->capacity]);
+                b = std::move(next);
+            }
+            std::copy(values.begin() + static_cast<std::ptrdiff_t>(std::min(b->size, n)),
+                      values.end(), b->data.get() + std::min(b->size, n));
+            b->size = std::max(b->size, n);
+            b->used = frame_;
+            return {b, n};
+        }
+
+        void nextFrame() {
+            std::erase_if(blocks_, [this](const auto& b) { return b->used + 1 < frame_; });
+            ++frame_;
+        }
+
+    private:
+        std::vector<std::shared_ptr<Block<T>>> blocks_;
+        std::uint64_t                          frame_ = 1;
+    };
+
+    struct Copies {
+        Blocks<float>         floats;
+        Blocks<std::uint32_t> counts;
+
+        void nextFrame() {
+            floats.nextFrame();
+            counts.nextFrame();
+        }
+    };
+
+    struct SeriesCopy {
+        SeriesDataDraw draw;
+        Held<float>    terms;
+        Held<float>    sums;
+    };
+
+    struct DensityCopy {
+        DensityDraw         draw;
+        Held<std::uint32_t> counts;
+    };
+
+    std::vector<Vertex>          verts_;
+    std::vector<Command>         commands_;
+    std::vector<SeriesCopy>      series_;
+    std::vector<BifurcationDraw> bifurcations_;
+    std::vector<LyapunovDraw>    lyapunovs_;
+    std::vector<DensityCopy>     densities_;
+    TypedDrawSupport             support_;
+    std::shared_ptr<Copies>      copies_ = std::make_shared<Copies>();
+    float width_  = 0.0f;
+    float height_ = 0.0f;
+
+    void record(Op op, std::size_t index) {
+        commands_.push_back({op, Primitive::Points, index, 1, 1.0f, layer_});
+    }
+};
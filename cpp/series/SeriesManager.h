@@ -1,46 +1,50 @@
 // ─── WizSeries: Central Manager ─────────────────────────────────────────────
-// Owns the WebGL context, the shared GLRenderer, and all visualizer instances.
-// Exposed to JavaScript via Emscripten embind.
+// Owns the WebGL context, the shared GLRenderer, the engine-wide JobSystem,
+// the incremental TaskScheduler and all visualizer instances.
+// Exposed to JavaScript via Emscripten embind.  Also builds natively against
+// any current GLES 3 context (see tools/HeadlessGL.h) for benchmarking.
 // ─────────────────────────────────────────────────────────────────────────────
 #pragma once
 
-#include "ISeriesVisualizer.h"
-#include "AlternatingHarmonicVisualizer.h"
-#include "AperyConstantVisualizer.h"
-#include "BaselProblemVisualizer.h"
-#include "CantorSetVisualizer.h"
-#include "ESeriesVisualizer.h"
-#include "GeometricProgressionVisualizer.h"
-#include "GregoryLeibnizVisualizer.h"
-#include "HarmonicProgressionVisualizer.h"
-#include "InverseGeometricVisualizer.h"
-#include "LogisticMapVisualizer.h"
+#include "FramePipeline.h"
+#include "GLRenderer.h"
+#include "PartialSumExport.h"
+#include "Snapshot.h"
+#include "StatsWriter.h"
+#include "VisualizerRegistry.h"
 
+#ifdef __EMSCRIPTEN__
 #include <emscripten.h>
 #include <emscripten/html5.h>
+#endif
 
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 class SeriesManager {
 public:
     SeriesManager() {
-        visualizers_["cantor"]       = std::make_unique<CantorSetVisualizer>();
-        visualizers_["harmonic"]     = std::make_unique<HarmonicProgressionVisualizer>();
-        visualizers_["geometric"]    = std::make_unique<GeometricProgressionVisualizer>();
-        visualizers_["logistic"]     = std::make_unique<LogisticMapVisualizer>();
-        visualizers_["basel"]        = std::make_unique<BaselProblemVisualizer>();
-        visualizers_["alt_harmonic"] = std::make_unique<AlternatingHarmonicVisualizer>();
-        visualizers_["e_series"]     = std::make_unique<ESeriesVisualizer>();
-        visualizers_["inv_geometric"]= std::make_unique<InverseGeometricVisualizer>();
-        visualizers_["gregory_leibniz"] = std::make_unique<GregoryLeibnizVisualizer>();
-        visualizers_["apery"]        = std::make_unique<AperyConstantVisualizer>();
+        for (const auto& entry : visualizerRegistry()) {
+            visualizers_[entry.name] = entry.create();
+            visualizers_[entry.name]->attachJobs(&jobs_);
+            visualizers_[entry.name]->attachTasks(&tasks_);
+        }
         active_ = "cantor";
+        tasks_.focus(visualizers_[active_].get());
     }
 
     /// Create a WebGL 2 context on the given canvas and compile shaders.
+    /// Natively `canvasId` is ignored and the caller's current GLES 3
+    /// context is used.
     bool initGL(const std::string& canvasId) {
+#ifdef __EMSCRIPTEN__
         const std::string selector = "#" + canvasId;
 
         EmscriptenWebGLContextAttributes attrs;
@@ -55,6 +59,9 @@ public:
         if (ctx_ <= 0) return false;
 
         emscripten_webgl_make_context_current(ctx_);
+#else
+        (void)canvasId;
+#endif
 
         if (!renderer_.init()) return false;
 
@@ -62,30 +69,68 @@ public:
         return true;
     }
 
-    /// Drive one frame of the active visualizer.
+    /// Drive one frame of the active visualizer, then resume pending tasks
+    /// for what is left of the frame budget.
     void render(float time, float width, float height) {
-        if (!ready_ || ctx_ <= 0) return;
+        if (!ready_) return;
+#ifdef __EMSCRIPTEN__
+        if (ctx_ <= 0) return;
         emscripten_webgl_make_context_current(ctx_);
+#endif
 
-        renderer_.beginFrame(width, height);
+        const auto t0 = std::chrono::steady_clock::now();
 
+        renderer_.setFrameTime(time);
         auto it = visualizers_.find(active_);
-        if (it != visualizers_.end()) {
+        if (it == visualizers_.end()) {
+            renderer_.beginFrame(width, height);
+            renderer_.endFrame();
+        } else if (pipeline_.depth() > 1) {
+            pipeline_.frame(*it->second, time, width, height, renderer_);
+        } else {
+            renderer_.beginFrame(width, height);
             it->second->render(time, width, height, renderer_);
+            renderer_.endFrame();
+        }
+        last_render_ms_ = std::chrono::duration<double, std::milli>(
+                              std::chrono::steady_clock::now() - t0).count();
+        ++frames_;
+
+        if (!tasks_.idle()) {
+            pipeline_.waitIdle();   // tasks write state the producer reads
+            tasks_.run(std::max(frame_budget_ms_ - last_render_ms_, kMinTaskSliceMs));
         }
     }
 
-    /// Switch the active visualizer by key name.
+    /// Switch the active visualizer by key name.  The tasks of the others
+    /// pause until they are active again.
     void setActiveVisualizer(const std::string& name) {
-        if (visualizers_.count(name)) active_ = name;
+        if (!visualizers_.count(name)) return;
+        pipeline_.reset();
+        active_ = name;
+        tasks_.focus(visualizers_[active_].get());
     }
 
     [[nodiscard]] std::string getActiveVisualizer() const { return active_; }
 
+    /// Y extent the active plot last autoscaled to (0 if it has none).
+    [[nodiscard]] float getPlotScale() const {
+        auto it = visualizers_.find(active_);
+        return it != visualizers_.end() ? it->second->plotYScale() : 0.0f;
+    }
+
+    /// Values the active visualizer computed for its labels, as JSON.
+    [[nodiscard]] std::string getPlotReadout() const {
+        auto it = visualizers_.find(active_);
+        return it != visualizers_.end() ? it->second->plotReadout() : "null";
+    }
+
     /// Forward a named parameter to the *active* visualizer.
     void setParam(const std::string& name, float value) {
         auto it = visualizers_.find(active_);
-        if (it != visualizers_.end()) it->second->setParam(name, value);
+        if (it == visualizers_.end()) return;
+        pipeline_.drain();
+        it->second->setParam(name, value);
     }
 
     /// Set the horizontal pan/zoom view transform.
@@ -93,11 +138,235 @@ public:
         renderer_.setView(scale, offsetX);
     }
 
+    /// Select the vertex streaming strategy (index into StreamMode:
+    /// 0 bufferdata, 1 orphan, 2 subdata, 3 ring).
+    void setStreamMode(int mode) {
+        if (mode >= 0 && mode <= static_cast<int>(StreamMode::Ring))
+            renderer_.setStreamMode(static_cast<StreamMode>(mode));
+    }
+
+    /// Merge each frame's draws into one upload and a few batched draws
+    /// (default), or upload and draw every call separately.
+    void setBatching(bool on) { renderer_.setBatching(on); }
+
+    /// Draw series plots from data textures on the GPU (default) or from
+    /// vertices built on the CPU.
+    void setVertexPulling(bool on) { renderer_.setVertexPulling(on); }
+
+    /// Compute bifurcation diagrams in a vertex shader (default) or iterate
+    /// them on the CPU.
+    void setGpuBifurcation(bool on) { renderer_.setGpuBifurcation(on); }
+
+    /// Frames of compute/render overlap: 1 renders synchronously, 2 double-
+    /// and 3 triple-buffers geometry (adding depth − 1 frames of latency).
+    void setPipelineDepth(int depth) { pipeline_.setDepth(depth); }
+
+    /// Milliseconds per frame shared by rendering and incremental tasks;
+    /// tasks get the remainder (at least kMinTaskSliceMs).
+    void setFrameBudget(float ms) { frame_budget_ms_ = std::max(0.0, static_cast<double>(ms)); }
+
+    /// Counters for the last rendered frame as a JSON object string.
+    [[nodiscard]] std::string getStats() const {
+        const RenderStats&     rs = renderer_.lastFrameStats();
+        const JobSystem::Stats js = jobs_.stats();
+        const FramePipeline::Stats& ps = pipeline_.stats();
+        const TaskScheduler::Stats  ts = tasks_.stats();
+        const ISeriesVisualizer::PointStats pt = pointStats();
+        return StatsWriter()
+            .field("frames",      frames_)
+            .field("visualizer",  active_)
+            .field("renderMs",    last_render_ms_)
+            .field("streamMode",  streamModeName(renderer_.streamMode()))
+            .field("vertexPulling", renderer_.vertexPulling())
+            .field("batching",    renderer_.batching())
+            .field("gpuBifurcation", renderer_.gpuBifurcation())
+            .field("drawCalls",   rs.drawCalls)
+            .field("uploads",     rs.uploads)
+            .field("uploadBytes", rs.uploadBytes)
+            .field("uploadMs",    rs.uploadMs)
+            .field("drawMs",      rs.drawMs)
+            .field("glCalls",     rs.glCalls)
+            .field("glElided",    rs.glElided)
+            .field("restoreMs",   last_restore_ms_)
+            .field("jobWorkers",  js.workers)
+            .field("jobsRun",     js.executed)
+            .field("jobSteals",   js.steals)
+            .field("pipelineDepth",  ps.depth)
+            .field("latencyFrames",  ps.latencyFrames)
+            .field("latencyMs",      ps.latencyMs)
+            .field("produceMs",      ps.produceMs)
+            .field("fenceWaitMs",    ps.fenceWaitMs)
+            .field("repeatedFrames", ps.repeats)
+            .field("tasksPending",   ts.pending)
+            .field("tasksPaused",    ts.paused)
+            .field("tasksDone",      ts.completed)
+            .field("tasksCancelled", ts.cancelled)
+            .field("taskMs",         ts.lastMs)
+            .field("taskProgress",   static_cast<double>(ts.progress))
+            .field("taskName",       ts.slowest)
+            .field("points",         pt.points)
+            .field("pointsPerSec",   pt.perSecond)
+            .raw("dataflow",         dataflowJson())
+            .str();
+    }
+
+    /// Stream `terms` rows of (index, term, partial sum, error) for the series
+    /// with visualizer key `series` to `sink`, `chunkRows` rows at a time.
+    /// `format`: 0 binary float64 SoA, 1 CSV.  Geometric uses the ratio
+    /// currently set on its visualizer.  Returns a JSON summary.
+    std::string exportPartialSums(const std::string& series, double terms, int format,
+                                  int chunkRows, const ChunkSink& sink) {
+        const SeriesInfo* info = findSeries(series);
+        if (!info || !(terms >= 0.0))
+            return StatsWriter().field("error", "unknown series or bad term count").str();
+
+        double ratio = 0.0;
+        if (auto it = visualizers_.find(series); it != visualizers_.end())
+            ratio = it->second->getParam("ratio", 0.0f);
+
+        PartialSumScan scan(info->kind, ratio);
+        PartialSumExporter exporter(format == 1 ? ExportFormat::Csv : ExportFormat::Binary,
+                                    static_cast<std::uint32_t>(std::max(chunkRows, 1)));
+        const ExportResult r =
+            exporter.run(scan, static_cast<std::uint64_t>(terms), sink, &jobs_);
+        return StatsWriter()
+            .field("rows",      r.rows)
+            .field("bytes",     r.bytes)
+            .field("chunks",    r.chunks)
+            .field("cancelled", r.cancelled)
+            .field("ms",        r.ms)
+            .str();
+    }
+
+    // ── Snapshots ────────────────────────────────────────────────────────────
+    // Blob layout (little-endian):
+    //   u32 magic "WZSS", u16 version, u16 flags
+    //   f32 view scale, f32 view offset, str active
+    //   u32 visualizer count, then per visualizer:
+    //     str key, u32 param count, (str name, f32 value)…, u32 cache bytes, cache
+    // Strings are u32 length + UTF-8.  Caches are opaque per visualizer.
+
+    static constexpr std::uint32_t kSnapshotMagic   = 0x5353'5A57;   // "WZSS"
+    static constexpr std::uint16_t kSnapshotVersion = 1;
+    static constexpr std::uint16_t kSnapshotCaches  = 1u << 0;
+
+    /// Capture params, view and active visualizer; with `includeCaches`
+    /// also each visualizer's computed caches.
+    [[nodiscard]] std::vector<std::uint8_t> serialize(bool includeCaches) {
+        pipeline_.drain();   // caches may be mid-update on the producer
+        BlobWriter out;
+        out.put(kSnapshotMagic);
+        out.put(kSnapshotVersion);
+        out.put(static_cast<std::uint16_t>(includeCaches ? kSnapshotCaches : 0));
+        out.put(renderer_.viewScale());
+        out.put(renderer_.viewOffset());
+        out.putString(active_);
+
+        out.put(static_cast<std::uint32_t>(visualizers_.size()));
+        for (const auto& entry : visualizerRegistry()) {
+            const ISeriesVisualizer& viz = *visualizers_.at(entry.name);
+            out.putString(entry.name);
+
+            // Sorted so identical state always yields identical blobs.
+            std::vector<std::pair<std::string, float>> params(viz.params().begin(),
+                                                              viz.params().end());
+            std::sort(params.begin(), params.end());
+            out.put(static_cast<std::uint32_t>(params.size()));
+            for (const auto& [name, value] : params) {
+                out.putString(name);
+                out.put(value);
+            }
+
+            const std::size_t sizeAt = out.placeholder();
+            if (includeCaches) viz.saveCache(out);
+            out.patch(sizeAt, static_cast<std::uint32_t>(out.size() - sizeAt - 4));
+        }
+        return std::move(out.bytes());
+    }
+
+    /// Restore a blob from serialize().  Nothing is applied unless the whole
+    /// blob parses; unknown visualizers are skipped and unusable caches are
+    /// dropped (that visualizer recomputes).  Timing lands in getStats().
+    bool deserialize(std::span<const std::uint8_t> blob) {
+        const auto t0 = std::chrono::steady_clock::now();
+        BlobReader in(blob);
+        if (in.get<std::uint32_t>() != kSnapshotMagic ||
+            in.get<std::uint16_t>() != kSnapshotVersion)
+            return false;
+        in.get<std::uint16_t>();   // flags: informational, caches are self-sized
+
+        const auto  scale  = in.get<float>();
+        const auto  offset = in.get<float>();
+        std::string active = in.getString();
+
+        struct Entry {
+            ISeriesVisualizer* viz;
+            std::vector<std::pair<std::string, float>> params;
+            BlobReader cache;
+        };
+        std::vector<Entry> entries;
+        const auto count = in.get<std::uint32_t>();
+        for (std::uint32_t i = 0; i < count && in.ok(); ++i) {
+            const std::string key = in.getString();
+            auto it = visualizers_.find(key);
+            Entry e{it != visualizers_.end() ? it->second.get() : nullptr, {}, BlobReader({})};
+            const auto nParams = in.get<std::uint32_t>();
+            for (std::uint32_t p = 0; p < nParams && in.ok(); ++p) {
+                std::string name = in.getString();
+                e.params.emplace_back(std::move(name), in.get<float>());
+            }
+            e.cache = in.section(in.get<std::uint32_t>());
+            if (e.viz) entries.push_back(std::move(e));
+        }
+        if (!in.ok()) return false;
+
+        pipeline_.reset();
+        renderer_.setView(scale, offset);
+        if (visualizers_.count(active)) active_ = std::move(active);
+        tasks_.focus(visualizers_[active_].get());
+        for (Entry& e : entries) {
+            for (const auto& [name, value] : e.params) e.viz->setParam(name, value);
+            if (e.cache.remaining() > 0) e.viz->loadCache(e.cache);
+        }
+
+        last_restore_ms_ = std::chrono::duration<double, std::milli>(
+                               std::chrono::steady_clock::now() - t0).count();
+        return true;
+    }
+
 private:
+    /// Stage report of the frame on screen: pipelined frames carry their own
+    /// copy, since the producer may already be rebuilding the next one.
+    [[nodiscard]] std::string dataflowJson() const {
+        if (pipeline_.depth() > 1) return pipeline_.stats().dataflow;
+        auto it = visualizers_.find(active_);
+        return it != visualizers_.end() ? it->second->dataflowJson() : "null";
+    }
+
+    /// Point progress of the frame on screen, copied like the stage report:
+    /// the producer and incremental tasks write the counts it reads.
+    [[nodiscard]] ISeriesVisualizer::PointStats pointStats() const {
+        if (pipeline_.depth() > 1) return pipeline_.stats().points;
+        auto it = visualizers_.find(active_);
+        return it != visualizers_.end() ? it->second->pointStats()
+                                        : ISeriesVisualizer::PointStats{};
+    }
+
+    static constexpr double kMinTaskSliceMs = 1.0;
+
+    JobSystem     jobs_;    // declared first: outlives every visualizer using it
+    TaskScheduler tasks_;
     std::unordered_map<std::string, std::unique_ptr<ISeriesVisualizer>>
         visualizers_;
+    FramePipeline pipeline_{jobs_};   // declared after: drains before they go
     std::string active_;
     GLRenderer  renderer_;
+#ifdef __EMSCRIPTEN__
     EMSCRIPTEN_WEBGL_CONTEXT_HANDLE ctx_ = 0;
-    bool ready_ = false;
+#endif
+    bool          ready_           = false;
+    std::uint64_t frames_          = 0;
+    double        last_render_ms_  = 0.0;
+    double        last_restore_ms_ = 0.0;
+    double        frame_budget_ms_ = 12.0;   // 60 Hz less compositor slack
 };
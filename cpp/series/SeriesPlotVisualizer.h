@@ -0,0 +1,624 @@
+// ─── WizSeries: Series Plot Base ────────────────────────────────────────────
+// Shared renderer for the "bars + running partial-sum line" visualizers.
+// The frame is built by a DataflowGraph so only stale stages recompute:
+//
+//   terms    [terms, shape]      term values; extended in place when only
+//                                the count grows
+//   sums     ← terms             running sums, extended likewise
+//   extent   ← terms, sums       range min/max index over both (RangeMinMax.h)
+//   scale    ← extent  [@from, @to]   y extent of the visible window (early
+//                                cutoff when unchanged)
+//   frame    ← scale             gridlines, axes, y ticks
+//   bars     ← terms, sums, extent, scale  [@reveal, @from, @to]
+//                                quads + partial-sum line for the window
+//   overlay  ← frame, sums, scale  [@reveal, @time]   axes + limit marker
+//
+// @reveal is the animated reveal position clamped to the term count, so once
+// every bar is shown only the pulsing overlay rebuilds each frame.  @from /
+// @to are the bar indices the renderer's pan / zoom view leaves on screen:
+// the y scale follows them in O(1), and bars outside them are skipped.  When
+// the window holds more than kMaxBars bars, each drawn bar stands for a
+// group of terms (its min..max, with the partial-sum line tracing the sums'
+// min/max envelope), so 10⁷ terms cost no more per frame than 2048.
+//
+// Series with a `kind` take their sums from PartialSumScan (compensated
+// double, then rounded), which stays exact where a float running sum stalls.
+// Streamed series — terms that depend on the ones before them, such as a
+// rearrangement — generate their terms in order a chunk at a time, resume
+// from wherever the generator can after a shape change, and sum the terms
+// as given with the same compensation.
+// Product series give the natural logs of their factors as terms: the sums
+// stage adds those up the same compensated way and keeps exp of each sum,
+// so a partial product neither underflows nor overflows before it is shown.
+// Renderers that lay out bars themselves (GLRenderer's data textures) get
+// the raw terms and sums plus layout instead, and the bars stage never runs
+// unless the window needs grouping.
+// Snapshot caches hold the terms and sums of a formula series with the shape
+// they were computed for, so a restored 10⁷-term plot skips both stages.
+//
+// Subclasses supply the term formula, y scale and limit marker; colours
+// come from the style's palette so either path can apply them.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include "Dataflow.h"
+#include "ISeriesVisualizer.h"
+#include "PartialSumScan.h"
+#include "RangeMinMax.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+/// Term cap for series whose sums come from PartialSumScan.
+inline constexpr int kLongSeriesTerms = 10'000'000;
+
+struct SeriesPlotStyle {
+    float       defaultTerms   = 30.0f;
+    int         maxTerms       = 2000;
+    std::optional<SeriesKind> kind{};           // sums via PartialSumScan
+    float       revealRate     = 10.0f;     // bars revealed per second
+    bool        signedBars     = false;     // bars grow up/down from a zero line
+    float       barGap         = 0.12f;     // fraction of bar width on each side
+    BarPalette  palette{};
+    float       gridAlpha      = 0.25f;
+    const char* shapeParam     = nullptr;   // extra parameter the terms depend on
+    bool        product        = false;     // terms are log factors; the line their product
+    float       sumColour[3]   = {0.0f, 0.0f, 0.0f};      // partial-sum line
+    float       limitColour[3] = {0.15f, 0.60f, 0.15f};   // pulsing limit marker
+};
+
+/// Value ranges over the visible window, for SeriesPlotVisualizer::yScale.
+struct PlotExtent {
+    ValueRange terms;
+    ValueRange sums;
+};
+
+class SeriesPlotVisualizer : public ISeriesVisualizer {
+public:
+    static constexpr int   kMaxBars          = 2048;    // per-term bars up to this many
+    static constexpr float kMaxRevealSeconds = 20.0f;   // long series reveal faster
+
+    void render(float time, float /*width*/, float /*height*/, IRenderer& gl) override {
+        const int terms =
+            std::clamp(static_cast<int>(getParam("terms", style_.defaultTerms)), 1,
+                       style_.maxTerms);
+        const float rate =
+            std::max(style_.revealRate, static_cast<float>(terms) / kMaxRevealSeconds);
+
+        // Bars under the view: plot x = (clip x − offset) / scale.
+        const float barW  = (xMax - xMin) / static_cast<float>(terms);
+        const float scale = std::max(gl.viewScale(), 1e-6f);
+        const float left  = (-1.0f - gl.viewOffset()) / scale;
+        const float right = ( 1.0f - gl.viewOffset()) / scale;
+        const double from = std::clamp(std::floor((left  - xMin) / barW), 0.0f,
+                                       static_cast<float>(terms));
+        const double to   = std::clamp(std::ceil((right - xMin) / barW), 0.0f,
+                                       static_cast<float>(terms));
+
+        graph_.beginFrame();
+        graph_.set(in_terms_, terms);
+        if (style_.shapeParam) graph_.set(in_shape_, shape());
+        graph_.set(in_reveal_, std::min(time * rate, static_cast<float>(terms)));
+        graph_.set(in_from_, from);
+        graph_.set(in_to_, std::max(from, to));
+        graph_.set(in_time_, time);
+
+        const Frame&               frame   = frame_->get();
+        const std::vector<Vertex>& overlay = overlay_->get();
+
+        // Layers: grid, then bars, then axes, markers and the sum line.
+        gl.setLayer(0);
+        gl.drawLines(frame.grid);
+        gl.setLayer(1);
+        if (pullBars(gl, SeriesPart::Bars)) {
+            gl.setLayer(2);
+            gl.drawLines(overlay);
+            pullBars(gl, SeriesPart::SumLine);
+        } else {
+            const Bars& bars = bars_->get();
+            gl.drawQuads(bars.quads);
+            gl.setLayer(2);
+            gl.drawLines(overlay);
+            if (bars.sumLine.size() >= 2) gl.drawLineStrip(bars.sumLine);
+        }
+        shown_scale_.store(scale_->get(), std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::string dataflowJson() const override { return graph_.json(); }
+
+    [[nodiscard]] float plotYScale() const override {
+        return shown_scale_.load(std::memory_order_relaxed);
+    }
+
+    /// Terms and sums as last rendered, with the shape they were computed
+    /// for.  Streamed series save nothing: their generators replay instead.
+    void saveCache(BlobWriter& out) const override {
+        const Series& terms = terms_->peek();
+        const Series& sums  = sums_->peek();
+        const bool    saved = !terms.values.empty() && !terms.streamed &&
+                              sums.source == terms.epoch &&
+                              sums.values.size() == terms.values.size();
+        out.put(static_cast<std::uint8_t>(saved));
+        if (!saved) return;
+        out.put(static_cast<float>(graph_.value(in_shape_)));
+        out.putArray(std::span<const float>(terms.values));
+        out.putArray(std::span<const float>(sums.values));
+        out.put(sums.carry.hi);
+        out.put(sums.carry.lo);
+    }
+
+    /// Adopted by the next frame if the shape still matches; the term count
+    /// may differ, since both stages extend or truncate what they keep.
+    bool loadCache(BlobReader& in) override {
+        restored_.reset();
+        if (in.get<std::uint8_t>() == 0) return in.ok();
+        Restored r;
+        r.shape         = in.get<float>();
+        const bool read = in.getArray(r.terms.values) && in.getArray(r.sums.values);
+        r.sums.carry.hi = in.get<double>();
+        r.sums.carry.lo = in.get<double>();
+        if (!read || !in.ok() || r.terms.values.empty() ||
+            r.terms.values.size() > static_cast<std::size_t>(style_.maxTerms) ||
+            r.sums.values.size() != r.terms.values.size())
+            return false;
+        restored_ = std::move(r);
+        graph_.invalidate(*terms_);
+        return true;
+    }
+
+protected:
+    explicit SeriesPlotVisualizer(const SeriesPlotStyle& style) : style_(style) {
+        params_["terms"] = style.defaultTerms;
+        buildGraph();
+    }
+
+    /// Term shown as bar `i` (0-based).
+    [[nodiscard]] virtual float term(int i) const = 0;
+
+    /// Value of `style.shapeParam` as the terms use it (e.g. clamped ratio).
+    [[nodiscard]] virtual float shape() const { return 0.0f; }
+
+    /// Whether the terms are generated in order by streamTerms() rather
+    /// than one by one by term().  Decided by the shape.
+    [[nodiscard]] virtual bool streamed() const { return false; }
+
+    /// Streamed series: rewind the generator to at most `valid` terms in,
+    /// for the current shape, and return where it now stands.
+    virtual std::size_t resumeStream(std::size_t valid) { return valid; }
+
+    /// Streamed series: the next `out.size()` terms.
+    virtual void streamTerms(std::span<float> /*out*/) {}
+
+    /// Positive y range of the plot, given the terms and sums in the visible
+    /// window.  Default: the largest |term| or |sum| there.
+    [[nodiscard]] virtual float yScale(const PlotExtent& visible) const {
+        const float maxAbsVal = std::max(std::abs(visible.terms.min), std::abs(visible.terms.max));
+        const float maxAbsSum = std::max(std::abs(visible.sums.min),  std::abs(visible.sums.max));
+        return std::max({maxAbsVal, maxAbsSum, 0.001f});
+    }
+
+    /// Gridline spacing.  Default: a quarter of the scale rounded up to a
+    /// 1-significant-digit value.
+    [[nodiscard]] virtual float gridStep(float scale) const {
+        float step = scale / 4.0f;
+        if (step < 0.01f) step = 0.01f;
+        float mag = std::pow(10.0f, std::floor(std::log10(step)));
+        return std::ceil(step / mag) * mag;
+    }
+
+    /// Where to draw the pulsing marker once every bar is shown, if at all.
+    virtual bool limit(const std::vector<float>& sums, float& value) const = 0;
+
+private:
+    // Extra left/bottom margins for axis labels
+    static constexpr float mLeft   = 0.14f;
+    static constexpr float mRight  = 0.06f;
+    static constexpr float mBottom = 0.12f;
+    static constexpr float mTop    = 0.08f;
+
+    static constexpr float xMin = -1.0f + mLeft;
+    static constexpr float xMax =  1.0f - mRight;
+    static constexpr float yMin = -1.0f + mBottom;
+    static constexpr float yMax =  1.0f - mTop;
+    static constexpr float yMid =  0.0f;
+    static constexpr float yExt =  1.0f - std::max(mTop, mBottom);
+
+    static constexpr std::size_t kScanChunk = std::size_t{1} << 20;   // rows per scan call
+
+    struct Series {
+        std::vector<float> values;
+        std::uint64_t      epoch  = 0;   // bumped whenever kept values change
+        std::uint64_t      source = 0;   // sums: epoch of the terms summed
+        ScanCarry          carry;        // sums: compensated total of `values`
+        bool               streamed = false;   // terms: from streamTerms()
+    };
+
+    struct Restored {
+        float  shape = 0.0f;
+        Series terms;
+        Series sums;
+    };
+
+    struct Extent {
+        RangeMinMax   terms;
+        RangeMinMax   sums;
+        std::uint64_t termsEpoch = 0;
+        std::uint64_t sumsEpoch  = 0;
+    };
+
+    struct Frame {
+        std::vector<Vertex> grid;
+        std::vector<Vertex> axes;
+    };
+
+    struct Bars {
+        std::vector<Vertex> quads;
+        std::vector<Vertex> sumLine;
+    };
+
+    SeriesPlotStyle     style_;
+    const std::uint64_t data_source_ = newSeriesDataSource();
+    DataflowGraph       graph_;
+
+    DataflowGraph::InputId in_terms_  = 0;
+    DataflowGraph::InputId in_shape_  = 0;
+    DataflowGraph::InputId in_reveal_ = 0;
+    DataflowGraph::InputId in_from_   = 0;
+    DataflowGraph::InputId in_to_     = 0;
+    DataflowGraph::InputId in_time_   = 0;
+
+    DataflowGraph::Cell<Series>*              terms_   = nullptr;
+    DataflowGraph::Cell<Series>*              sums_    = nullptr;
+    DataflowGraph::Cell<Extent>*              extent_  = nullptr;
+    DataflowGraph::Cell<float>*               scale_   = nullptr;
+    DataflowGraph::Cell<Frame>*               frame_   = nullptr;
+    DataflowGraph::Cell<Bars>*                bars_    = nullptr;
+    DataflowGraph::Cell<std::vector<Vertex>>* overlay_ = nullptr;
+
+    std::atomic<float> shown_scale_{0.0f};   // read by the front end's axis labels
+    std::optional<Restored> restored_;       // from loadCache(), for the next frame
+
+    /// Plot y of value `v` at the given scale.
+    [[nodiscard]] float toY(float v, float scale) const {
+        return style_.signedBars ? yMid + (v / scale) * yExt
+                                 : yMin + (v / scale) * (yMax - yMin);
+    }
+
+    void buildGraph() {
+        in_terms_  = graph_.input("terms");
+        in_shape_  = graph_.input(style_.shapeParam ? style_.shapeParam : "shape");
+        in_reveal_ = graph_.input("@reveal");
+        in_from_   = graph_.input("@from");
+        in_to_     = graph_.input("@to");
+        in_time_   = graph_.input("@time");
+
+        terms_ = &graph_.node<Series>("terms", {in_terms_, in_shape_}, {}, [this](Series& out) {
+            const auto n = static_cast<std::size_t>(graph_.value(in_terms_));
+            if (streamed()) {
+                restored_.reset();
+                streamSeries(n, graph_.changed(*terms_, in_shape_), out);
+                return;
+            }
+            if (adoptRestored(out)) {
+                // keep the restored terms, extended or cut below
+            } else if (graph_.changed(*terms_, in_shape_) || out.streamed) {
+                out.values.clear();
+                out.streamed = false;
+                ++out.epoch;
+            }
+            const auto first = std::min(out.values.size(), n);
+            out.values.resize(n);
+            parallelFor(jobs_, first, n, std::size_t{1} << 14, [&](std::size_t lo, std::size_t hi) {
+                for (std::size_t i = lo; i < hi; ++i) out.values[i] = term(static_cast<int>(i));
+            });
+        });
+
+        sums_ = &graph_.node<Series>("sums", {}, {terms_}, [this](Series& out) {
+            const Series& terms = terms_->get();
+            if (restored_ && restored_->sums.source == terms.epoch) {
+                restored_->sums.epoch = out.epoch + 1;
+                out = std::move(restored_->sums);
+                restored_.reset();
+            }
+            if (out.source != terms.epoch || out.values.size() > terms.values.size()) {
+                out.values.clear();
+                out.carry  = {};
+                out.source = terms.epoch;
+                ++out.epoch;
+            }
+            extendSums(terms, out);
+        });
+
+        extent_ = &graph_.node<Extent>("extent", {}, {terms_, sums_}, [this](Extent& out) {
+            const Series& terms = terms_->get();
+            const Series& sums  = sums_->get();
+            out.terms.update(terms.values, out.termsEpoch != terms.epoch);
+            out.sums.update(sums.values, out.sumsEpoch != sums.epoch);
+            out.termsEpoch = terms.epoch;
+            out.sumsEpoch  = sums.epoch;
+        });
+
+        scale_ = &graph_.node<float>("scale", {in_from_, in_to_}, {extent_}, [this](float& out) {
+            out = yScale(visibleExtent());
+        });
+
+        frame_ = &graph_.node<Frame>("frame", {}, {scale_}, [this](Frame& out) {
+            buildFrame(scale_->get(), out);
+        });
+
+        bars_ = &graph_.node<Bars>("bars", {in_reveal_, in_from_, in_to_},
+                                   {terms_, sums_, extent_, scale_}, [this](Bars& out) {
+            buildBars(terms_->get().values, sums_->get().values, scale_->get(),
+                      static_cast<float>(graph_.value(in_reveal_)), out);
+        });
+
+        overlay_ = &graph_.node<std::vector<Vertex>>(
+            "overlay", {in_reveal_, in_time_}, {frame_, sums_, scale_},
+            [this](std::vector<Vertex>& out) {
+                out = frame_->get().axes;
+                const std::vector<float>& sums = sums_->get().values;
+                float value = 0.0f;
+                if (revealedBars() >= static_cast<int>(sums.size()) && limit(sums, value)) {
+                    const float limitY = toY(value, scale_->get());
+                    const float pulse  =
+                        0.5f + 0.5f * std::sin(static_cast<float>(graph_.value(in_time_)) * 3.0f);
+                    const float  a = 0.4f + 0.4f * pulse;
+                    const float* c = style_.limitColour;
+                    out.push_back({xMin, limitY, c[0], c[1], c[2], a});
+                    out.push_back({xMax, limitY, c[0], c[1], c[2], a});
+                }
+            });
+    }
+
+    /// Bars shown so far by the reveal animation.
+    [[nodiscard]] int revealedBars() const {
+        return std::min(static_cast<int>(graph_.value(in_terms_)),
+                        static_cast<int>(graph_.value(in_reveal_)) + 1);
+    }
+
+    /// Bars [lo, hi) to draw: the revealed ones under @from..@to, plus one
+    /// bar of margin each side to keep the sum line running off-screen.
+    [[nodiscard]] std::pair<int, int> barWindow() const {
+        return {std::max(static_cast<int>(graph_.value(in_from_)) - 1, 0),
+                std::min(static_cast<int>(graph_.value(in_to_)) + 1, revealedBars())};
+    }
+
+    /// Hand the window's raw values to a renderer that lays out bars itself.
+    bool pullBars(IRenderer& gl, SeriesPart part) {
+        const auto [lo, hi] = barWindow();
+        if (hi - lo > kMaxBars) return false;
+
+        const Series& terms = terms_->get();
+        const Series& sums  = sums_->get();
+        const float   count = static_cast<float>(terms.values.size());
+        const float   scale = scale_->get();
+
+        SeriesDataDraw d;
+        d.source   = data_source_;
+        d.revision = terms.epoch + sums.epoch;
+        d.terms    = terms.values;
+        d.sums     = sums.values;
+        d.part     = part;
+        d.first    = lo;
+        d.count    = hi - lo;
+        d.xMin     = xMin;
+        d.barW     = (xMax - xMin) / count;
+        d.gap      = d.barW * style_.barGap;
+        d.base     = style_.signedBars ? yMid : yMin;
+        d.yPerUnit = (style_.signedBars ? yExt : yMax - yMin) / scale;
+        d.reveal   = static_cast<float>(graph_.value(in_reveal_));
+        d.barAlpha = 0.85f;
+        d.palette  = style_.palette;
+        std::copy(std::begin(style_.sumColour), std::end(style_.sumColour), d.sumColour);
+        return gl.drawSeriesData(d);
+    }
+
+    /// Fill colour of bar `i` of `terms` from the style's palette.
+    void barColour(int i, int terms, float term, float& r, float& g, float& b) const {
+        const BarPalette& p = style_.palette;
+        if (term < 0.0f) {
+            hsvToRgb(p.negHue, p.negSat, p.negVal, r, g, b);
+            return;
+        }
+        const float hue = p.hue + p.hueShift * static_cast<float>(i)
+                                             / static_cast<float>(std::max(terms - 1, 1));
+        hsvToRgb(hue, p.sat, p.val, r, g, b);
+    }
+
+    /// Terms and sums under @from..@to.
+    [[nodiscard]] PlotExtent visibleExtent() {
+        const Extent& e  = extent_->get();
+        const auto    lo = static_cast<std::size_t>(graph_.value(in_from_));
+        const auto    hi = static_cast<std::size_t>(graph_.value(in_to_));
+        return {e.terms.query(lo, hi), e.sums.query(lo, hi)};
+    }
+
+    /// Take the terms loadCache() restored, if computed for the current
+    /// shape, under a new epoch that their restored sums are tagged with.
+    bool adoptRestored(Series& out) {
+        if (!restored_) return false;
+        if (restored_->shape != static_cast<float>(graph_.value(in_shape_))) {
+            restored_.reset();
+            return false;
+        }
+        restored_->terms.epoch = out.epoch + 1;
+        restored_->sums.source  = restored_->terms.epoch;
+        out = std::move(restored_->terms);
+        return true;
+    }
+
+    /// Bring a streamed series to `n` terms, keeping those the generator
+    /// resumes after (all of them unless `reshaped`).
+    void streamSeries(std::size_t n, bool reshaped, Series& out) {
+        std::size_t have = std::min(out.values.size(), n);
+        if (!out.streamed) have = 0;
+        const std::size_t from = resumeStream(have);
+        // Rewinding for the same shape regenerates the same terms.
+        if (!out.streamed || (reshaped && from < have)) ++out.epoch;
+        out.streamed = true;
+        out.values.resize(n);
+        for (std::size_t row = from; row < n; row += kScanChunk)
+            streamTerms(std::span(out.values).subspan(row, std::min(kScanChunk, n - row)));
+    }
+
+    /// Append the running sums of terms[out.values.size()…] to `out`.
+    void extendSums(const Series& series, Series& out) const {
+        const std::vector<float>& terms = series.values;
+        std::size_t row = out.values.size();
+        out.values.resize(terms.size());
+        if (series.streamed || style_.product) {
+            // Knuth TwoSum of the terms as given
+            for (; row < terms.size(); ++row) {
+                const double t  = terms[row];
+                const double s  = out.carry.hi + t;
+                const double bb = s - out.carry.hi;
+                out.carry.lo += (out.carry.hi - (s - bb)) + (t - bb);
+                out.carry.hi  = s;
+                const double sum = out.carry.sum();
+                out.values[row] = static_cast<float>(style_.product ? std::exp(sum) : sum);
+            }
+            return;
+        }
+        if (!style_.kind) {
+            float s = row ? out.values[row - 1] : 0.0f;
+            for (; row < terms.size(); ++row) out.values[row] = s += terms[row];
+            return;
+        }
+
+        PartialSumScan      scan(*style_.kind, shape());
+        std::vector<double> chunk;
+        while (row < terms.size()) {
+            const std::size_t n = std::min(kScanChunk, terms.size() - row);
+            chunk.resize(n);
+            out.carry = scan.run(row, chunk, {}, out.carry, jobs_);
+            for (std::size_t i = 0; i < n; ++i) out.values[row + i] = static_cast<float>(chunk[i]);
+            row += n;
+        }
+    }
+
+    void buildFrame(float scale, Frame& out) const {
+        out.grid.clear();
+        out.axes.clear();
+        const float step = gridStep(scale);
+        const float ga   = style_.gridAlpha;
+
+        if (style_.signedBars) {
+            for (float v = step; v < scale; v += step) {
+                float gy  = yMid + (v / scale) * yExt;
+                float gyn = yMid - (v / scale) * yExt;
+                out.grid.push_back({xMin, gy,  0.78f, 0.76f, 0.74f, ga});
+                out.grid.push_back({xMax, gy,  0.78f, 0.76f, 0.74f, ga});
+                out.grid.push_back({xMin, gyn, 0.78f, 0.76f, 0.74f, ga});
+                out.grid.push_back({xMax, gyn, 0.78f, 0.76f, 0.74f, ga});
+            }
+            // Horizontal zero-line
+            out.axes.push_back({xMin, yMid, 0.30f, 0.28f, 0.26f, 0.8f});
+            out.axes.push_back({xMax, yMid, 0.30f, 0.28f, 0.26f, 0.8f});
+            // Left vertical axis
+            out.axes.push_back({xMin, yMid - yExt, 0.30f, 0.28f, 0.26f, 0.8f});
+            out.axes.push_back({xMin, yMid + yExt, 0.30f, 0.28f, 0.26f, 0.8f});
+            return;
+        }
+
+        for (float v = step; v < scale; v += step) {
+            float gy = yMin + (v / scale) * (yMax - yMin);
+            out.grid.push_back({xMin, gy, 0.78f, 0.76f, 0.74f, ga});
+            out.grid.push_back({xMax, gy, 0.78f, 0.76f, 0.74f, ga});
+        }
+        out.axes.push_back({xMin, yMin, 0.30f, 0.28f, 0.26f, 0.8f});
+        out.axes.push_back({xMax, yMin, 0.30f, 0.28f, 0.26f, 0.8f});
+        out.axes.push_back({xMin, yMin, 0.30f, 0.28f, 0.26f, 0.8f});
+        out.axes.push_back({xMin, yMax, 0.30f, 0.28f, 0.26f, 0.8f});
+
+        // Y-axis tick marks
+        for (float v = step; v < scale; v += step) {
+            float ty = yMin + (v / scale) * (yMax - yMin);
+            out.axes.push_back({xMin - 0.015f, ty, 0.30f, 0.28f, 0.26f, 0.7f});
+            out.axes.push_back({xMin + 0.01f,  ty, 0.30f, 0.28f, 0.26f, 0.7f});
+        }
+    }
+
+    void buildBars(const std::vector<float>& terms, const std::vector<float>& sums,
+                   float scale, float revealed, Bars& out) {
+        const int count = static_cast<int>(terms.size());
+        out.quads.clear();
+        out.sumLine.clear();
+
+        const auto [lo, hi] = barWindow();
+        if (lo >= hi) return;
+
+        const float barW = (xMax - xMin) / static_cast<float>(count);
+        const int   n    = hi - lo;
+        if (n > kMaxBars) {
+            buildGroups(scale, revealed, lo, hi, (n + kMaxBars - 1) / kMaxBars, barW, out);
+            return;
+        }
+
+        out.quads.reserve(static_cast<size_t>(n) * 4);
+        out.sumLine.reserve(static_cast<size_t>(n));
+        const float barGap = barW * style_.barGap;
+
+        for (int i = lo; i < hi; ++i) {
+            const float t     = terms[static_cast<size_t>(i)];
+            const float alpha = std::clamp(revealed - static_cast<float>(i), 0.0f, 1.0f);
+
+            const float x1 = xMin + static_cast<float>(i)     * barW + barGap;
+            const float x2 = xMin + static_cast<float>(i + 1) * barW - barGap;
+            float y1 = style_.signedBars ? yMid : yMin;
+            float y2 = toY(t, scale);
+            if (y1 > y2) std::swap(y1, y2);
+
+            float cr{}, cg{}, cb{};
+            barColour(i, count, t, cr, cg, cb);
+            addQuad(out.quads, x1, y1, x2, y2, cr, cg, cb, alpha * 0.85f);
+
+            const float sx = xMin + (static_cast<float>(i) + 0.5f) * barW;
+            const float sy = toY(sums[static_cast<size_t>(i)], scale);
+            const float* c  = style_.sumColour;
+            out.sumLine.push_back({sx, sy, c[0], c[1], c[2], alpha});
+        }
+    }
+
+    /// Bars [lo, hi) drawn `group` at a time: each quad spans its group's
+    /// term range (and the baseline) and the sum line visits the group's
+    /// lowest and highest sum.  Groups are aligned to multiples of `group`
+    /// so panning does not regroup (and shimmer) the bars.
+    void buildGroups(float scale, float revealed, int lo, int hi, int group, float barW,
+                     Bars& out) {
+        const Extent& e     = extent_->get();
+        const int     count = static_cast<int>(e.terms.size());
+        const int     first = lo - lo % group;
+        out.quads.reserve(static_cast<size_t>((hi - first) / group + 1) * 4);
+        out.sumLine.reserve(static_cast<size_t>((hi - first) / group + 1) * 2);
+
+        for (int i = first; i < hi; i += group) {
+            const int        end   = std::min(i + group, hi);
+            const auto       a     = static_cast<size_t>(i);
+            const auto       b     = static_cast<size_t>(end);
+            const ValueRange t     = e.terms.query(a, b);
+            const ValueRange s     = e.sums.query(a, b);
+            const float      alpha = std::clamp(revealed - static_cast<float>(i), 0.0f, 1.0f);
+
+            const float x1 = xMin + static_cast<float>(i)   * barW;
+            const float x2 = xMin + static_cast<float>(end) * barW;
+            const float y1 = style_.signedBars ? toY(std::min(t.min, 0.0f), scale) : yMin;
+            const float y2 = toY(std::max(t.max, 0.0f), scale);
+
+            float cr{}, cg{}, cb{};
+            barColour(i, count, t.max, cr, cg, cb);
+            addQuad(out.quads, x1, y1, x2, y2, cr, cg, cb, alpha * 0.85f);
+
+            const float  sx = 0.5f * (x1 + x2);
+            const float* c  = style_.sumColour;
+            out.sumLine.push_back({sx, toY(s.min, scale), c[0], c[1], c[2], alpha});
+            out.sumLine.push_back({sx, toY(s.max, scale), c[0], c[1], c[2], alpha});
+        }
+    }
+};
@@ -0,0 +1,116 @@
+// ─── WizSeries: Snapshot Blob I/O ───────────────────────────────────────────
+// Little-endian binary writer/reader for SeriesManager::serialize().  Arrays
+// of trivially copyable values are stored raw, so restoring a cache is one
+// length check and one memcpy.  The reader never throws: any truncation or
+// size mismatch latches `ok()` to false and later reads return zeros.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+static_assert(std::endian::native == std::endian::little,
+              "snapshot blobs are raw little-endian; add byte swapping for this target");
+
+class BlobWriter {
+public:
+    template <typename T>
+    void put(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const auto* p = reinterpret_cast<const std::uint8_t*>(&value);
+        bytes_.insert(bytes_.end(), p, p + sizeof(T));
+    }
+
+    void putString(std::string_view s) {
+        put(static_cast<std::uint32_t>(s.size()));
+        bytes_.insert(bytes_.end(), s.begin(), s.end());
+    }
+
+    /// Element count followed by the raw elements.
+    template <typename T>
+    void putArray(std::span<const T> values) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        put(static_cast<std::uint64_t>(values.size()));
+        const auto* p = reinterpret_cast<const std::uint8_t*>(values.data());
+        bytes_.insert(bytes_.end(), p, p + values.size_bytes());
+    }
+
+    /// Reserve a u32 to be filled with a later patch() (e.g. a section size).
+    std::size_t placeholder() {
+        put(std::uint32_t{0});
+        return bytes_.size() - sizeof(std::uint32_t);
+    }
+
+    void patch(std::size_t at, std::uint32_t value) {
+        std::memcpy(bytes_.data() + at, &value, sizeof(value));
+    }
+
+    [[nodiscard]] std::size_t size() const { return bytes_.size(); }
+    [[nodiscard]] std::vector<std::uint8_t>& bytes() { return bytes_; }
+
+private:
+    std::vector<std::uint8_t> bytes_;
+};
+
+class BlobReader {
+public:
+    explicit BlobReader(std::span<const std::uint8_t> bytes) : bytes_(bytes) {}
+
+    template <typename T>
+    T get() {
+        static_assert(std::is_trivially_copyable_v<T>);
+        T value{};
+        if (take(sizeof(T))) std::memcpy(&value, bytes_.data() + pos_ - sizeof(T), sizeof(T));
+        return value;
+    }
+
+    std::string getString() {
+        const auto n = get<std::uint32_t>();
+        if (!take(n)) return {};
+        return {reinterpret_cast<const char*>(bytes_.data() + pos_ - n), n};
+    }
+
+    /// Read an array written by putArray() into `out` (resized to fit).
+    template <typename T>
+    bool getArray(std::vector<T>& out) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const auto n = get<std::uint64_t>();
+        if (!ok_ || n > remaining() / sizeof(T)) return fail();
+        out.resize(static_cast<std::size_t>(n));
+        std::memcpy(out.data(), bytes_.data() + pos_, out.size() * sizeof(T));
+        pos_ += out.size() * sizeof(T);
+        return true;
+    }
+
+    /// A sub-reader over the next `n` bytes; this reader skips past them.
+    BlobReader section(std::size_t n) {
+        if (!take(n)) return BlobReader({});
+        return BlobReader(bytes_.subspan(pos_ - n, n));
+    }
+
+    [[nodiscard]] bool ok() const { return ok_; }
+    [[nodiscard]] bool atEnd() const { return pos_ == bytes_.size(); }
+    [[nodiscard]] std::size_t remaining() const { return bytes_.size() - pos_; }
+
+private:
+    std::span<const std::uint8_t> bytes_;
+    std::size_t pos_ = 0;
+    bool        ok_  = true;
+
+    bool take(std::size_t n) {
+        if (!ok_ || n > remaining()) return fail();
+        pos_ += n;
+        return true;
+    }
+
+    bool fail() {
+        ok_ = false;
+        return false;
+    }
+};
@@ -0,0 +1,368 @@
+// ─── WizSeries: CPU Software Rasterizer ─────────────────────────────────────
+// IRenderer backend that needs no GPU.  Draw calls are transformed to pixel
+// space and recorded; endFrame() bins the primitives into screen tiles and
+// rasterizes the tiles on the shared JobSystem with the same SRC_ALPHA /
+// ONE_MINUS_SRC_ALPHA blending as GLRenderer.  Each tile is owned by exactly
+// one job and replays its primitives in submission order, so the output is
+// bit-identical for any worker count.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include "IRenderer.h"
+#include "JobSystem.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class SoftwareRenderer : public IRenderer {
+public:
+    explicit SoftwareRenderer(JobSystem& jobs) : jobs_(jobs) {}
+
+    /// Rasterize at `factor`× resolution and box-filter down on resolve.
+    void setSupersample(int factor) { ssaa_ = std::clamp(factor, 1, 8); }
+
+    void beginFrame(float width, float height) override {
+        width_  = std::max(1, static_cast<int>(width));
+        height_ = std::max(1, static_cast<int>(height));
+        fbW_    = width_ * ssaa_;
+        fbH_    = height_ * ssaa_;
+        verts_.clear();
+        prims_.clear();
+    }
+
+    void endFrame() override {
+        color_.resize(static_cast<size_t>(fbW_) * fbH_ * 3);
+
+        binPrimitives();
+
+        const int tilesX = (fbW_ + kTile - 1) / kTile;
+        jobs_.parallelFor(0, bins_.size(), 1, [&](size_t lo, size_t hi) {
+            for (size_t t = lo; t < hi; ++t) {
+                const int ti = static_cast<int>(t);
+                rasterizeTile((ti % tilesX) * kTile, (ti / tilesX) * kTile, bins_[t]);
+            }
+        });
+
+        if (ssaa_ > 1) {
+            pixels_.resize(static_cast<size_t>(width_) * height_ * 3);
+            jobs_.parallelFor(0, static_cast<size_t>(height_), 16, [&](size_t lo, size_t hi) {
+                for (size_t row = lo; row < hi; ++row) resolveRow(static_cast<int>(row));
+            });
+        }
+    }
+
+    [[nodiscard]] int width()  const { return width_; }
+    [[nodiscard]] int height() const { return height_; }
+
+    /// Resolved frame as tightly packed 8-bit RGB, top row first.
+    [[nodiscard]] const std::vector<std::uint8_t>& pixels() const {
+        return ssaa_ > 1 ? pixels_ : color_;
+    }
+
+protected:
+    void draw(std::span<const Vertex> verts, Primitive mode,
+              float ps) override {
+        const auto base = static_cast<std::uint32_t>(verts_.size());
+        const float sx = 0.5f * static_cast<float>(fbW_);
+        const float sy = 0.5f * static_cast<float>(fbH_);
+        auto push = [&](const Vertex& v) {
+            const float cx = v.x * view_scale_ + view_offset_;
+            verts_.push_back({clampCoord((cx + 1.0f) * sx),
+                              clampCoord((1.0f - v.y) * sy),
+                              v.r, v.g, v.b, std::clamp(v.a, 0.0f, 1.0f)});
+        };
+        if (mode == Primitive::Quads) {
+            // Primitives reference consecutive vertices: spell out both triangles.
+            for (std::size_t q = 0; q + 3 < verts.size(); q += 4)
+                for (const std::uint16_t i : kQuadIndices) push(verts[q + i]);
+        } else {
+            for (const Vertex& v : verts) push(v);
+        }
+
+        const auto n    = static_cast<std::uint32_t>(verts_.size() - base);
+        const float scaled = ps * static_cast<float>(ssaa_);
+        switch (mode) {
+            case Primitive::Points:
+                for (std::uint32_t i = 0; i < n; ++i)
+                    addPrim(Kind::Point, base + i, scaled);
+                break;
+            case Primitive::Lines:
+                for (std::uint32_t i = 0; i + 1 < n; i += 2)
+                    addPrim(Kind::Line, base + i, scaled);
+                break;
+            case Primitive::LineStrip:
+                for (std::uint32_t i = 0; i + 1 < n; ++i)
+                    addPrim(Kind::Line, base + i, scaled);
+                break;
+            case Primitive::Triangles:
+            case Primitive::Quads:
+                for (std::uint32_t i = 0; i + 2 < n; i += 3)
+                    addPrim(Kind::Triangle, base + i, scaled);
+                break;
+        }
+    }
+
+private:
+    static constexpr int   kTile       = 64;
+    static constexpr int   kSubBits    = 8;       // 1/256-pixel vertex snap
+    // 0.98 / 0.97 / 0.96 — GLRenderer's clear colour in 8-bit.
+    static constexpr std::uint8_t kClearR = 250;
+    static constexpr std::uint8_t kClearG = 247;
+    static constexpr std::uint8_t kClearB = 245;
+
+    enum class Kind : std::uint8_t { Point, Line, Triangle };
+
+    /// Pixel-space vertex (y down, pixel centres at +0.5).
+    struct RasterVertex {
+        float x, y;
+        float r, g, b, a;
+    };
+
+    /// A point, line or triangle referencing 1, 2 or 3 consecutive vertices.
+    struct Prim {
+        Kind          kind;
+        std::uint32_t first;
+        float         size;
+        int           x0, y0, x1, y1;   // inclusive pixel bounds
+    };
+
+    JobSystem& jobs_;
+    int ssaa_   = 1;
+    int width_  = 1;
+    int height_ = 1;
+    int fbW_    = 1;
+    int fbH_    = 1;
+
+    std::vector<RasterVertex>              verts_;
+    std::vector<Prim>                      prims_;
+    std::vector<std::vector<std::uint32_t>> bins_;
+    std::vector<std::uint8_t>              color_;    // RGB8 at fbW_×fbH_
+    std::vector<std::uint8_t>              pixels_;   // resolved when ssaa_ > 1
+
+    static float clampCoord(float v) {
+        // Keeps snapped coordinates well inside int64 edge-function range.
+        return std::clamp(v, -1048576.0f, 1048576.0f);
+    }
+
+    void addPrim(Kind kind, std::uint32_t first, float size) {
+        const int count = kind == Kind::Point ? 1 : kind == Kind::Line ? 2 : 3;
+        float minX = verts_[first].x, maxX = minX;
+        float minY = verts_[first].y, maxY = minY;
+        for (int i = 1; i < count; ++i) {
+            const RasterVertex& v = verts_[first + static_cast<std::uint32_t>(i)];
+            minX = std::min(minX, v.x); maxX = std::max(maxX, v.x);
+            minY = std::min(minY, v.y); maxY = std::max(maxY, v.y);
+        }
+        const float pad = kind == Kind::Triangle ? 1.0f : 0.5f * size + 1.0f;
+        Prim p{kind, first, size,
+               std::max(0, static_cast<int>(std::floor(minX - pad))),
+               std::max(0, static_cast<int>(std::floor(minY - pad))),
+               std::min(fbW_ - 1, static_cast<int>(std::ceil(maxX + pad))),
+               std::min(fbH_ - 1, static_cast<int>(std::ceil(maxY + pad)))};
+        if (p.x0 > p.x1 || p.y0 > p.y1) return;   // entirely off-screen
+        prims_.push_back(p);
+    }
+
+    void binPrimitives() {
+        const int tilesX = (fbW_ + kTile - 1) / kTile;
+        const int tilesY = (fbH_ + kTile - 1) / kTile;
+        bins_.resize(static_cast<size_t>(tilesX) * tilesY);
+        for (auto& bin : bins_) bin.clear();
+
+        for (std::uint32_t i = 0; i < prims_.size(); ++i) {
+            const Prim& p = prims_[i];
+            for (int ty = p.y0 / kTile; ty <= p.y1 / kTile; ++ty)
+                for (int tx = p.x0 / kTile; tx <= p.x1 / kTile; ++tx)
+                    bins_[static_cast<size_t>(ty * tilesX + tx)].push_back(i);
+        }
+    }
+
+    // ── Tile rasterization ──────────────────────────────────────────────────
+
+    struct TileRect {
+        int x0, y0, x1, y1;   // half-open
+    };
+
+    void rasterizeTile(int tileX, int tileY,
+                       const std::vector<std::uint32_t>& bin) {
+        const TileRect rc{tileX, tileY, std::min(tileX + kTile, fbW_),
+                          std::min(tileY + kTile, fbH_)};
+
+        for (int y = rc.y0; y < rc.y1; ++y) {
+            std::uint8_t* row = &color_[(static_cast<size_t>(y) * fbW_ + rc.x0) * 3];
+            for (int x = rc.x0; x < rc.x1; ++x, row += 3) {
+                row[0] = kClearR; row[1] = kClearG; row[2] = kClearB;
+            }
+        }
+
+        for (std::uint32_t idx : bin) {
+            const Prim& p = prims_[idx];
+            switch (p.kind) {
+                case Kind::Point:    rasterPoint(p, rc);    break;
+                case Kind::Line:     rasterLine(p, rc);     break;
+                case Kind::Triangle: rasterTriangle(p, rc); break;
+            }
+        }
+    }
+
+    static std::uint8_t toByte(float v) {
+        return static_cast<std::uint8_t>(std::clamp(v, 0.0f, 1.0f) * 255.0f + 0.5f);
+    }
+
+    /// RGBA8 framebuffer blend, as the GL blend unit does it.
+    void blend(int x, int y, float r, float g, float b, float a) {
+        constexpr float k = 1.0f / 255.0f;
+        std::uint8_t* c = &color_[(static_cast<size_t>(y) * fbW_ + x) * 3];
+        c[0] = toByte(c[0] * k + (r - c[0] * k) * a);
+        c[1] = toByte(c[1] * k + (g - c[1] * k) * a);
+        c[2] = toByte(c[2] * k + (b - c[2] * k) * a);
+    }
+
+    /// Square point sprite covering pixel centres within size/2.
+    void rasterPoint(const Prim& p, const TileRect& rc) {
+        const RasterVertex& v = verts_[p.first];
+        const float half = 0.5f * p.size;
+        const int x0 = std::max(rc.x0, static_cast<int>(std::ceil(v.x - half - 0.5f)));
+        const int x1 = std::min(rc.x1, static_cast<int>(std::ceil(v.x + half - 0.5f)));
+        const int y0 = std::max(rc.y0, static_cast<int>(std::ceil(v.y - half - 0.5f)));
+        const int y1 = std::min(rc.y1, static_cast<int>(std::ceil(v.y + half - 0.5f)));
+        for (int y = y0; y < y1; ++y)
+            for (int x = x0; x < x1; ++x) blend(x, y, v.r, v.g, v.b, v.a);
+    }
+
+    /// Half-open line [v0, v1) stepped along its major axis; `ssaa_` pixels
+    /// thick so a 1 px GL line keeps its apparent width when supersampling.
+    void rasterLine(const Prim& p, const TileRect& rc) {
+        const RasterVertex& a = verts_[p.first];
+        const RasterVertex& b = verts_[p.first + 1];
+        const float dx = b.x - a.x;
+        const float dy = b.y - a.y;
+        if (dx == 0.0f && dy == 0.0f) return;
+
+        const bool  xMajor = std::abs(dx) >= std::abs(dy);
+        const float major0 = xMajor ? a.x : a.y;
+        const float dMajor = xMajor ? dx : dy;
+        const float minor0 = xMajor ? a.y : a.x;
+        const float dMinor = xMajor ? dy : dx;
+        const float lo     = std::min(major0, major0 + dMajor);
+        const float hi     = std::max(major0, major0 + dMajor);
+        const float half   = 0.5f * static_cast<float>(ssaa_);
+
+        const int majLo = xMajor ? rc.x0 : rc.y0;
+        const int majHi = xMajor ? rc.x1 : rc.y1;
+        const int minLo = xMajor ? rc.y0 : rc.x0;
+        const int minHi = xMajor ? rc.y1 : rc.x1;
+
+        const int i0 = std::max(majLo, static_cast<int>(std::ceil(lo - 0.5f)));
+        const int i1 = std::min(majHi, static_cast<int>(std::ceil(hi - 0.5f)));
+        for (int i = i0; i < i1; ++i) {
+            const float t = (static_cast<float>(i) + 0.5f - major0) / dMajor;
+            const float m = minor0 + t * dMinor;
+            const int j0 = std::max(minLo, static_cast<int>(std::ceil(m - half - 0.5f)));
+            const int j1 = std::min(minHi, static_cast<int>(std::ceil(m + half - 0.5f)));
+            const float r  = a.r + (b.r - a.r) * t;
+            const float g  = a.g + (b.g - a.g) * t;
+            const float bl = a.b + (b.b - a.b) * t;
+            const float al = a.a + (b.a - a.a) * t;
+            for (int j = j0; j < j1; ++j) {
+                if (xMajor) blend(i, j, r, g, bl, al);
+                else        blend(j, i, r, g, bl, al);
+            }
+        }
+    }
+
+    /// Edge-function rasterizer on 1/256-pixel snapped integer coordinates
+    /// with a consistent tie-break, so quads split along a diagonal never
+    /// double-blend or leave a seam.
+    void rasterTriangle(const Prim& p, const TileRect& rc) {
+        const RasterVertex* v[3] = {&verts_[p.first], &verts_[p.first + 1],
+                                    &verts_[p.first + 2]};
+        std::int64_t X[3], Y[3];
+        for (int i = 0; i < 3; ++i) {
+            X[i] = std::llround(v[i]->x * (1 << kSubBits));
+            Y[i] = std::llround(v[i]->y * (1 << kSubBits));
+        }
+        std::int64_t area = (X[1] - X[0]) * (Y[2] - Y[0])
+                          - (Y[1] - Y[0]) * (X[2] - X[0]);
+        if (area == 0) return;
+        if (area < 0) {
+            std::swap(X[1], X[2]);
+            std::swap(Y[1], Y[2]);
+            std::swap(v[1], v[2]);
+            area = -area;
+        }
+
+        // Edge k is opposite vertex k.
+        std::int64_t A[3], B[3], C[3];
+        bool owns[3];
+        for (int k = 0; k < 3; ++k) {
+            const int i = (k + 1) % 3, j = (k + 2) % 3;
+            A[k] = Y[i] - Y[j];
+            B[k] = X[j] - X[i];
+            C[k] = X[i] * Y[j] - Y[i] * X[j];
+            owns[k] = A[k] > 0 || (A[k] == 0 && B[k] > 0);
+        }
+
+        const bool flat = v[0]->r == v[1]->r && v[0]->r == v[2]->r
+                       && v[0]->g == v[1]->g && v[0]->g == v[2]->g
+                       && v[0]->b == v[1]->b && v[0]->b == v[2]->b
+                       && v[0]->a == v[1]->a && v[0]->a == v[2]->a;
+        const float invArea = 1.0f / static_cast<float>(area);
+
+        const int x0 = std::max(rc.x0, p.x0), x1 = std::min(rc.x1, p.x1 + 1);
+        const int y0 = std::max(rc.y0, p.y0), y1 = std::min(rc.y1, p.y1 + 1);
+        constexpr std::int64_t half = 1 << (kSubBits - 1);
+        const std::int64_t px0 = (static_cast<std::int64_t>(x0) << kSubBits) + half;
+        const std::int64_t step = std::int64_t{1} << kSubBits;
+        for (int y = y0; y < y1; ++y) {
+            const std::int64_t py = (static_cast<std::int64_t>(y) << kSubBits) + half;
+            // Integer edge values stepped exactly along the row.
+            std::int64_t w[3];
+            for (int k = 0; k < 3; ++k) w[k] = A[k] * px0 + B[k] * py + C[k];
+            for (int x = x0; x < x1; ++x) {
+                const bool inside = (w[0] > 0 || (w[0] == 0 && owns[0]))
+                                 && (w[1] > 0 || (w[1] == 0 && owns[1]))
+                                 && (w[2] > 0 || (w[2] == 0 && owns[2]));
+                if (inside) {
+                    if (flat) {
+                        blend(x, y, v[0]->r, v[0]->g, v[0]->b, v[0]->a);
+                    } else {
+                        const float b0 = static_cast<float>(w[0]) * invArea;
+                        const float b1 = static_cast<float>(w[1]) * invArea;
+                        const float b2 = 1.0f - b0 - b1;
+                        blend(x, y,
+                              b0 * v[0]->r + b1 * v[1]->r + b2 * v[2]->r,
+                              b0 * v[0]->g + b1 * v[1]->g + b2 * v[2]->g,
+                              b0 * v[0]->b + b1 * v[1]->b + b2 * v[2]->b,
+                              b0 * v[0]->a + b1 * v[1]->a + b2 * v[2]->a);
+                    }
+                }
+                for (int k = 0; k < 3; ++k) w[k] += A[k] * step;
+            }
+        }
+    }
+
+    // ── Resolve ─────────────────────────────────────────────────────────────
+
+    void resolveRow(int row) {
+        const int   n    = ssaa_ * ssaa_;
+        std::uint8_t* out = &pixels_[static_cast<size_t>(row) * width_ * 3];
+        for (int x = 0; x < width_; ++x) {
+            int r = 0, g = 0, b = 0;
+            for (int sy = 0; sy < ssaa_; ++sy) {
+                const std::uint8_t* src =
+                    &color_[(static_cast<size_t>(row * ssaa_ + sy) * fbW_
+                             + static_cast<size_t>(x) * ssaa_) * 3];
+                for (int sx = 0; sx < ssaa_; ++sx, src += 3) {
+                    r += src[0]; g += src[1]; b += src[2];
+                }
+            }
+            *out++ = static_cast<std::uint8_t>((r + n / 2) / n);
+            *out++ = static_cast<std::uint8_t>((g + n / 2) / n);
+            *out++ = static_cast<std::uint8_t>((b + n / 2) / n);
+        }
+    }
+};
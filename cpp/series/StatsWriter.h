@@ -0,0 +1,71 @@
+// ─── WizSeries: Stats JSON Builder ──────────────────────────────────────────
+// Tiny append-only JSON object writer used by SeriesManager::getStats().
+// Keys are trusted literals; string values are escaped minimally.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+class StatsWriter {
+public:
+    StatsWriter& field(const char* key, double value) {
+        char buf[32];
+        if (std::isfinite(value)) std::snprintf(buf, sizeof(buf), "%.6g", value);
+        else                      std::snprintf(buf, sizeof(buf), "null");
+        return raw(key, buf);
+    }
+
+    StatsWriter& field(const char* key, std::int64_t value) {
+        return raw(key, std::to_string(value));
+    }
+
+    StatsWriter& field(const char* key, std::uint64_t value) {
+        return raw(key, std::to_string(value));
+    }
+
+    StatsWriter& field(const char* key, int value) {
+        return raw(key, std::to_string(value));
+    }
+
+    StatsWriter& field(const char* key, unsigned value) {
+        return raw(key, std::to_string(value));
+    }
+
+    StatsWriter& field(const char* key, bool value) {
+        return raw(key, value ? "true" : "false");
+    }
+
+    StatsWriter& field(const char* key, const std::string& value) {
+        std::string quoted = "\"";
+        for (char c : value) {
+            if (c == '"' || c == '\\') quoted += '\\';
+            quoted += c;
+        }
+        quoted += '"';
+        return raw(key, quoted);
+    }
+
+    StatsWriter& field(const char* key, const char* value) {
+        return field(key, std::string(value));
+    }
+
+    /// Insert a pre-serialised JSON value (object, array, ...).
+    StatsWriter& raw(const char* key, const std::string& json) {
+        if (!first_) out_ += ',';
+        first_ = false;
+        out_ += '"';
+        out_ += key;
+        out_ += "\":";
+        out_ += json;
+        return *this;
+    }
+
+    [[nodiscard]] std::string str() const { return out_ + '}'; }
+
+private:
+    std::string out_ = "{";
+    bool first_ = true;
+};
@@ -0,0 +1,263 @@
+// ─── WizSeries: Strange Attractor Engine ────────────────────────────────────
+// Orbits of chaotic maps of the plane, binned into a density image: a single
+// orbit of a strange attractor visits it with a well-defined long-run
+// density, so a few hundred orbits sampled billions of times show both its
+// fractal shape and how often each part is visited.
+//
+//   Hénon     (x, y) → (1 − a·x² + y, b·x)                    a = 1.4, b = 0.3
+//   Clifford  (x, y) → (sin a·y + c·cos a·x, sin b·x + d·cos b·y)
+//   Lozi      (x, y) → (1 − a·|x| + y, b·x)                   a = 1.7, b = 0.5
+//
+// The engine runs like ChaosGame: orbits in streams of four lanes iterated
+// side by side in 4-wide vectors (Clifford's sines and cosines by a short
+// polynomial), contiguous groups of streams per DensityBuffer slice in
+// parallel, and slices merged without locks.  Orbit states persist, so
+// repeated runs refine the same picture, and the counts depend only on the
+// seed and the number of samples, never on the thread count.
+//
+// locate() finds the window from a pilot orbit in double and reports maps
+// whose orbit escapes to infinity (no bounded attractor for those
+// parameters).  A lane that escapes in float all the same restarts where it
+// started.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include "DensityBuffer.h"
+#include "JobSystem.h"
+#include "Random.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+enum class AttractorKind : std::int32_t { Henon, Clifford, Lozi };
+
+/// A map and its parameters (c and d are Clifford's only).
+struct AttractorSpec {
+    AttractorKind kind = AttractorKind::Henon;
+    float         a    = 1.4f;
+    float         b    = 0.3f;
+    float         c    = 0.0f;
+    float         d    = 0.0f;
+
+    bool operator==(const AttractorSpec&) const = default;
+};
+
+class StrangeAttractor {
+public:
+    static constexpr std::size_t   kStreams = 64;    // × 4 lanes = 256 orbits
+    static constexpr int           kSteps   = 256;   // per lane per round
+    static constexpr std::uint64_t kRound   = kStreams * 4 * kSteps;   // samples
+
+    /// The region of the plane holding the attractor of `spec`, padded by a
+    /// few percent, or nothing when the orbit escapes.
+    static std::optional<PlaneWindow> locate(const AttractorSpec& spec) {
+        double x = 0.1, y = 0.1;
+        double x0 = 0.0, x1 = 0.0, y0 = 0.0, y1 = 0.0;
+        for (int i = 0; i < kPilotWarmup + kPilotSteps; ++i) {
+            const double nx = mapX(spec, x, y);
+            y = mapY(spec, x, y);
+            x = nx;
+            if (!(std::abs(x) < kEscape && std::abs(y) < kEscape)) return std::nullopt;
+            if (i == kPilotWarmup) {
+                x0 = x1 = x;
+                y0 = y1 = y;
+            } else if (i > kPilotWarmup) {
+                x0 = std::min(x0, x);
+                x1 = std::max(x1, x);
+                y0 = std::min(y0, y);
+                y1 = std::max(y1, y);
+            }
+        }
+        // A periodic orbit has no extent: give it a small box to sit in.
+        const double padX = std::max(0.04 * (x1 - x0), 1e-3 * (1.0 + std::abs(x0)));
+        const double padY = std::max(0.04 * (y1 - y0), 1e-3 * (1.0 + std::abs(y0)));
+        return PlaneWindow{static_cast<float>(x0 - padX), static_cast<float>(x1 + padX),
+                           static_cast<float>(y0 - padY), static_cast<float>(y1 + padY)};
+    }
+
+    /// Start over with orbits of `spec` binned over `window` into
+    /// `width`×`height` bins.
+    void reset(const AttractorSpec& spec, const PlaneWindow& window, int width, int height,
+               std::uint64_t seed) {
+        spec_   = spec;
+        window_ = window;
+        density_.resize(width, height);
+        samples_ = 0;
+        seed_    = seed;
+        startStreams(0);
+    }
+
+    /// Continue with fresh orbits after counts were restored from a
+    /// snapshot, reseeded by the sample count.
+    bool restore(std::span<const std::uint32_t> counts, std::uint64_t samples) {
+        if (!density_.assign(counts)) return false;
+        samples_ = samples;
+        startStreams(samples);
+        return true;
+    }
+
+    /// Add at least `samples` points (whole rounds) to the density.
+    void run(std::uint64_t samples, JobSystem* jobs) {
+        switch (spec_.kind) {
+            case AttractorKind::Henon:    runAs<AttractorKind::Henon>(samples, jobs);    break;
+            case AttractorKind::Clifford: runAs<AttractorKind::Clifford>(samples, jobs); break;
+            case AttractorKind::Lozi:     runAs<AttractorKind::Lozi>(samples, jobs);     break;
+        }
+    }
+
+    [[nodiscard]] const DensityBuffer& density() const { return density_; }
+    [[nodiscard]] std::uint64_t        samples() const { return samples_; }
+    [[nodiscard]] const AttractorSpec& spec()    const { return spec_; }
+    [[nodiscard]] const PlaneWindow&   window()  const { return window_; }
+
+    /// sin x in every lane, within 3·10⁻⁷ for |x| up to a few hundred.
+    static f32x4 sin4(f32x4 x) {
+        // Whole turns off (Cody–Waite: 2π split so that k·6.28125 is exact),
+        // then fold [π/2, π] onto [0, π/2] by sin(π − r), likewise below −π/2.
+        const f32x4 turns = x * 0.15915494f;
+        const f32x4 half  = turns >= 0.0f ? f32x4{} + 0.5f : f32x4{} - 0.5f;
+        const f32x4 k     = __builtin_convertvector(
+            __builtin_convertvector(turns + half, i32x4), f32x4);
+        f32x4 r = (x - k * 6.28125f) - k * 1.93530717e-3f;
+        r = r >  1.57079637f ?  3.14159274f - r : r;
+        r = r < -1.57079637f ? -3.14159274f - r : r;
+
+        // Taylor to r¹¹: the first omitted term is below 6·10⁻⁸ on [−π/2, π/2].
+        const f32x4 r2 = r * r;
+        const f32x4 p  = -1.6666667e-1f +
+                        r2 * (8.3333333e-3f +
+                              r2 * (-1.9841270e-4f + r2 * (2.7557319e-6f + r2 * -2.5052108e-8f)));
+        return r + r * r2 * p;
+    }
+
+private:
+    struct Stream {
+        f32x4 x{}, y{};
+        f32x4 x0{}, y0{};   // restart point of each lane
+    };
+
+    static constexpr int    kWarmup      = 64;      // steps before plotting
+    static constexpr int    kPilotWarmup = 1000;
+    static constexpr int    kPilotSteps  = 1 << 16;
+    static constexpr double kEscape      = 1e6;
+
+    AttractorSpec spec_;
+    PlaneWindow   window_;
+    DensityBuffer density_;
+    Stream        streams_[kStreams];
+    std::uint64_t samples_ = 0;
+    std::uint64_t seed_    = 0;
+
+    static double mapX(const AttractorSpec& s, double x, double y) {
+        switch (s.kind) {
+            case AttractorKind::Henon: return 1.0 - s.a * x * x + y;
+            case AttractorKind::Lozi:  return 1.0 - s.a * std::abs(x) + y;
+            case AttractorKind::Clifford:
+                return std::sin(s.a * y) + s.c * std::cos(s.a * x);
+        }
+        return x;
+    }
+
+    static double mapY(const AttractorSpec& s, double x, double y) {
+        if (s.kind == AttractorKind::Clifford) return std::sin(s.b * x) + s.d * std::cos(s.b * y);
+        return s.b * x;
+    }
+
+    /// Seed every lane near the middle of the window from (seed, epoch,
+    /// index) and let it settle on the attractor.
+    void startStreams(std::uint64_t epoch) {
+        const float cx = 0.5f * (window_.x0 + window_.x1);
+        const float cy = 0.5f * (window_.y0 + window_.y1);
+        const float jx = 0.02f * (window_.x1 - window_.x0);
+        const float jy = 0.02f * (window_.y1 - window_.y0);
+        for (std::size_t s = 0; s < kStreams; ++s) {
+            Stream&      st = streams_[s];
+            Xoshiro128x4 rng(seed_ + epoch, s);
+            st.x0 = cx + jx * (rng.unitFloat() - 0.5f);
+            st.y0 = cy + jy * (rng.unitFloat() - 0.5f);
+            st.x  = st.x0;
+            st.y  = st.y0;
+        }
+        switch (spec_.kind) {
+            case AttractorKind::Henon:    settle<AttractorKind::Henon>();    break;
+            case AttractorKind::Clifford: settle<AttractorKind::Clifford>(); break;
+            case AttractorKind::Lozi:     settle<AttractorKind::Lozi>();     break;
+        }
+    }
+
+    template <AttractorKind K>
+    void settle() {
+        for (Stream& st : streams_)
+            for (int i = 0; i < kWarmup; ++i) step<K>(st);
+    }
+
+    template <AttractorKind K>
+    void runAs(std::uint64_t samples, JobSystem* jobs) {
+        if (!density_.bins()) return;
+        const std::uint64_t rounds = (samples + kRound - 1) / kRound;
+        const std::size_t   groups = std::min<std::size_t>(
+            kStreams, jobs ? static_cast<std::size_t>(jobs->workerCount()) + 1 : 1);
+        density_.prepareSlices(groups);
+        for (std::uint64_t r = 0; r < rounds; ++r) {
+            parallelFor(jobs, 0, groups, 1, [&](std::size_t lo, std::size_t hi) {
+                for (std::size_t g = lo; g < hi; ++g)
+                    for (std::size_t s = g * kStreams / groups; s < (g + 1) * kStreams / groups;
+                         ++s)
+                        walk<K>(streams_[s], density_.slice(g));
+            });
+            samples_ += kRound;
+        }
+        density_.mergeSlices(groups, jobs);
+    }
+
+    /// One step of the map in every lane; escaped lanes restart.
+    template <AttractorKind K>
+    void step(Stream& st) const {
+        const float a = spec_.a, b = spec_.b;
+        f32x4 x, y;
+        if constexpr (K == AttractorKind::Henon) {
+            x = 1.0f - a * st.x * st.x + st.y;
+            y = b * st.x;
+        } else if constexpr (K == AttractorKind::Lozi) {
+            const f32x4 ax = st.x < 0.0f ? -st.x : st.x;
+            x = 1.0f - a * ax + st.y;
+            y = b * st.x;
+        } else {
+            constexpr float kQuarterTurn = 1.57079637f;   // cos t = sin(t + π/2)
+            x = sin4(a * st.y) + spec_.c * sin4(a * st.x + kQuarterTurn);
+            y = sin4(b * st.x) + spec_.d * sin4(b * st.y + kQuarterTurn);
+        }
+        // NaN fails both compares, so it restarts too.
+        const f32x4  bound = f32x4{} + static_cast<float>(kEscape);
+        const i32x4  ok    = (x < bound) & (x > -bound) & (y < bound) & (y > -bound);
+        st.x = ok ? x : st.x0;
+        st.y = ok ? y : st.y0;
+    }
+
+    /// kSteps steps of every lane of `st`, binned into `bins`.
+    template <AttractorKind K>
+    void walk(Stream& st, std::span<std::uint32_t> bins) const {
+        const int   w  = density_.width();
+        const int   h  = density_.height();
+        const float sx = static_cast<float>(w) / (window_.x1 - window_.x0);
+        const float sy = static_cast<float>(h) / (window_.y1 - window_.y0);
+        const f32x4 fw = f32x4{} + static_cast<float>(w);
+        const f32x4 fh = f32x4{} + static_cast<float>(h);
+        std::uint32_t* out = bins.data();
+        for (int i = 0; i < kSteps; ++i) {
+            step<K>(st);
+            const f32x4 fx = (st.x - window_.x0) * sx;
+            const f32x4 fy = (st.y - window_.y0) * sy;
+            const i32x4 inside = (fx >= 0.0f) & (fx < fw) & (fy >= 0.0f) & (fy < fh);
+            const i32x4 index  = __builtin_convertvector(fy, i32x4) * w +
+                                 __builtin_convertvector(fx, i32x4);
+            const i32x4 bin    = inside ? index : i32x4{} - 1;
+            for (int lane = 0; lane < 4; ++lane)
+                if (bin[lane] >= 0) ++out[bin[lane]];
+        }
+    }
+};
@@ -0,0 +1,276 @@
+// ─── WizSeries: Incremental Tasks ───────────────────────────────────────────
+// C++20 coroutines for long computations that must not block a frame — the
+// single-threaded WASM build has no other thread to hand them to.  A task
+// body calls  co_await Checkpoint{progress}  between chunks of work; the
+// checkpoint only suspends once the current time slice is spent, so a task
+// with a generous slice runs straight through.  Chunks whose cost varies by
+// orders of magnitude are sized from  co_await SliceLeft{}.
+//
+// SeriesManager::render resumes pending tasks for whatever is left of the
+// frame budget.  Cancelling a task destroys its suspended frame, which runs
+// the destructors of its locals like any other scope exit.  Tasks spawned
+// for an owner (a visualizer) only run while it has the scheduler's focus;
+// the others stay suspended where they were until it comes back.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <list>
+#include <mutex>
+#include <string>
+#include <utility>
+
+/// Budget checkpoint: report `progress` (0..1) and yield if out of time.
+struct Checkpoint {
+    float progress = 0.0f;
+};
+
+/// Seconds left in the current time slice, without yielding (infinite when
+/// the task runs to completion): for sizing the work before a checkpoint.
+struct SliceLeft {};
+
+class Task {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct promise_type {
+        Clock::time_point deadline = Clock::time_point::max();
+        float             progress = 0.0f;
+
+        Task get_return_object() {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() { progress = 1.0f; }
+        void unhandled_exception() { std::terminate(); }
+
+        auto await_transform(Checkpoint c) {
+            progress = std::clamp(c.progress, 0.0f, 1.0f);
+            struct Awaiter {
+                bool ready;
+                bool await_ready() const noexcept { return ready; }
+                void await_suspend(std::coroutine_handle<>) const noexcept {}
+                void await_resume() const noexcept {}
+            };
+            return Awaiter{Clock::now() < deadline};
+        }
+
+        auto await_transform(SliceLeft) const {
+            struct Awaiter {
+                double left;
+                bool   await_ready() const noexcept { return true; }
+                void   await_suspend(std::coroutine_handle<>) const noexcept {}
+                double await_resume() const noexcept { return left; }
+            };
+            if (deadline == Clock::time_point::max())
+                return Awaiter{std::numeric_limits<double>::infinity()};
+            return Awaiter{std::max(0.0, std::chrono::duration<double>(deadline - Clock::now())
+                                             .count())};
+        }
+    };
+
+    Task() = default;
+    Task(Task&& o) noexcept : h_(std::exchange(o.h_, {})) {}
+    Task& operator=(Task&& o) noexcept {
+        if (this != &o) {
+            reset();
+            h_ = std::exchange(o.h_, {});
+        }
+        return *this;
+    }
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+    ~Task() { reset(); }
+
+    /// Run until the next checkpoint at or after `deadline`, or to the end.
+    /// Returns true once the body has finished.
+    bool resume(Clock::time_point deadline) {
+        if (done()) return true;
+        h_.promise().deadline = deadline;
+        h_.resume();
+        return h_.done();
+    }
+
+    /// Run to the end without yielding (no scheduler attached).
+    void runToCompletion() { resume(Clock::time_point::max()); }
+
+    [[nodiscard]] bool  done() const { return !h_ || h_.done(); }
+    [[nodiscard]] float progress() const { return h_ ? h_.promise().progress : 1.0f; }
+
+    /// Destroy the (suspended) frame; the body never runs again.
+    void reset() {
+        if (h_) h_.destroy();
+        h_ = {};
+    }
+
+private:
+    explicit Task(std::coroutine_handle<promise_type> h) : h_(h) {}
+
+    std::coroutine_handle<promise_type> h_;
+};
+
+/// Pending tasks, resumed round-robin from the main thread within a time
+/// slice.  spawn()/cancel() may also come from a visualizer rendering on the
+/// frame pipeline's producer lane, which never overlaps run().  A body must
+/// not cancel itself.
+class TaskScheduler {
+public:
+    using TaskId = std::uint32_t;
+    using Owner  = const void*;
+
+    struct Stats {
+        int           pending   = 0;
+        int           paused    = 0;     // pending, but their owner is out of focus
+        std::uint64_t completed = 0;
+        std::uint64_t cancelled = 0;
+        double        lastMs    = 0.0;   // time spent in the last run()
+        float         progress  = 1.0f;  // least-advanced running task…
+        std::string   slowest;           // …and its name
+    };
+
+    /// Queue `task` for `owner` (null: always runs); it first runs on the
+    /// next run() that `owner` has the focus for.  Ids are never 0.
+    TaskId spawn(std::string name, Task task, Owner owner = nullptr) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const TaskId id = ++next_id_;
+        entries_.push_back({id, std::move(name), std::move(task), owner});
+        return id;
+    }
+
+    /// Run only the tasks of `owner` and unowned ones; every other owner's
+    /// tasks are paused, not dropped.  Null (the default) runs everything.
+    void focus(Owner owner) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        focus_ = owner;
+    }
+
+    /// Drop a pending task.  Unknown or finished ids are ignored.
+    void cancel(TaskId id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = std::find_if(entries_.begin(), entries_.end(),
+                               [id](const Entry& e) { return e.id == id; });
+        if (it == entries_.end()) return;
+        entries_.erase(it);
+        ++cancelled_;
+    }
+
+    /// True while `id` is still queued.
+    [[nodiscard]] bool pending(TaskId id) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return std::any_of(entries_.begin(), entries_.end(),
+                           [id](const Entry& e) { return e.id == id; });
+    }
+
+    /// Resume tasks in turn until `sliceMs` has elapsed or none are left to
+    /// run.  Every running task gets at least one resume per call.
+    void run(double sliceMs) {
+        const auto t0       = Task::Clock::now();
+        const auto deadline = t0 + std::chrono::duration_cast<Task::Clock::duration>(
+                                       std::chrono::duration<double, std::milli>(sliceMs));
+        std::unique_lock<std::mutex> lock(mutex_);
+        bool firstPass = true;
+        bool resumed   = false;   // in this pass
+        for (auto it = entries_.begin();;) {
+            if (it == entries_.end()) {
+                if (!resumed || entries_.empty()) break;
+                it        = entries_.begin();
+                firstPass = false;
+                resumed   = false;
+            }
+            if (!firstPass && Task::Clock::now() >= deadline) break;
+            if (!running(*it)) {
+                ++it;
+                continue;
+            }
+            resumed = true;
+
+            // Resumed without the lock so a body may spawn follow-up tasks;
+            // list iterators stay valid across the insertion.
+            Task& task = it->task;
+            lock.unlock();
+            const bool finished = task.resume(deadline);
+            lock.lock();
+            if (finished) {
+                it = entries_.erase(it);
+                ++completed_;
+            } else {
+                ++it;
+            }
+        }
+        last_ms_ = std::chrono::duration<double, std::milli>(Task::Clock::now() - t0).count();
+    }
+
+    /// Run every task in focus to completion (tools and tests).
+    void finish() {
+        while (!idle()) run(1e9);
+    }
+
+    [[nodiscard]] bool empty() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return entries_.empty();
+    }
+
+    /// True when run() has nothing to resume: no tasks, or only paused ones.
+    [[nodiscard]] bool idle() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return std::none_of(entries_.begin(), entries_.end(),
+                            [this](const Entry& e) { return running(e); });
+    }
+
+    [[nodiscard]] Stats stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Stats s;
+        s.pending   = static_cast<int>(entries_.size());
+        s.completed = completed_;
+        s.cancelled = cancelled_;
+        s.lastMs    = last_ms_;
+        for (const Entry& e : entries_) {
+            if (!running(e)) {
+                ++s.paused;
+                continue;
+            }
+            if (e.task.progress() > s.progress) continue;
+            s.progress = e.task.progress();
+            s.slowest  = e.name;
+        }
+        return s;
+    }
+
+private:
+    struct Entry {
+        TaskId      id;
+        std::string name;
+        Task        task;
+        Owner       owner;
+    };
+
+    mutable std::mutex mutex_;
+    std::list<Entry>   entries_;
+    Owner              focus_     = nullptr;
+    TaskId             next_id_   = 0;
+    std::uint64_t      completed_ = 0;
+    std::uint64_t      cancelled_ = 0;
+    double             last_ms_   = 0.0;
+
+    /// Not paused (callers hold the lock).
+    [[nodiscard]] bool running(const Entry& e) const {
+        return !focus_ || !e.owner || e.owner == focus_;
+    }
+};
+
+/// Queue `task` for `owner` on `tasks`, or run it to completion right away
+/// when there is no scheduler.  Returns the id, or 0 when it already finished.
+inline TaskScheduler::TaskId spawnTask(TaskScheduler* tasks, std::string name, Task task,
+                                       TaskScheduler::Owner owner = nullptr) {
+    if (!tasks) {
+        task.runToCompletion();
+        return 0;
+    }
+    return tasks->spawn(std::move(name), std::move(task), owner);
+}
@@ -0,0 +1,67 @@
+// ─── WizSeries: Visualizer Registry ─────────────────────────────────────────
+// Single table of every visualizer key and its factory.  SeriesManager builds
+// its instances from here, and the native tools use it to run any visualizer
+// by name without a browser.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include "ISeriesVisualizer.h"
+#include "AlternatingHarmonicVisualizer.h"
+#include "AperyConstantVisualizer.h"
+#include "AttractorVisualizer.h"
+#include "BaselProblemVisualizer.h"
+#include "CantorSetVisualizer.h"
+#include "ESeriesVisualizer.h"
+#include "GeometricProgressionVisualizer.h"
+#include "GregoryLeibnizVisualizer.h"
+#include "HarmonicProgressionVisualizer.h"
+#include "InfiniteProductVisualizer.h"
+#include "InverseGeometricVisualizer.h"
+#include "KempnerVisualizer.h"
+#include "LogisticMapVisualizer.h"
+#include "LyapunovVisualizer.h"
+#include "RandomHarmonicVisualizer.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+struct VisualizerEntry {
+    const char* name;
+    std::unique_ptr<ISeriesVisualizer> (*create)();
+};
+
+template <typename T>
+std::unique_ptr<ISeriesVisualizer> makeVisualizer() {
+    return std::make_unique<T>();
+}
+
+/// All visualizers, in the order the UI lists them.
+inline const std::vector<VisualizerEntry>& visualizerRegistry() {
+    static const std::vector<VisualizerEntry> entries = {
+        {"cantor",           &makeVisualizer<CantorSetVisualizer>},
+        {"harmonic",         &makeVisualizer<HarmonicProgressionVisualizer>},
+        {"kempner",          &makeVisualizer<KempnerVisualizer>},
+        {"geometric",        &makeVisualizer<GeometricProgressionVisualizer>},
+        {"logistic",         &makeVisualizer<LogisticMapVisualizer>},
+        {"lyapunov",         &makeVisualizer<LyapunovVisualizer>},
+        {"attractor",        &makeVisualizer<AttractorVisualizer>},
+        {"basel",            &makeVisualizer<BaselProblemVisualizer>},
+        {"alt_harmonic",     &makeVisualizer<AlternatingHarmonicVisualizer>},
+        {"random_harmonic",  &makeVisualizer<RandomHarmonicVisualizer>},
+        {"e_series",         &makeVisualizer<ESeriesVisualizer>},
+        {"inv_geometric",    &makeVisualizer<InverseGeometricVisualizer>},
+        {"gregory_leibniz",  &makeVisualizer<GregoryLeibnizVisualizer>},
+        {"apery",            &makeVisualizer<AperyConstantVisualizer>},
+        {"infinite_product", &makeVisualizer<InfiniteProductVisualizer>},
+    };
+    return entries;
+}
+
+/// Create a visualizer by key, or nullptr if the key is unknown.
+inline std::unique_ptr<ISeriesVisualizer> createVisualizer(
+    const std::string& name) {
+    for (const auto& e : visualizerRegistry())
+        if (name == e.name) return e.create();
+    return nullptr;
+}
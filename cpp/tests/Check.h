@@ -0,0 +1,38 @@
+// ─── WizSeries: Unit Test Checks ────────────────────────────────────────────
+// The pass/fail bookkeeping every unit test shares: check() prints each
+// failed condition and counts it, and checkResult() prints the one-line
+// summary and gives main() its exit code.
+//
+//   check(sum == 10, "sum of %d terms", n);
+//   return checkResult("partial sums");   // "ok    partial sums"
+// ────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include <cstdio>
+
+/// Failed checks so far.
+inline int& checkFailures() {
+    static int failures = 0;
+    return failures;
+}
+
+/// Report `what` (a printf format when `args` are given) unless `ok`.
+template <typename... Args>
+void check(bool ok, const char* what, const Args&... args) {
+    if (ok) return;
+    std::fputs("FAIL  ", stdout);
+    if constexpr (sizeof...(Args) == 0) std::fputs(what, stdout);
+    else                                std::printf(what, args...);
+    std::fputc('\n', stdout);
+    ++checkFailures();
+}
+
+/// Summary line for `suite`; 0 if every check passed, else 1.
+inline int checkResult(const char* suite) {
+    if (const int failed = checkFailures()) {
+        std::printf("FAIL  %s: %d check(s) failed\n", suite, failed);
+        return 1;
+    }
+    std::printf("ok    %s\n", suite);
+    return 0;
+}
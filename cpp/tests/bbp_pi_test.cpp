@@ -0,0 +1,45 @@
+// ─── WizSeries: BBP Digit Extraction Test ───────────────────────────────────
+// Checks BbpPi against the hex expansion of π: the leading digits, and the
+// digits Bailey lists at positions 10⁶ and 10⁷.  Extracting a range matches
+// extracting each position alone, and the fraction is the same bit for bit
+// however its terms are split — over a job system or into separate ranges.
+//
+//   bbp_pi_test
+// ────────────────────────────────────────────────────────────────────────────
+
+#include "series/BbpPi.h"
+#include "tests/Check.h"
+
+#include <cstdint>
+#include <string>
+
+int main() {
+    // π = 3.243F6A8885A308D313198A2E03707344A4093822299F31D0082EFA98EC4E6C89…
+    const std::string lead = "243F6A8885A308D313198A2E03707344A4093822299F31D0082EFA98EC4E6C89";
+    check(BbpPi::hexDigits(0, 64) == lead, "leading digits");
+    check(BbpPi::hexDigits(17, 30) == lead.substr(17, 30), "digits from an offset");
+
+    // Bailey, "The BBP algorithm for pi": digits from position 10⁶ and 10⁷ on.
+    check(BbpPi::hexDigits(999'999, 10) == "26C65E52CB", "position 10^6");
+    check(BbpPi::hexDigits(9'999'999, 9) == "17AF5863E", "position 10^7");
+    check(BbpPi::reliableDigits(1'000'000) == 10 && BbpPi::reliableDigits(100'000'000) == 8,
+          "reliable digits");
+    check(BbpPi::hexDigits(std::uint64_t{1} << 58, 4).empty(), "no exact digits, none returned");
+
+    // The same terms on a job system, and split into ranges.
+    {
+        constexpr std::uint64_t d = 250'000;
+        const std::uint64_t     serial = BbpPi::fraction(d);
+        JobSystem               jobs(3);
+        check(BbpPi::fraction(d, &jobs) == serial, "threaded fraction matches");
+        const std::uint64_t split = BbpPi::terms(d, 0, 70'001) +
+                                    BbpPi::terms(d, 70'001, 200'000, &jobs) +
+                                    BbpPi::terms(d, 200'000, d + 1) + BbpPi::tail(d);
+        check(split == serial, "split ranges match");
+        check(BbpPi::hexDigits(d, 40, &jobs) == BbpPi::hexDigits(d, 20) +
+                                                BbpPi::hexDigits(d + 20, 20, &jobs),
+              "range extraction matches");
+    }
+
+    return checkResult("BBP pi");
+}
@@ -0,0 +1,94 @@
+// ─── WizSeries: Chaos Game Test ─────────────────────────────────────────────
+// Checks ChaosGame against properties of known attractors: every sample of
+// the Sierpinski triangle lands in its window and none in the removed
+// middle triangle, Cantor dust leaves the middle thirds empty, weights
+// split the points as asked, and the counts are the same single-threaded
+// and on a job system.
+//
+//   chaos_game_test
+// ────────────────────────────────────────────────────────────────────────────
+
+#include "series/ChaosGame.h"
+#include "tests/Check.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+std::uint64_t total(const DensityBuffer& d) {
+    std::uint64_t n = 0;
+    for (const std::uint32_t c : d.counts()) n += c;
+    return n;
+}
+
+} // namespace
+
+int main() {
+    constexpr int kBins = 243;   // 3⁵: Cantor gaps fall on bin edges
+
+    const AffineMap sierpinski[] = {
+        {0.5f, 0, 0, 0.5f, 0,     0,    1},
+        {0.5f, 0, 0, 0.5f, 0.5f,  0,    1},
+        {0.5f, 0, 0, 0.5f, 0.25f, 0.5f, 1},
+    };
+    ChaosGame tri;
+    tri.reset(sierpinski, {0, 1, 0, 1}, 256, 256, 1);
+    tri.run(1'000'000, nullptr);
+    check(tri.samples() >= 1'000'000, "requested samples run");
+    check(total(tri.density()) == tri.samples(), "every sample in the window");
+
+    // The removed middle triangle (1/4, 1/2)–(3/4, 1/2)–(1/2, 0), shrunk
+    // by two bins: at height y it spans x = 1/2 ± y/2.
+    std::uint64_t middle = 0;
+    for (int y = 4; y < 124; ++y)
+        for (int x = 128 - y / 2 + 2; x < 128 + y / 2 - 2; ++x)
+            middle += tri.density().counts()[static_cast<std::size_t>(y) * 256 + x];
+    check(middle == 0, "Sierpinski middle triangle empty");
+
+    const AffineMap dust[] = {
+        {1.0f / 3, 0, 0, 1.0f / 3, 0,        0,        1},
+        {1.0f / 3, 0, 0, 1.0f / 3, 2.0f / 3, 0,        1},
+        {1.0f / 3, 0, 0, 1.0f / 3, 0,        2.0f / 3, 1},
+        {1.0f / 3, 0, 0, 1.0f / 3, 2.0f / 3, 2.0f / 3, 1},
+    };
+    ChaosGame cantor;
+    cantor.reset(dust, {0, 1, 0, 1}, kBins, kBins, 2);
+    cantor.run(2'000'000, nullptr);
+    const DensityBuffer& d = cantor.density();
+    std::uint64_t gaps = 0;
+    for (int y = 0; y < kBins; ++y)
+        for (int x = kBins / 3 + 1; x < 2 * kBins / 3 - 1; ++x)
+            gaps += d.counts()[static_cast<std::size_t>(y) * kBins + x] +
+                    d.counts()[static_cast<std::size_t>(x) * kBins + y];
+    check(gaps == 0, "Cantor dust middle thirds empty");
+
+    // Weight 3 : 1 between two halves of the unit square.
+    const AffineMap halves[] = {
+        {0.5f, 0, 0, 1, 0,    0, 3},
+        {0.5f, 0, 0, 1, 0.5f, 0, 1},
+    };
+    ChaosGame weighted;
+    weighted.reset(halves, {0, 1, -1, 2}, 2, 1, 3);
+    weighted.run(1'000'000, nullptr);
+    const double left = static_cast<double>(weighted.density().counts()[0]) /
+                        static_cast<double>(weighted.samples());
+    check(left > 0.745 && left < 0.755, "weights split the samples");
+
+    // Same seed, same counts, with or without worker threads.
+    JobSystem jobs(3);
+    ChaosGame serial, parallel;
+    serial.reset(dust, {0, 1, 0, 1}, kBins, kBins, 4);
+    parallel.reset(dust, {0, 1, 0, 1}, kBins, kBins, 4);
+    serial.run(5 * ChaosGame::kRound, nullptr);
+    parallel.run(2 * ChaosGame::kRound, &jobs);
+    parallel.run(3 * ChaosGame::kRound, &jobs);
+    const auto a = serial.density().counts();
+    const auto b = parallel.density().counts();
+    check(serial.samples() == parallel.samples() &&
+              std::vector<std::uint32_t>(a.begin(), a.end()) ==
+                  std::vector<std::uint32_t>(b.begin(), b.end()),
+          "counts independent of threads and run sizes");
+
+    return checkResult("chaos game");
+}
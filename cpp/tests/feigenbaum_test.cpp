@@ -0,0 +1,54 @@
+// ─── WizSeries: Feigenbaum Test ─────────────────────────────────────────────
+// Checks DoubleDouble arithmetic and FeigenbaumEngine against the closed
+// forms for the first levels (R_1 = 1 + √5, b_1 = 3, b_2 = 1 + √6) and the
+// published values of δ, α and r∞.
+//
+//   feigenbaum_test
+// ────────────────────────────────────────────────────────────────────────────
+
+#include "series/Feigenbaum.h"
+#include "tests/Check.h"
+
+#include <cmath>
+#include <string>
+
+namespace {
+
+bool near(double a, double b, double tol) { return std::abs(a - b) <= tol; }
+
+} // namespace
+
+int main() {
+    // 1/3 carries ~32 digits; 3·(1/3) − 1 is below double's resolution of 1.
+    const DoubleDouble third = DoubleDouble(1.0) / DoubleDouble(3.0);
+    check(std::abs((third * 3.0 - 1.0).hi) < 1e-31, "double-double division");
+    check(third.toString(20) == "0.33333333333333333333", "double-double digits");
+    check((DoubleDouble(1e16) + 1.0 - 1e16).hi == 1.0, "double-double sum keeps low bits");
+
+    FeigenbaumEngine engine;
+    const auto& levels = engine.extend(20);
+    check(levels.size() == 21, "levels 0 … 20");
+    check(static_cast<double>(levels[0].superstable) == 2.0, "R_0 = 2");
+    check(near(static_cast<double>(levels[1].superstable), 1.0 + std::sqrt(5.0), 1e-15),
+          "R_1 = 1 + sqrt 5");
+    check(near(levels[1].bifurcation, 3.0, 1e-12), "b_1 = 3");
+    check(near(levels[2].bifurcation, 1.0 + std::sqrt(6.0), 1e-12), "b_2 = 1 + sqrt 6");
+
+    bool increasing = true;
+    for (std::size_t n = 1; n < levels.size(); ++n)
+        increasing &= levels[n - 1].superstable < levels[n].superstable;
+    check(increasing, "R_n increasing");
+    for (int n = 2; n <= FeigenbaumEngine::kMaxBifurcationLevel; ++n)
+        increasing &= levels[n - 1].bifurcation < levels[n].bifurcation &&
+                      levels[n].bifurcation < static_cast<double>(levels[n].superstable);
+    check(increasing, "b_n increasing and below R_n");
+
+    check(near(engine.delta(), 4.669201609102990, 1e-11), "delta");
+    check(near(engine.alpha(), -2.502907875095893, 1e-9), "alpha");
+    check(engine.accumulation().toString(20) == "3.5699456718709449018", "r_inf");
+
+    // Cached levels are returned, not recomputed.
+    check(&engine.extend(10) == &levels && levels.size() == 21, "extend keeps levels");
+
+    return checkResult("feigenbaum");
+}
@@ -0,0 +1,195 @@
+// ─── WizSeries: Frame Pipeline Test ─────────────────────────────────────────
+// Renders visualizers through a depth-2 FramePipeline and checks that the
+// target receives exactly what a direct render gives it: the typed draws
+// (series data, bifurcation, Lyapunov, density) with the same arrays when
+// the target takes them, and the CPU-built vertices when it does not.
+//
+//   frame_pipeline_test
+// ────────────────────────────────────────────────────────────────────────────
+
+#include "series/FramePipeline.h"
+#include "series/VisualizerRegistry.h"
+#include "tests/Check.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr float kWidth  = 240.0f;
+constexpr float kHeight = 150.0f;
+constexpr float kTime   = 30.0f;
+
+/// Backend stand-in that logs every call it gets, arrays by content (and
+/// not the owner ids, which differ between visualizer instances).
+class LogRenderer : public IRenderer {
+public:
+    explicit LogRenderer(TypedDrawSupport support) : support_(support) {}
+
+    std::string log;
+
+    void beginFrame(float width, float height) override {
+        log.clear();
+        add("frame", width, height);
+    }
+
+    [[nodiscard]] TypedDrawSupport typedDraws() const override { return support_; }
+
+    bool drawSeriesData(const SeriesDataDraw& d) override {
+        if (!support_.seriesData) return false;
+        add("series", layer(), d.revision, hash(d.terms), hash(d.sums),
+            static_cast<int>(d.part), d.first, d.count, d.xMin, d.barW, d.gap, d.base,
+            d.yPerUnit, d.reveal, d.barAlpha, d.palette.hue, d.palette.hueShift, d.sumColour[0]);
+        return true;
+    }
+
+    bool drawBifurcation(const BifurcationDraw& d) override {
+        if (!support_.bifurcation) return false;
+        add("bifurcation", layer(), d.rMin, d.rMax, d.columns, d.visible, d.warmup, d.samples,
+            d.xMin, d.xMax, d.yMin, d.yMax, d.hue, d.alpha, d.pointSize);
+        return true;
+    }
+
+    bool drawLyapunov(const LyapunovDraw& d) override {
+        if (!support_.lyapunov) return false;
+        add("lyapunov", layer(), d.pattern, d.length, d.warmup, d.iterations, d.perFrame,
+            d.aMin, d.aMax, d.bMin, d.bMax, d.xMin, d.xMax, d.yMin, d.yMax, d.contrast);
+        return true;
+    }
+
+    bool drawDensity(const DensityDraw& d) override {
+        if (!support_.density) return false;
+        add("density", layer(), d.revision, hash(d.counts), d.width, d.height,
+            d.maxCount, d.xMin, d.xMax, d.yMin, d.yMax, d.hue, d.val);
+        return true;
+    }
+
+protected:
+    void draw(std::span<const Vertex> verts, Primitive mode, float pointSize) override {
+        add("vertices", layer(), static_cast<int>(mode), pointSize, verts.size(),
+            hash(std::as_bytes(verts)));
+    }
+
+private:
+    TypedDrawSupport support_;
+
+    template <typename T>
+    static std::uint64_t hash(std::span<const T> values) {
+        std::uint64_t h = 0xcbf29ce484222325ull;   // FNV-1a
+        for (const std::byte b : std::as_bytes(values))
+            h = (h ^ static_cast<std::uint8_t>(b)) * 0x100000001b3ull;
+        return h;
+    }
+
+    template <typename... Args>
+    void add(const char* what, const Args&... args) {
+        log += what;
+        ((log += ' ', log += field(args)), ...);
+        log += '\n';
+    }
+
+    template <typename T>
+    static std::string field(const T& v) {
+        char buf[40];
+        if constexpr (std::is_floating_point_v<T>)
+            std::snprintf(buf, sizeof(buf), "%a", static_cast<double>(v));
+        else
+            std::snprintf(buf, sizeof(buf), "%llu", static_cast<unsigned long long>(v));
+        return buf;
+    }
+};
+
+struct Case {
+    const char*                                viz;
+    std::vector<std::pair<std::string, float>> params;
+    const char*                                typed;   // draw the GPU target should get
+};
+
+std::unique_ptr<ISeriesVisualizer> make(const Case& c, JobSystem& jobs) {
+    auto viz = createVisualizer(c.viz);
+    viz->attachJobs(&jobs);
+    for (const auto& [name, value] : c.params) viz->setParam(name, value);
+    return viz;
+}
+
+/// What `target` gets from the visualizer rendered directly.
+std::string direct(const Case& c, JobSystem& jobs, LogRenderer& target) {
+    auto viz = make(c, jobs);
+    target.beginFrame(kWidth, kHeight);
+    viz->render(kTime, kWidth, kHeight, target);
+    target.endFrame();
+    return target.log;
+}
+
+/// What `target` gets from the visualizer through a depth-2 pipeline, once
+/// a few frames have gone through it.
+std::string pipelined(const Case& c, JobSystem& jobs, LogRenderer& target) {
+    auto          viz = make(c, jobs);
+    FramePipeline pipeline(jobs);
+    pipeline.setDepth(2);
+    for (int frame = 0; frame < 4; ++frame) pipeline.frame(*viz, kTime, kWidth, kHeight, target);
+    pipeline.drain();
+    return target.log;
+}
+
+} // namespace
+
+int main() {
+    JobSystem jobs;
+
+    const std::vector<Case> cases = {
+        {"harmonic",        {{"terms", 300.0f}},                                "series"},
+        {"harmonic",        {{"terms", 100000.0f}},                             nullptr},
+        {"alt_harmonic",    {{"mode", 1.0f}, {"terms", 400.0f}},                "series"},
+        {"logistic",        {{"growth_rate", 3.7f}},                            "bifurcation"},
+        {"lyapunov",        {{"sequence", 2.0f}, {"iterations", 400.0f}},       "lyapunov"},
+        {"cantor",          {{"mode", 1.0f}, {"samples", 1.0f}},                "density"},
+        {"attractor",       {{"attractor", 0.0f}, {"samples", 1.0f}},           "density"},
+        {"random_harmonic", {{"paths", 0.2f}, {"terms", 256.0f}, {"seed", 7.0f}}, "density"},
+    };
+
+    const TypedDrawSupport all{.seriesData = true, .bifurcation = true, .lyapunov = true,
+                               .density = true};
+    for (const Case& c : cases) {
+        for (const TypedDrawSupport support : {all, TypedDrawSupport{}}) {
+            LogRenderer a(support), b(support);
+            const std::string want = direct(c, jobs, a);
+            const std::string got  = pipelined(c, jobs, b);
+            const bool        gpu  = support.seriesData;
+            check(got == want, "%s: pipelined frame matches a direct one (%s target)", c.viz,
+                  gpu ? "typed" : "vertex");
+            if (gpu && c.typed)
+                check(got.find(std::string(c.typed) + ' ') != std::string::npos,
+                      "%s: typed %s draw replayed", c.viz, c.typed);
+            if (!gpu)
+                check(got.find("vertices") != std::string::npos, "%s: CPU vertices replayed",
+                      c.viz);
+        }
+    }
+
+    // Series arrays recorded in later frames extend the earlier copies: a
+    // grown series still reaches the target whole.
+    {
+        LogRenderer   a(all), b(all);
+        const Case    small{"harmonic", {{"terms", 300.0f}}, nullptr};
+        const Case    grown{"harmonic", {{"terms", 500.0f}}, nullptr};
+        auto          viz = make(small, jobs);
+        FramePipeline pipeline(jobs);
+        pipeline.setDepth(2);
+        for (int frame = 0; frame < 3; ++frame) pipeline.frame(*viz, kTime, kWidth, kHeight, b);
+        pipeline.drain();
+        viz->setParam("terms", 500.0f);
+        for (int frame = 0; frame < 3; ++frame) pipeline.frame(*viz, kTime, kWidth, kHeight, b);
+        pipeline.drain();
+        check(b.log == direct(grown, jobs, a), "grown series replays whole");
+    }
+
+    return checkResult("frame pipeline");
+}
@@ -0,0 +1,259 @@
+// ─── WizSeries: Golden-Image Regression Test ───────────────────────────────
+// Renders every visualizer at fixed times and parameters through the CPU
+// SoftwareRenderer and compares the frames with the reference images in
+// tests/golden/.  Pixels are compared in CIELAB space (ΔE76) and a pixel
+// only counts as different if no reference pixel in its 3×3 neighbourhood
+// matches, which absorbs sub-pixel shifts from compiler/FPU differences.
+// Failing cases write <case>.actual.ppm and <case>.diff.ppm to --out-dir.
+//
+//   golden_test [--ref-dir DIR] [--out-dir DIR] [--filter SUBSTR] [--update]
+// ────────────────────────────────────────────────────────────────────────────
+
+#include "tools/ImageIO.h"
+#include "series/SoftwareRenderer.h"
+#include "series/VisualizerRegistry.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr int   kWidth         = 240;
+constexpr int   kHeight        = 150;
+constexpr int   kSupersample   = 2;
+constexpr float kDefaultTime   = 30.0f;   // every reveal animation finished
+
+constexpr double kPixelDeltaE  = 8.0;     // just-noticeable ≈ 2.3; be lenient
+constexpr double kMaxBadFrac   = 0.002;   // 0.2 % of pixels may differ
+
+struct GoldenCase {
+    std::string name;
+    std::string viz;
+    float       time = kDefaultTime;
+    std::vector<std::pair<std::string, float>> params;
+    float       viewScale  = 1.0f;
+    float       viewOffset = 0.0f;
+};
+
+/// One default-parameter case per registered visualizer, plus extra cases
+/// that pin mid-animation frames, edge parameters and the view transform.
+std::vector<GoldenCase> goldenCases() {
+    std::vector<GoldenCase> cases;
+    for (const auto& e : visualizerRegistry()) cases.push_back({e.name, e.name, kDefaultTime, {}});
+
+    cases.push_back({"cantor_reveal",      "cantor",    1.2f, {{"depth", 9.0f}}});
+    cases.push_back({"geometric_negative", "geometric", kDefaultTime,
+                     {{"ratio", -0.8f}, {"terms", 30.0f}}});
+    cases.push_back({"geometric_diverge",  "geometric", kDefaultTime,
+                     {{"ratio", 1.1f}, {"terms", 20.0f}}});
+    cases.push_back({"logistic_sweep",     "logistic",  1.0f,
+                     {{"growth_rate", 3.7f}}});
+    cases.push_back({"harmonic_many",      "harmonic",  kDefaultTime,
+                     {{"terms", 300.0f}}});
+    cases.push_back({"basel_zoomed",       "basel",     kDefaultTime, {},
+                     2.5f, -0.8f});
+    cases.push_back({"harmonic_autoscale", "harmonic",  kDefaultTime,
+                     {{"terms", 300.0f}}, 3.0f, 2.0f});
+    cases.push_back({"harmonic_dense",     "harmonic",  kDefaultTime,
+                     {{"terms", 100000.0f}}});
+    cases.push_back({"lyapunov_zircon",    "lyapunov",  kDefaultTime,
+                     {{"sequence", 2.0f}, {"iterations", 400.0f}}});
+    cases.push_back({"cantor_ifs_dust",    "cantor",    kDefaultTime,
+                     {{"mode", 1.0f}, {"samples", 1.0f}}});
+    cases.push_back({"cantor_ifs_fern",    "cantor",    kDefaultTime,
+                     {{"mode", 1.0f}, {"ifs", 3.0f}, {"samples", 2.0f}}});
+    cases.push_back({"attractor_henon",    "attractor", kDefaultTime,
+                     {{"attractor", 0.0f}, {"samples", 4.0f}}});
+    cases.push_back({"attractor_lozi",     "attractor", kDefaultTime,
+                     {{"attractor", 2.0f}, {"samples", 4.0f}}});
+    cases.push_back({"random_harmonic_few", "random_harmonic", kDefaultTime,
+                     {{"paths", 0.2f}, {"terms", 256.0f}, {"seed", 7.0f}}});
+    cases.push_back({"alt_harmonic_rearranged", "alt_harmonic", kDefaultTime,
+                     {{"mode", 1.0f}, {"target", 1.5f}, {"terms", 400.0f}}});
+    cases.push_back({"alt_harmonic_rearranged_dense", "alt_harmonic", kDefaultTime,
+                     {{"mode", 1.0f}, {"target", -0.5f}, {"terms", 1000000.0f}}});
+    cases.push_back({"kempner_string",     "kempner",   kDefaultTime,
+                     {{"exclude", 42.0f}, {"exclude_width", 2.0f}, {"direct", 6.0f}}});
+    cases.push_back({"gregory_leibniz_bbp", "gregory_leibniz", kDefaultTime,
+                     {{"mode", 1.0f}, {"position_lo", 0.0f}, {"digits", 64.0f}}});
+    cases.push_back({"gregory_leibniz_bbp_deep", "gregory_leibniz", kDefaultTime,
+                     {{"mode", 1.0f}, {"position_lo", 1000000.0f}, {"digits", 20.0f}}});
+    cases.push_back({"infinite_product_viete", "infinite_product", kDefaultTime,
+                     {{"product", 1.0f}, {"terms", 12.0f}}});
+    cases.push_back({"infinite_product_euler", "infinite_product", kDefaultTime,
+                     {{"product", 2.0f}, {"s", 1.5f}, {"terms", 1000000.0f}}});
+    return cases;
+}
+
+// ── Perceptual colour difference ────────────────────────────────────────────
+
+struct Lab {
+    double L, a, b;
+};
+
+Lab toLab(const std::uint8_t* px) {
+    auto lin = [](std::uint8_t c) {
+        const double v = c / 255.0;
+        return v <= 0.04045 ? v / 12.92 : std::pow((v + 0.055) / 1.055, 2.4);
+    };
+    const double r = lin(px[0]), g = lin(px[1]), b = lin(px[2]);
+    const double X = (0.4124 * r + 0.3576 * g + 0.1805 * b) / 0.95047;
+    const double Y =  0.2126 * r + 0.7152 * g + 0.0722 * b;
+    const double Z = (0.0193 * r + 0.1192 * g + 0.9505 * b) / 1.08883;
+    auto f = [](double t) {
+        return t > 0.008856 ? std::cbrt(t) : 7.787 * t + 16.0 / 116.0;
+    };
+    const double fx = f(X), fy = f(Y), fz = f(Z);
+    return {116.0 * fy - 16.0, 500.0 * (fx - fy), 200.0 * (fy - fz)};
+}
+
+double deltaE(const Lab& p, const Lab& q) {
+    return std::sqrt((p.L - q.L) * (p.L - q.L) + (p.a - q.a) * (p.a - q.a)
+                     + (p.b - q.b) * (p.b - q.b));
+}
+
+struct CompareResult {
+    int    bad = 0;
+    double worst = 0.0;
+    std::vector<std::uint8_t> diff;   // RGB visualisation
+};
+
+CompareResult compareImages(const std::vector<std::uint8_t>& ref,
+                            const std::vector<std::uint8_t>& act, int w, int h) {
+    std::vector<Lab> refLab(static_cast<size_t>(w) * h);
+    for (size_t i = 0; i < refLab.size(); ++i) refLab[i] = toLab(&ref[i * 3]);
+
+    CompareResult res;
+    res.diff.resize(ref.size());
+    for (int y = 0; y < h; ++y) {
+        for (int x = 0; x < w; ++x) {
+            const size_t i = static_cast<size_t>(y) * w + x;
+            const Lab a = toLab(&act[i * 3]);
+
+            double best = deltaE(a, refLab[i]);
+            for (int dy = -1; dy <= 1 && best > kPixelDeltaE; ++dy)
+                for (int dx = -1; dx <= 1; ++dx) {
+                    const int nx = x + dx, ny = y + dy;
+                    if (nx < 0 || ny < 0 || nx >= w || ny >= h) continue;
+                    best = std::min(best,
+                                    deltaE(a, refLab[static_cast<size_t>(ny) * w + nx]));
+                }
+
+            // Dimmed greyscale reference with failing pixels in red.
+            const auto grey = static_cast<std::uint8_t>(
+                std::clamp(refLab[i].L * 2.55 * 0.35 + 150.0, 0.0, 255.0));
+            std::uint8_t* d = &res.diff[i * 3];
+            d[0] = d[1] = d[2] = grey;
+            if (best > kPixelDeltaE) {
+                ++res.bad;
+                d[0] = 255;
+                d[1] = d[2] = static_cast<std::uint8_t>(
+                    std::clamp(120.0 - best * 4.0, 0.0, 120.0));
+            }
+            res.worst = std::max(res.worst, best);
+        }
+    }
+    return res;
+}
+
+std::vector<std::uint8_t> renderCase(const GoldenCase& c, SoftwareRenderer& r,
+                                     JobSystem& jobs) {
+    auto viz = createVisualizer(c.viz);
+    viz->attachJobs(&jobs);
+    for (const auto& [name, value] : c.params) viz->setParam(name, value);
+    r.setView(c.viewScale, c.viewOffset);
+    r.beginFrame(kWidth, kHeight);
+    viz->render(c.time, kWidth, kHeight, r);
+    r.endFrame();
+    return r.pixels();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::filesystem::path refDir = WIZ_GOLDEN_DIR;
+    std::filesystem::path outDir = "golden-diff";
+    std::string filter;
+    bool update = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--update")                       update = true;
+        else if (arg == "--ref-dir" && i + 1 < argc) refDir = argv[++i];
+        else if (arg == "--out-dir" && i + 1 < argc) outDir = argv[++i];
+        else if (arg == "--filter"  && i + 1 < argc) filter = argv[++i];
+        else {
+            std::fprintf(stderr, "Usage: golden_test [--ref-dir DIR] [--out-dir DIR] "
+                                 "[--filter SUBSTR] [--update]\n");
+            return 2;
+        }
+    }
+
+    JobSystem        jobs;
+    SoftwareRenderer renderer(jobs);
+    renderer.setSupersample(kSupersample);
+
+    int failed = 0, run = 0;
+    for (const GoldenCase& c : goldenCases()) {
+        if (!filter.empty() && c.name.find(filter) == std::string::npos) continue;
+        ++run;
+
+        const auto actual  = renderCase(c, renderer, jobs);
+        const auto refPath = refDir / (c.name + ".ppm");
+
+        if (update) {
+            std::filesystem::create_directories(refDir);
+            if (!imageio::writePPM(refPath.string(), kWidth, kHeight, actual)) {
+                std::fprintf(stderr, "FAIL  %-22s cannot write %s\n", c.name.c_str(),
+                             refPath.string().c_str());
+                ++failed;
+            } else {
+                std::printf("WROTE %s\n", refPath.string().c_str());
+            }
+            continue;
+        }
+
+        int rw = 0, rh = 0;
+        std::vector<std::uint8_t> ref;
+        if (!imageio::readPPM(refPath.string(), rw, rh, ref)) {
+            std::printf("FAIL  %-22s missing reference %s (run with --update)\n",
+                        c.name.c_str(), refPath.string().c_str());
+            ++failed;
+            continue;
+        }
+        if (rw != kWidth || rh != kHeight) {
+            std::printf("FAIL  %-22s reference is %dx%d, expected %dx%d\n",
+                        c.name.c_str(), rw, rh, kWidth, kHeight);
+            ++failed;
+            continue;
+        }
+
+        const CompareResult res = compareImages(ref, actual, kWidth, kHeight);
+        const double frac = static_cast<double>(res.bad) / (kWidth * kHeight);
+        if (frac <= kMaxBadFrac) {
+            std::printf("ok    %-22s %5d px over dE %.0f (max dE %.1f)\n", c.name.c_str(),
+                        res.bad, kPixelDeltaE, res.worst);
+            continue;
+        }
+
+        ++failed;
+        std::filesystem::create_directories(outDir);
+        const auto actualPath = outDir / (c.name + ".actual.ppm");
+        const auto diffPath   = outDir / (c.name + ".diff.ppm");
+        imageio::writePPM(actualPath.string(), kWidth, kHeight, actual);
+        imageio::writePPM(diffPath.string(), kWidth, kHeight, res.diff);
+        std::printf("FAIL  %-22s %5d px (%.2f%%) over dE %.0f (max dE %.1f) -> %s\n",
+                    c.name.c_str(), res.bad, frac * 100.0, kPixelDeltaE, res.worst,
+                    diffPath.string().c_str());
+    }
+
+    std::printf("%d/%d golden cases passed\n", run - failed, run);
+    return failed == 0 ? 0 : 1;
+}
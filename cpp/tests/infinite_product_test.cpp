@@ -0,0 +1,112 @@
+// ─── WizSeries: Infinite Product Test ───────────────────────────────────────
+// Checks the segmented sieve against a plain one and the prime-counting
+// function, rewinding included; ζ(s) against known values; and the three
+// products: Wallis's against its closed form, Viète's against π/2, and
+// Euler's against ζ(s), each streamed to 10⁶ factors and more.  A stream
+// sought back to any point carries on exactly as a fresh one.
+//
+//   infinite_product_test
+// ────────────────────────────────────────────────────────────────────────────
+
+#include "series/InfiniteProduct.h"
+#include "tests/Check.h"
+
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include <vector>
+
+namespace {
+
+bool close(double a, double b, double rel) { return std::abs(a - b) <= rel * std::abs(b); }
+
+} // namespace
+
+int main() {
+    constexpr double pi = std::numbers::pi;
+
+    // Segments against one plain sieve over the same range.
+    {
+        const std::uint32_t        limit = 3 * PrimeSieve::kSegment + 12345;
+        std::vector<std::uint8_t>  composite(limit + 1, 0);
+        std::vector<std::uint32_t> plain;
+        for (std::uint32_t n = 2; n <= limit; ++n) {
+            if (composite[n]) continue;
+            plain.push_back(n);
+            for (std::uint64_t m = std::uint64_t{n} * n; m <= limit; m += n) composite[m] = 1;
+        }
+        check(PrimeSieve::upTo(limit) == plain, "segmented sieve matches a plain one");
+        check(PrimeSieve::upTo(1).empty() && PrimeSieve::upTo(2).size() == 1, "small limits");
+
+        // π(10⁸) = 5761455; the 10⁷th prime is 179424673.
+        PrimeSieve    sieve;
+        std::uint64_t p = 0;
+        while ((p = sieve.next()) < 100'000'000) {}
+        check(sieve.count() == 5'761'456, "pi(10^8)");
+
+        while (sieve.count() < 10'000'000) p = sieve.next();
+        check(p == 179'424'673, "10^7th prime");
+        sieve.rewind(1'000);
+        check(sieve.next() == 7'927 && sieve.count() == 1'001, "rewind to the 1001st prime");
+    }
+
+    // ζ(s)
+    check(close(riemannZeta(2.0), pi * pi / 6.0, 1e-15), "zeta(2)");
+    check(close(riemannZeta(3.0), 1.2020569031595942854, 1e-15), "zeta(3)");
+    check(close(riemannZeta(4.0), pi * pi * pi * pi / 90.0, 1e-15), "zeta(4)");
+    check(close(riemannZeta(1.1), 10.584448464950809826, 1e-14), "zeta(1.1)");
+
+    // Wallis: Πₙ≤N 4n²/(4n² − 1) = 2⁴ᴺ (N!)⁴ / ((2N)!² (2N + 1)), in lgamma.
+    {
+        ProductStream wallis(ProductKind::Wallis);
+        for (int n = 0; n < 100; ++n) wallis.next();
+        const double closed = 400.0 * std::numbers::ln2 + 4.0 * std::lgamma(101.0) -
+                              2.0 * std::lgamma(201.0) - std::log(201.0);
+        check(close(wallis.logProduct(), closed, 1e-12), "Wallis, 100 factors");
+        for (int n = 100; n < 1'000'000; ++n) wallis.next();
+        // π/2 · (1 − 1/(4N) + O(1/N²))
+        const double P = std::exp(wallis.logProduct());
+        check(close(P, pi / 2.0 * (1.0 - 1.0 / 4e6), 1e-12), "Wallis, 10^6 factors");
+    }
+
+    // Viète reaches π/2 to double precision within 30 factors.
+    {
+        ProductStream viete(ProductKind::Viete);
+        viete.next();
+        check(close(std::exp(viete.logProduct()), std::sqrt(2.0), 1e-15), "Viete, 1 factor");
+        for (int n = 1; n < 30; ++n) viete.next();
+        check(close(std::exp(viete.logProduct()), pi / 2.0, 4e-16), "Viete, 30 factors");
+        for (int n = 30; n < 2'000'000; ++n) viete.next();
+        check(close(std::exp(viete.logProduct()), pi / 2.0, 4e-16), "Viete, 2*10^6 factors");
+    }
+
+    // Euler: the factors over primes below 10⁶ leave ζ(2) short by about
+    // Σ_{p > 10⁶} 1/p² ≈ 1/(10⁶ ln 10⁶).
+    {
+        ProductStream euler(ProductKind::Euler, 2.0);
+        while (euler.position() < 78'498) euler.next();   // π(10⁶)
+        const double P       = std::exp(euler.logProduct());
+        const double deficit = 1.0 - P / riemannZeta(2.0);
+        check(deficit > 0.5e-7 && deficit < 1e-7, "Euler, primes below 10^6");
+        check(std::isnan(productLimit(ProductKind::Euler, 1.0)), "s = 1 diverges");
+    }
+
+    // Seeking back replays the same factors and sums.
+    for (const ProductKind kind : {ProductKind::Wallis, ProductKind::Viete, ProductKind::Euler}) {
+        ProductStream      fresh(kind, 1.5);
+        std::vector<float> a(300'000);
+        fresh.generate(a);
+
+        ProductStream      sought(kind, 1.5);
+        std::vector<float> b(250'000);
+        sought.generate(b);
+        check(sought.seek(123'457) == 123'457, "seek position");
+        std::vector<float> c(300'000 - 123'457);
+        sought.generate(c);
+        bool same = true;
+        for (std::size_t i = 0; i < c.size(); ++i) same &= c[i] == a[123'457 + i];
+        check(same && sought.logProduct() == fresh.logProduct(), "seek replays the stream");
+    }
+
+    return checkResult("infinite product");
+}
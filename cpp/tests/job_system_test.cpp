@@ -0,0 +1,120 @@
+// ─── WizSeries: Job System Test ─────────────────────────────────────────────
+// Exercises the work-stealing scheduler at several pool sizes: parallel-for
+// coverage, nested fork/join, submissions from foreign threads, priorities,
+// and a deque stress run that forces ring growth and concurrent steals.
+// Oversubscribed pools (more workers than cores) shake out races best.
+//
+//   job_system_test
+// ────────────────────────────────────────────────────────────────────────────
+
+#include "series/JobSystem.h"
+#include "tests/Check.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// Every index visited exactly once, for awkward sizes and grains.
+void testParallelFor(JobSystem& js) {
+    for (std::size_t n : {0u, 1u, 7u, 1000u, 100003u}) {
+        std::vector<std::atomic<int>> hits(n);
+        js.parallelFor(0, n, 13, [&](std::size_t lo, std::size_t hi) {
+            for (std::size_t i = lo; i < hi; ++i) hits[i].fetch_add(1);
+        });
+        bool ok = true;
+        for (auto& h : hits) ok &= h.load() == 1;
+        check(ok, "parallelFor covers range once (%d workers)", js.workerCount());
+    }
+}
+
+/// Recursive fork/join sum: deep nesting must not deadlock.
+std::uint64_t forkSum(JobSystem& js, std::uint64_t lo, std::uint64_t hi) {
+    if (hi - lo <= 64) {
+        std::uint64_t s = 0;
+        for (std::uint64_t i = lo; i < hi; ++i) s += i;
+        return s;
+    }
+    const std::uint64_t mid = lo + (hi - lo) / 2;
+    std::uint64_t a = 0, b = 0;
+    js.fork([&] { a = forkSum(js, lo, mid); }, [&] { b = forkSum(js, mid, hi); });
+    return a + b;
+}
+
+void testForkJoin(JobSystem& js) {
+    const std::uint64_t n = 200000;
+    check(forkSum(js, 0, n) == n * (n - 1) / 2,
+          "nested fork/join sum (%d workers)", js.workerCount());
+}
+
+/// Jobs submitted from a thread outside the pool still run and complete.
+void testForeignSubmit(JobSystem& js) {
+    std::atomic<int> ran{0};
+    JobCounter done;
+    std::thread t([&] {
+        for (int i = 0; i < 500; ++i) js.submit([&] { ran.fetch_add(1); }, &done);
+        js.wait(done);
+    });
+    t.join();
+    check(ran.load() == 500, "foreign-thread submit + wait (%d workers)", js.workerCount());
+}
+
+/// With every other worker parked on a blocker job, the owner drains its
+/// own deques: an interactive job queued after a background one runs first.
+void testPriorities(JobSystem& js) {
+    const int others = js.workerCount() - 1;
+    if (others == 0) return;   // single worker: everything runs inline
+
+    std::atomic<int>  started{0};
+    std::atomic<bool> release{false};
+    JobCounter blockers;
+    for (int i = 0; i < others; ++i)
+        js.submit([&] {
+            started.fetch_add(1);
+            while (!release.load()) std::this_thread::yield();
+        }, &blockers);
+    while (started.load() < others) std::this_thread::yield();
+
+    std::vector<int> order;
+    JobCounter done;
+    js.submit([&] { order.push_back(1); }, &done, JobPriority::Background);
+    js.submit([&] { order.push_back(0); }, &done, JobPriority::Interactive);
+    js.wait(done);
+    release.store(true);
+    js.wait(blockers);
+    check(order == std::vector<int>{0, 1},
+          "interactive before background (%d workers)", js.workerCount());
+}
+
+/// Many tiny jobs from the owner: grows rings past their initial capacity
+/// while every other worker is stealing.
+void testStress(JobSystem& js) {
+    std::atomic<std::uint64_t> sum{0};
+    JobCounter done;
+    const int n = 50000;
+    for (int i = 0; i < n; ++i) js.submit([&sum, i] { sum.fetch_add(i); }, &done);
+    js.wait(done);
+    check(sum.load() == std::uint64_t{n} * (n - 1) / 2,
+          "stress submit/steal (%d workers)", js.workerCount());
+}
+
+} // namespace
+
+int main() {
+    for (int workers : {1, 2, 4, 8}) {
+        JobSystem js(workers);
+        testParallelFor(js);
+        testForkJoin(js);
+        testForeignSubmit(js);
+        testPriorities(js);
+        testStress(js);
+        const auto s = js.stats();
+        std::printf("ok    %d workers: %llu jobs, %llu steals\n", workers,
+                    static_cast<unsigned long long>(s.executed),
+                    static_cast<unsigned long long>(s.steals));
+    }
+    return checkResult("job system");
+}
@@ -0,0 +1,98 @@
+// ─── WizSeries: Kempner Test ────────────────────────────────────────────────
+// Checks the Kempner sums against published values: the limits for missing
+// digits 9, 0 and 1 (Baillie) and for the string 314159 (Schmelzer and
+// Baillie), and that direct summation agrees with the recurrence's sums
+// below each power of ten — single-threaded, on a job system, and when
+// resumed from a snapshot.  The digit automaton is checked against a naive
+// substring search.
+//
+//   kempner_test
+// ────────────────────────────────────────────────────────────────────────────
+
+#include "series/Kempner.h"
+#include "tests/Check.h"
+
+#include <cmath>
+#include <cstdint>
+#include <string>
+
+namespace {
+
+bool close(double a, double b, double rel) { return std::abs(a - b) <= rel * std::abs(b); }
+
+} // namespace
+
+int main() {
+    // Limits, with the last digits checked only through the double.
+    struct Known {
+        const char* pattern;
+        double      limit;
+    };
+    for (const Known& k : {Known{"9",      22.920676619264150348},
+                           Known{"0",      23.103447909420541616},
+                           Known{"1",      16.176969528123444266},
+                           Known{"42",     228.44630415923081325},
+                           Known{"314159", 2302582.3338637826079}}) {
+        const KempnerSum sum(DigitAutomaton(k.pattern), 40);
+        check(close(static_cast<double>(sum.limit()), k.limit, 1e-15), k.pattern);
+    }
+
+    // The limit does not depend on how many decades are summed exactly.
+    {
+        const DigitAutomaton nine("9");
+        const double         few  = static_cast<double>(KempnerSum(nine, 4).limit());
+        const double         many = static_cast<double>(KempnerSum(nine, 2000).limit());
+        check(close(few, many, 1e-15), "limit independent of decades");
+
+        const KempnerSum sum(nine, 30);
+        check(close(sum.decades()[1], 1.0 + 1.0 / 2 + 1.0 / 3 + 1.0 / 4 + 1.0 / 5 + 1.0 / 6 +
+                                      1.0 / 7 + 1.0 / 8, 1e-15),
+              "sum below 10");
+        check(sum.decades()[30] < static_cast<double>(sum.limit()) && sum.decades()[30] > 21.9,
+              "10^30 terms still short of the limit");
+    }
+
+    // Direct summation to 10⁶ against the recurrence.
+    for (const char* pattern : {"9", "0", "42", "000"}) {
+        const DigitAutomaton automaton(pattern);
+        const KempnerSum     sum(automaton, 6);
+
+        KempnerDirect serial;
+        serial.reset(automaton);
+        serial.run(1000, nullptr);
+        check(serial.count() == 1'000'000, "direct count");
+        check(close(serial.sum(), sum.decades()[6], 1e-13), pattern);
+
+        JobSystem     jobs(3);
+        KempnerDirect threaded;
+        threaded.reset(automaton);
+        threaded.run(300, &jobs);
+        threaded.run(700, &jobs);
+        check(threaded.sum() == serial.sum() && threaded.terms() == serial.terms(),
+              "threaded direct sum matches");
+
+        KempnerDirect resumed;
+        KempnerDirect first;
+        first.reset(automaton);
+        first.run(400, nullptr);
+        resumed.reset(automaton);
+        resumed.restore(first.blocks(), first.terms(), first.carry(), first.samples());
+        resumed.run(600, nullptr);
+        check(resumed.sum() == serial.sum() && resumed.samples().size() ==
+              serial.samples().size(), "restored direct sum matches");
+    }
+
+    // Automaton against substring search.
+    for (const char* pattern : {"9", "00", "121", "1212", "314159"}) {
+        const DigitAutomaton automaton(pattern);
+        bool                 agree = true;
+        for (std::uint64_t n = 1; n < 2'000'000; n += 7) {
+            const bool dead = automaton.walk(0, n) == automaton.length();
+            agree &= dead == (std::to_string(n).find(pattern) != std::string::npos);
+        }
+        check(agree, pattern);
+    }
+    check(DigitAutomaton::digits(7, 3) == "007", "zero padding");
+
+    return checkResult("Kempner series");
+}
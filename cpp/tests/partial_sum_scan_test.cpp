@@ -0,0 +1,74 @@
+// ─── WizSeries: Partial-Sum Scan Test ───────────────────────────────────────
+// The parallel reduce-then-scan must agree with the sequential Neumaier
+// cursor for every series, at sizes straddling block and lane boundaries,
+// when split across several calls (carry chaining) and at several pool
+// sizes.
+//
+//   partial_sum_scan_test
+// ────────────────────────────────────────────────────────────────────────────
+
+#include "series/PartialSumScan.h"
+#include "tests/Check.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+/// Relative difference, tolerant of values that flush to (sub)normals.
+double relDiff(double a, double b) {
+    if (a == b) return 0.0;
+    return std::abs(a - b) / std::max({std::abs(a), std::abs(b), 1e-300});
+}
+
+void checkSeries(const SeriesInfo& info, double ratio, std::size_t count, std::size_t split,
+                 JobSystem& jobs) {
+    PartialSumCursor cursor(info.kind, ratio);
+    std::vector<double> wantSums(count), wantTerms(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        wantTerms[i] = cursor.next();
+        wantSums[i]  = cursor.sum();
+    }
+
+    PartialSumScan scan(info.kind, ratio);
+    std::vector<double> sums(count), terms(count);
+    ScanCarry carry;
+    for (std::size_t at = 0; at < count; at += split) {
+        const std::size_t n = std::min(split, count - at);
+        carry = scan.run(at, std::span(sums).subspan(at, n), std::span(terms).subspan(at, n),
+                         carry, &jobs);
+    }
+
+    // Terms from a closed form may drift from the cursor's recurrence by a
+    // few ulps per step (geometric, 1/k!); sums by a few ulps overall.
+    double worstSum = 0.0, worstTerm = 0.0;
+    for (std::size_t i = 0; i < count; ++i) {
+        worstSum  = std::max(worstSum, relDiff(sums[i], wantSums[i]));
+        if (std::abs(wantTerms[i]) > 1e-200)
+            worstTerm = std::max(worstTerm, relDiff(terms[i], wantTerms[i]));
+    }
+    const bool ok = worstSum < 1e-13 && worstTerm < 1e-9 &&
+                    (count == 0 || relDiff(carry.sum(), wantSums.back()) < 1e-13);
+    check(ok, "%-16s n=%-8zu split=%-8zu %d workers: sum %.3g term %.3g", info.key, count,
+          split, jobs.workerCount(), worstSum, worstTerm);
+}
+
+} // namespace
+
+int main() {
+    const std::size_t B = PartialSumScan::kBlock;
+    for (int workers : {1, 4}) {
+        JobSystem jobs(workers);
+        for (const SeriesInfo& info : kSeriesTable) {
+            const double ratio = info.kind == SeriesKind::Geometric ? -0.93 : 0.0;
+            for (std::size_t n : {std::size_t{0}, std::size_t{1}, std::size_t{3},
+                                  std::size_t{7}, B - 1, B + 5, 3 * B + 17})
+                checkSeries(info, ratio, n, std::max<std::size_t>(n, 1), jobs);
+            checkSeries(info, ratio, 200003, 65537, jobs);   // carry across calls
+        }
+        std::printf("ok    %d workers\n", workers);
+    }
+    return checkResult("partial-sum scan");
+}
@@ -0,0 +1,90 @@
+// ─── WizSeries: Random Sign Series Test ─────────────────────────────────────
+// Checks Philox4x32x4 against the Random123 known-answer vectors, one per
+// lane, and RandomSignSeries against the limit's moments: mean 0 and
+// variance Σ 1/n² over the terms summed.  Paths and counts must not depend
+// on threads or on how the paths were split into runs.
+//
+//   random_sign_series_test
+// ────────────────────────────────────────────────────────────────────────────
+
+#include "series/RandomSignSeries.h"
+#include "tests/Check.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace {
+
+struct Kat {
+    std::uint32_t ctr[4];
+    std::uint64_t key;
+    std::uint32_t out[4];
+};
+
+// Philox4x32-10 vectors from Random123's kat_vectors.
+constexpr Kat kKats[] = {
+    {{0, 0, 0, 0}, 0, {0x6627E8D5, 0xE169C58D, 0xBC57AC4C, 0x9B00DBD8}},
+    {{0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF},
+     0xFFFFFFFFFFFFFFFFull,
+     {0x408F276D, 0x41C83B0E, 0xA20BC7C6, 0x6D5451FD}},
+    {{0x243F6A88, 0x85A308D3, 0x13198A2E, 0x03707344},
+     0x299F31D0A4093822ull,
+     {0xD16CFE09, 0x94FDCCEB, 0x5001E420, 0x24126EA1}},
+};
+
+} // namespace
+
+int main() {
+    for (const Kat& k : kKats) {
+        // The vector in every lane, one lane at a time among zero counters.
+        for (int lane = 0; lane < 4; ++lane) {
+            Philox4x32x4::Block ctr{};
+            for (int j = 0; j < 4; ++j) ctr.w[j][lane] = k.ctr[j];
+            const Philox4x32x4::Block out = Philox4x32x4::generate(ctr, k.key);
+            bool ok = true;
+            for (int j = 0; j < 4; ++j) ok = ok && out.w[j][lane] == k.out[j];
+            check(ok, "Philox4x32-10 known answers");
+        }
+    }
+
+    // Limits binned over [−4, 4] in 800 rows: moments from bin centres.
+    constexpr int kTerms = 2048;
+    RandomSignSeries series;
+    series.reset(1, kTerms, 64, 800);
+    series.run(40'000, nullptr);
+    check(series.paths() == 40'000, "requested paths run");
+    double n = 0.0, mean = 0.0, square = 0.0;
+    const auto limits = series.limits();
+    for (std::size_t i = 0; i < limits.size(); ++i) {
+        const double s = -4.0 + 8.0 * (static_cast<double>(i) + 0.5) / 800.0;
+        n      += limits[i];
+        mean   += limits[i] * s;
+        square += limits[i] * s * s;
+    }
+    mean /= n;
+    const double variance = square / n - mean * mean;
+    double expected = 0.0;
+    for (int k = 1; k <= kTerms; ++k) expected += 1.0 / (static_cast<double>(k) * k);
+    check(n == 40'000.0, "every limit inside [-4, 4]");
+    check(std::abs(mean) < 0.02, "limits centred on 0");
+    check(std::abs(variance - expected) < 0.04, "limit variance is sum of 1/n^2");
+
+    // Same seed, same counts, with or without worker threads.
+    JobSystem        jobs(3);
+    RandomSignSeries serial, parallel;
+    serial.reset(9, 1000, 100, 80);
+    parallel.reset(9, 1000, 100, 80);
+    serial.run(1000, nullptr);
+    parallel.run(400, &jobs);
+    parallel.run(600, &jobs);
+    const auto a = serial.fan().counts();
+    const auto b = parallel.fan().counts();
+    const auto la = serial.limits();
+    const auto lb = parallel.limits();
+    check(std::equal(a.begin(), a.end(), b.begin(), b.end()) &&
+              std::equal(la.begin(), la.end(), lb.begin(), lb.end()),
+          "counts independent of threads and run sizes");
+
+    return checkResult("random sign series");
+}
@@ -0,0 +1,67 @@
+// ─── WizSeries: Range Min/Max Test ──────────────────────────────────────────
+// Checks RangeMinMax against a direct scan for random ranges, through
+// growth in uneven steps, truncation and a restart with new values.
+//
+//   range_min_max_test
+// ────────────────────────────────────────────────────────────────────────────
+
+#include "series/RangeMinMax.h"
+#include "tests/Check.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace {
+
+/// Compare `index` with brute force over `queries` random ranges of `values`.
+bool matches(const RangeMinMax& index, const std::vector<float>& values, std::mt19937& rng,
+             int queries) {
+    if (index.size() != values.size()) return false;
+    std::uniform_int_distribution<std::size_t> pick(0, values.size());
+    for (int q = 0; q < queries; ++q) {
+        std::size_t lo = pick(rng), hi = pick(rng);
+        if (lo > hi) std::swap(lo, hi);
+        const ValueRange r = index.query(lo, hi);
+        ValueRange want;
+        if (lo < hi) {
+            const auto [mn, mx] = std::minmax_element(values.begin() + static_cast<long>(lo),
+                                                      values.begin() + static_cast<long>(hi));
+            want = {*mn, *mx};
+        }
+        if (r.min != want.min || r.max != want.max) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main() {
+    std::mt19937 rng(12345);
+    std::normal_distribution<float> value(0.0f, 1.0f);
+    std::vector<float> values;
+    values.reserve(200'000);   // the index holds a span: no reallocation
+    RangeMinMax index;
+
+    check(index.query(0, 10).min == 0.0f && index.query(0, 10).max == 0.0f, "empty index");
+
+    bool ok = true;
+    for (std::size_t step : {1u, 5u, 127u, 128u, 129u, 1000u, 40'000u, 100'000u}) {
+        for (std::size_t i = 0; i < step; ++i) values.push_back(value(rng));
+        index.update(values);
+        ok &= matches(index, values, rng, 2000);
+    }
+    check(ok, "growth in uneven steps");
+
+    values.resize(70'001);
+    index.update(values);
+    check(matches(index, values, rng, 2000), "truncation");
+
+    for (float& v : values) v = value(rng);
+    index.update(values, true);
+    check(matches(index, values, rng, 2000), "restart with new values");
+
+    check(index.query(5, 5).min == 0.0f && index.query(9, 3).max == 0.0f, "empty ranges");
+
+    return checkResult("range min/max");
+}
@@ -0,0 +1,82 @@
+// ─── WizSeries: Rearrangement Test ──────────────────────────────────────────
+// Checks the greedy rearrangement of the alternating harmonic series: it uses
+// every term once, its sums close in on the target, and after a retarget or
+// a rewind the stream carries on with exactly the terms a fresh run at the
+// new target would give — while keeping a prefix rather than starting over.
+//
+//   rearrangement_test
+// ────────────────────────────────────────────────────────────────────────────
+
+#include "series/Rearrangement.h"
+#include "tests/Check.h"
+
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <vector>
+
+namespace {
+
+/// `n` terms of a fresh rearrangement towards `target`, in uneven chunks.
+std::vector<float> fresh(double target, std::size_t n) {
+    Rearrangement r(target);
+    std::vector<float> terms(n);
+    for (std::size_t row = 0; row < n; row += 1000)
+        r.generate(std::span(terms).subspan(row, std::min<std::size_t>(1000, n - row)));
+    return terms;
+}
+
+} // namespace
+
+int main() {
+    constexpr std::size_t kTerms = 1'000'000;
+
+    // Convergence: ratio of positives to negatives tends to e^(2(T − ln 2)).
+    for (const double target : {1.5, -0.7, 0.0, 2.9}) {
+        Rearrangement      r(target);
+        std::vector<float> terms(kTerms);
+        r.generate(terms);
+        check(r.position() == kTerms, "position counts the terms");
+        check(r.positives() + r.negatives() == kTerms, "every term used once");
+        check(std::abs(r.sum() - target) < 1e-5, "sum converges to the target");
+        const double ratio = static_cast<double>(r.positives()) /
+                             static_cast<double>(r.negatives());
+        check(std::abs(std::log(ratio) - 2.0 * (target - std::log(2.0))) < 1e-3,
+              "positive to negative ratio");
+    }
+
+    // Retargeting keeps a prefix and matches a fresh run term for term.
+    const std::vector<float> before = fresh(1.5, kTerms);
+    const std::vector<float> after  = fresh(1.5001, kTerms);
+    {
+        Rearrangement      r(1.5);
+        std::vector<float> terms(kTerms);
+        r.generate(terms);
+        r.retarget(1.5001);
+        const std::size_t kept = r.position();
+        check(kept > 0 && kept < kTerms, "retarget keeps a prefix");
+        check(std::equal(terms.begin(), terms.begin() + static_cast<long>(kept), after.begin()),
+              "kept prefix agrees with the new target");
+        r.generate(std::span(terms).subspan(kept));
+        check(terms == after, "retargeted stream matches a fresh run");
+
+        r.retarget(1.5);
+        r.generate(std::span(terms).subspan(r.position()));
+        check(terms == before, "retarget back restores the original terms");
+        check(r.position() == kTerms, "position after retargeting back");
+    }
+
+    // Rewinding replays from a checkpoint; seeking ahead stays put.
+    {
+        Rearrangement      r(1.5);
+        std::vector<float> terms(kTerms);
+        r.generate(std::span(terms).first(kTerms / 2));
+        check(r.seek(kTerms) == kTerms / 2, "seek ahead stays put");
+        const std::size_t from = r.seek(12345);
+        check(from == 12345, "seek back");
+        r.generate(std::span(terms).subspan(from));
+        check(terms == before, "rewound stream matches a fresh run");
+    }
+
+    return checkResult("rearrangement");
+}
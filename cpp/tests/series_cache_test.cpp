@@ -0,0 +1,114 @@
+// ─── WizSeries: Series Cache Test ───────────────────────────────────────────
+// Checks the snapshot cache of a series plot: a plot restored from another's
+// saveCache() draws the same frame without calling term() again, keeps what
+// it restored when the term count then grows, and ignores a cache computed
+// for another shape.  Streamed series save nothing.
+//
+//   series_cache_test
+// ────────────────────────────────────────────────────────────────────────────
+
+#include "series/SoftwareRenderer.h"
+#include "series/VisualizerRegistry.h"
+#include "tests/Check.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+/// rⁿ/(n + 1), counting the terms it is asked for.
+class CountingSeries : public SeriesPlotVisualizer {
+public:
+    CountingSeries()
+        : SeriesPlotVisualizer({.defaultTerms = 5000.0f,
+                                .maxTerms     = 100'000,
+                                .shapeParam   = "ratio"}) {
+        params_["ratio"] = 0.5f;
+    }
+
+    mutable std::atomic<std::uint64_t> calls{0};
+
+protected:
+    float term(int i) const override {
+        ++calls;
+        return std::pow(shape(), static_cast<float>(i)) / static_cast<float>(i + 1);
+    }
+
+    float shape() const override { return getParam("ratio", 0.5f); }
+
+    bool limit(const std::vector<float>& /*sums*/, float& /*value*/) const override {
+        return false;
+    }
+};
+
+std::vector<std::uint8_t> frame(ISeriesVisualizer& viz, SoftwareRenderer& r) {
+    r.beginFrame(160, 100);
+    viz.render(30.0f, 160, 100, r);
+    r.endFrame();
+    return r.pixels();
+}
+
+std::vector<std::uint8_t> cache(const ISeriesVisualizer& viz) {
+    BlobWriter out;
+    viz.saveCache(out);
+    return out.bytes();
+}
+
+} // namespace
+
+int main() {
+    JobSystem        jobs;
+    SoftwareRenderer renderer(jobs);
+
+    CountingSeries source;
+    const auto     expected = frame(source, renderer);
+    const auto     blob     = cache(source);
+    check(blob.size() > 2 * 5000 * sizeof(float), "cache holds the terms and sums");
+
+    // Restored: the same frame, and no term recomputed.
+    {
+        CountingSeries restored;
+        BlobReader     in(blob);
+        check(restored.loadCache(in) && in.atEnd(), "cache loads");
+        check(frame(restored, renderer) == expected, "restored frame matches");
+        check(restored.calls == 0, "restored terms are not recomputed");
+
+        restored.setParam("terms", 6000.0f);
+        CountingSeries longer;
+        longer.setParam("terms", 6000.0f);
+        check(frame(restored, renderer) == frame(longer, renderer), "restored series extends");
+        check(restored.calls == 1000, "only the new terms are computed");
+    }
+
+    // A cache for another shape is dropped.
+    {
+        CountingSeries other;
+        other.setParam("ratio", 0.25f);
+        BlobReader in(blob);
+        check(other.loadCache(in), "cache for another shape loads");
+        CountingSeries fresh;
+        fresh.setParam("ratio", 0.25f);
+        check(frame(other, renderer) == frame(fresh, renderer), "other shape recomputes");
+        check(other.calls == 5000, "other shape computes every term");
+    }
+
+    // Truncated caches are rejected.
+    {
+        CountingSeries                  target;
+        const std::vector<std::uint8_t> cut(blob.begin(), blob.begin() + 64);
+        BlobReader                      in(cut);
+        check(!target.loadCache(in), "truncated cache is rejected");
+    }
+
+    // Streamed series replay their generators rather than save terms.
+    {
+        auto viz = createVisualizer("alt_harmonic");
+        viz->setParam("mode", 1.0f);
+        frame(*viz, renderer);
+        check(cache(*viz).size() == 1, "streamed series saves no terms");
+    }
+
+    return checkResult("series cache");
+}
@@ -0,0 +1,84 @@
+// ─── WizSeries: Strange Attractor Test ──────────────────────────────────────
+// Checks StrangeAttractor: the vector sine against std::sin, windows found
+// for the classic parameters and none for an escaping Hénon map, every
+// Hénon sample inside its window and none above |y| = b·max|x|, and the
+// same counts single-threaded and on a job system.
+//
+//   strange_attractor_test
+// ────────────────────────────────────────────────────────────────────────────
+
+#include "series/StrangeAttractor.h"
+#include "tests/Check.h"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+std::uint64_t total(const DensityBuffer& d) {
+    std::uint64_t n = 0;
+    for (const std::uint32_t c : d.counts()) n += c;
+    return n;
+}
+
+} // namespace
+
+int main() {
+    double worst = 0.0;
+    for (int i = -200000; i <= 200000; ++i) {
+        const float x = static_cast<float>(i) * 0.001f;
+        const f32x4 s = StrangeAttractor::sin4(f32x4{} + x);
+        worst = std::max(worst, std::abs(s[0] - std::sin(static_cast<double>(x))));
+    }
+    check(worst < 3e-7, "sin4 within 3e-7 on [-200, 200]");
+
+    const AttractorSpec henon{AttractorKind::Henon, 1.4f, 0.3f};
+    const AttractorSpec clifford{AttractorKind::Clifford, -1.4f, 1.6f, 1.0f, 0.7f};
+    const AttractorSpec lozi{AttractorKind::Lozi, 1.7f, 0.5f};
+    const auto hw = StrangeAttractor::locate(henon);
+    const auto cw = StrangeAttractor::locate(clifford);
+    const auto lw = StrangeAttractor::locate(lozi);
+    check(hw && hw->x0 < -1.25f && hw->x1 > 1.25f && hw->y0 > -0.45f && hw->y1 < 0.45f,
+          "Henon window");
+    // Clifford: |x| ≤ 1 + |c| and |y| ≤ 1 + |d|, plus 4 % padding.
+    check(cw && cw->x0 > -2.16f && cw->x1 < 2.16f && cw->y0 > -1.84f && cw->y1 < 1.84f,
+          "Clifford window within its bound");
+    check(lw.has_value(), "Lozi window");
+    check(!StrangeAttractor::locate({AttractorKind::Henon, 2.0f, 0.3f}), "escaping Henon");
+
+    // Every Hénon point is y = 0.3·x of the one before, |x| < 1.29: the
+    // rows above |y| = 0.39 stay empty.
+    constexpr int kBins = 256;
+    StrangeAttractor orbits;
+    orbits.reset(henon, *hw, kBins, kBins, 1);
+    orbits.run(2'000'000, nullptr);
+    check(orbits.samples() >= 2'000'000, "requested samples run");
+    check(total(orbits.density()) == orbits.samples(), "every sample in the window");
+    const float rowH = (hw->y1 - hw->y0) / kBins;
+    std::uint64_t outside = 0;
+    for (int y = 0; y < kBins; ++y) {
+        const float y0 = hw->y0 + rowH * static_cast<float>(y);
+        if (y0 + rowH > -0.39f && y0 < 0.39f) continue;
+        for (int x = 0; x < kBins; ++x)
+            outside += orbits.density().counts()[static_cast<std::size_t>(y) * kBins + x];
+    }
+    check(outside == 0, "Henon stays within |y| < 0.39");
+
+    // Same seed, same counts, with or without worker threads.
+    JobSystem jobs(3);
+    StrangeAttractor serial, parallel;
+    serial.reset(clifford, *cw, kBins, kBins, 4);
+    parallel.reset(clifford, *cw, kBins, kBins, 4);
+    serial.run(5 * StrangeAttractor::kRound, nullptr);
+    parallel.run(2 * StrangeAttractor::kRound, &jobs);
+    parallel.run(3 * StrangeAttractor::kRound, &jobs);
+    const auto a = serial.density().counts();
+    const auto b = parallel.density().counts();
+    check(serial.samples() == parallel.samples() &&
+              std::vector<std::uint32_t>(a.begin(), a.end()) ==
+                  std::vector<std::uint32_t>(b.begin(), b.end()),
+          "counts independent of threads and run sizes");
+
+    return checkResult("strange attractor");
+}
@@ -0,0 +1,137 @@
+// ─── WizSeries: Incremental Task Test ───────────────────────────────────────
+// Checks the coroutine task scheduler: work is split at budget checkpoints,
+// bodies see the time left in their slice, progress is reported,
+// cancellation destroys the suspended frame (running its destructors), tasks
+// spawned from a running body are picked up and tasks of an owner out of
+// focus pause until it has the focus again.
+//
+//   task_test
+// ────────────────────────────────────────────────────────────────────────────
+
+#include "series/Task.h"
+#include "tests/Check.h"
+
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+namespace {
+
+/// `steps` chunks of ~1 ms each, counting how many ran.
+Task sleepy(int steps, int& ran) {
+    for (int i = 0; i < steps; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        ++ran;
+        co_await Checkpoint{static_cast<float>(i + 1) / static_cast<float>(steps)};
+    }
+}
+
+/// Flags when its frame is destroyed.
+struct Guard {
+    bool& destroyed;
+    ~Guard() { destroyed = true; }
+};
+
+Task guarded(bool& destroyed) {
+    Guard g{destroyed};
+    for (;;) co_await Checkpoint{0.5f};
+}
+
+/// Records the time left in its slice.
+Task measure(double& left) {
+    left = co_await SliceLeft{};
+}
+
+Task parent(TaskScheduler& tasks, int& childRan) {
+    tasks.spawn("child", sleepy(1, childRan));
+    co_return;
+}
+
+void testBudget() {
+    TaskScheduler tasks;
+    int ran = 0;
+    tasks.spawn("sleepy", sleepy(40, ran));
+    tasks.run(5.0);
+    check(ran > 0 && ran < 40, "slice stops at the budget");
+    check(!tasks.empty(), "unfinished task stays queued");
+    const auto s = tasks.stats();
+    check(s.progress > 0.0f && s.progress < 1.0f && s.slowest == "sleepy", "progress reported");
+    tasks.finish();
+    check(ran == 40 && tasks.stats().completed == 1, "finish runs to the end");
+}
+
+void testZeroSlice() {
+    TaskScheduler tasks;
+    int a = 0, b = 0;
+    tasks.spawn("a", sleepy(3, a));
+    tasks.spawn("b", sleepy(3, b));
+    tasks.run(0.0);
+    check(a == 1 && b == 1, "every task advances once per run");
+}
+
+void testCancel() {
+    TaskScheduler tasks;
+    bool destroyed = false;
+    const auto id = tasks.spawn("forever", guarded(destroyed));
+    tasks.run(1.0);
+    check(tasks.pending(id) && !destroyed, "suspended task is pending");
+    tasks.cancel(id);
+    check(!tasks.pending(id) && destroyed, "cancel destroys the frame");
+    check(tasks.stats().cancelled == 1, "cancel counted");
+}
+
+void testSpawnFromBody() {
+    TaskScheduler tasks;
+    int childRan = 0;
+    tasks.spawn("parent", parent(tasks, childRan));
+    tasks.finish();
+    check(childRan == 1 && tasks.stats().completed == 2, "body may spawn follow-ups");
+}
+
+void testFocus() {
+    TaskScheduler tasks;
+    const int ownerA = 0, ownerB = 0;
+    int a = 0, b = 0, c = 0;
+    tasks.spawn("a", sleepy(3, a), &ownerA);
+    tasks.spawn("b", sleepy(3, b), &ownerB);
+    tasks.spawn("unowned", sleepy(3, c));
+    tasks.focus(&ownerA);
+    tasks.run(0.0);
+    check(a == 1 && b == 0 && c == 1, "only the focused owner's tasks run");
+    check(tasks.stats().paused == 1, "paused task counted");
+    tasks.finish();
+    check(a == 3 && b == 0 && c == 3 && !tasks.empty() && tasks.idle(),
+          "finish leaves paused tasks queued");
+    tasks.focus(&ownerB);
+    tasks.finish();
+    check(b == 3 && tasks.empty(), "paused task resumes with the focus");
+}
+
+void testSliceLeft() {
+    TaskScheduler tasks;
+    double left = -1.0;
+    tasks.spawn("measure", measure(left));
+    tasks.run(50.0);
+    check(left > 0.0 && left <= 0.05, "slice left within the budget (%g s)", left);
+    measure(left).runToCompletion();
+    check(std::isinf(left), "no budget when run to completion");
+}
+
+void testInline() {
+    int ran = 0;
+    check(spawnTask(nullptr, "inline", sleepy(3, ran)) == 0 && ran == 3,
+          "no scheduler runs inline");
+}
+
+} // namespace
+
+int main() {
+    testBudget();
+    testZeroSlice();
+    testCancel();
+    testSpawnFromBody();
+    testFocus();
+    testSliceLeft();
+    testInline();
+    return checkResult("task scheduler");
+}
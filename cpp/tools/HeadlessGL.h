@@ -0,0 +1,131 @@
+// ─── WizSeries: Headless GLES 3 Context ─────────────────────────────────────
+// Creates a surfaceless EGL display + OpenGL ES 3.0 context and renders into
+// an offscreen RGBA8 framebuffer object, so the real GLRenderer code paths
+// run natively without a window or GPU (Mesa llvmpipe works on any Linux).
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <GLES3/gl3.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class HeadlessGL {
+public:
+    HeadlessGL() = default;
+    HeadlessGL(const HeadlessGL&) = delete;
+    HeadlessGL& operator=(const HeadlessGL&) = delete;
+
+    ~HeadlessGL() {
+        if (display_ == EGL_NO_DISPLAY) return;
+        if (context_ != EGL_NO_CONTEXT) {
+            glDeleteRenderbuffers(1, &rbo_);
+            glDeleteFramebuffers(1, &fbo_);
+            eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+            eglDestroyContext(display_, context_);
+        }
+        eglTerminate(display_);
+    }
+
+    /// Create the context and a `width`×`height` colour target, and make
+    /// both current.  On failure `error()` describes the step that failed.
+    bool init(int width, int height) {
+        display_ = openDisplay();
+        if (display_ == EGL_NO_DISPLAY) return fail("no EGL display");
+        if (!eglInitialize(display_, nullptr, nullptr)) return fail("eglInitialize");
+        if (!eglBindAPI(EGL_OPENGL_ES_API)) return fail("eglBindAPI(GLES)");
+
+        const EGLint configAttrs[] = {
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_ES3_BIT,
+            EGL_SURFACE_TYPE,    0,
+            EGL_NONE,
+        };
+        EGLConfig config = nullptr;
+        EGLint    count  = 0;
+        if (!eglChooseConfig(display_, configAttrs, &config, 1, &count) || count == 0)
+            return fail("no GLES 3 EGL config");
+
+        const EGLint contextAttrs[] = {
+            EGL_CONTEXT_MAJOR_VERSION, 3,
+            EGL_CONTEXT_MINOR_VERSION, 0,
+            EGL_NONE,
+        };
+        context_ = eglCreateContext(display_, config, EGL_NO_CONTEXT, contextAttrs);
+        if (context_ == EGL_NO_CONTEXT) return fail("eglCreateContext");
+        if (!eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, context_))
+            return fail("eglMakeCurrent (surfaceless)");
+
+        width_  = width;
+        height_ = height;
+        glGenFramebuffers(1, &fbo_);
+        glGenRenderbuffers(1, &rbo_);
+        glBindRenderbuffer(GL_RENDERBUFFER, rbo_);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+        glBindFramebuffer(GL_FRAMEBUFFER, fbo_);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, rbo_);
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+            return fail("incomplete framebuffer");
+        return true;
+    }
+
+    /// GL_RENDERER string, e.g. "llvmpipe (LLVM 15.0.7, 256 bits)".
+    [[nodiscard]] std::string renderer() const {
+        const auto* s = reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+        return s ? s : "?";
+    }
+
+    /// Read the colour target back as tightly packed RGB rows, top row first.
+    [[nodiscard]] std::vector<std::uint8_t> readPixels() const {
+        std::vector<std::uint8_t> rgba(static_cast<size_t>(width_) * height_ * 4);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glReadPixels(0, 0, width_, height_, GL_RGBA, GL_UNSIGNED_BYTE, rgba.data());
+
+        std::vector<std::uint8_t> rgb(static_cast<size_t>(width_) * height_ * 3);
+        for (int y = 0; y < height_; ++y) {
+            const std::uint8_t* src = &rgba[static_cast<size_t>(height_ - 1 - y) * width_ * 4];
+            std::uint8_t*       dst = &rgb[static_cast<size_t>(y) * width_ * 3];
+            for (int x = 0; x < width_; ++x) {
+                dst[x * 3 + 0] = src[x * 4 + 0];
+                dst[x * 3 + 1] = src[x * 4 + 1];
+                dst[x * 3 + 2] = src[x * 4 + 2];
+            }
+        }
+        return rgb;
+    }
+
+    [[nodiscard]] const std::string& error() const { return error_; }
+    [[nodiscard]] int width()  const { return width_; }
+    [[nodiscard]] int height() const { return height_; }
+
+private:
+    EGLDisplay  display_ = EGL_NO_DISPLAY;
+    EGLContext  context_ = EGL_NO_CONTEXT;
+    GLuint      fbo_     = 0;
+    GLuint      rbo_     = 0;
+    int         width_   = 0;
+    int         height_  = 0;
+    std::string error_;
+
+    bool fail(const char* what) {
+        error_ = what;
+        return false;
+    }
+
+    /// Prefer Mesa's surfaceless platform (no X11/Wayland needed); fall back
+    /// to the default display on drivers that do not expose it.
+    static EGLDisplay openDisplay() {
+#ifdef EGL_PLATFORM_SURFACELESS_MESA
+        auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+            eglGetProcAddress("eglGetPlatformDisplayEXT"));
+        if (getPlatformDisplay) {
+            EGLDisplay d = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA,
+                                              EGL_DEFAULT_DISPLAY, nullptr);
+            if (d != EGL_NO_DISPLAY) return d;
+        }
+#endif
+        return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    }
+};
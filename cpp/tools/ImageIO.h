@@ -0,0 +1,153 @@
+// ─── WizSeries: Image I/O for Native Tools ─────────────────────────────────
+// Writes tightly packed 8-bit RGB frames as binary PPM or PNG, and reads
+// binary PPM back (golden references).  PNG uses zlib
+// when the build found it (WIZ_HAVE_ZLIB) and falls back to stored (level-0)
+// deflate blocks otherwise, so the tools never need an external dependency.
+// ─────────────────────────────────────────────────────────────────────────────
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#ifdef WIZ_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+namespace imageio {
+
+namespace detail {
+
+inline std::uint32_t crc32(const std::uint8_t* data, size_t len,
+                           std::uint32_t crc = 0) {
+    static const auto table = [] {
+        std::array<std::uint32_t, 256> t{};
+        for (std::uint32_t n = 0; n < 256; ++n) {
+            std::uint32_t c = n;
+            for (int k = 0; k < 8; ++k)
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            t[n] = c;
+        }
+        return t;
+    }();
+    crc = ~crc;
+    for (size_t i = 0; i < len; ++i)
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+inline void putU32(std::vector<std::uint8_t>& out, std::uint32_t v) {
+    out.push_back(static_cast<std::uint8_t>(v >> 24));
+    out.push_back(static_cast<std::uint8_t>(v >> 16));
+    out.push_back(static_cast<std::uint8_t>(v >> 8));
+    out.push_back(static_cast<std::uint8_t>(v));
+}
+
+inline void putChunk(std::vector<std::uint8_t>& out, const char* type,
+                     const std::vector<std::uint8_t>& data) {
+    putU32(out, static_cast<std::uint32_t>(data.size()));
+    const size_t start = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data.begin(), data.end());
+    putU32(out, crc32(&out[start], out.size() - start));
+}
+
+/// zlib stream for `raw`: real deflate when available, stored blocks if not.
+inline std::vector<std::uint8_t> zlibCompress(
+    const std::vector<std::uint8_t>& raw) {
+#ifdef WIZ_HAVE_ZLIB
+    uLongf len = compressBound(static_cast<uLong>(raw.size()));
+    std::vector<std::uint8_t> out(len);
+    compress2(out.data(), &len, raw.data(), static_cast<uLong>(raw.size()),
+              Z_BEST_SPEED);
+    out.resize(len);
+    return out;
+#else
+    std::vector<std::uint8_t> out = {0x78, 0x01};
+    size_t pos = 0;
+    do {
+        const size_t n = std::min<size_t>(raw.size() - pos, 65535);
+        const bool last = pos + n == raw.size();
+        out.push_back(last ? 1 : 0);
+        out.push_back(static_cast<std::uint8_t>(n));
+        out.push_back(static_cast<std::uint8_t>(n >> 8));
+        out.push_back(static_cast<std::uint8_t>(~n));
+        out.push_back(static_cast<std::uint8_t>(~n >> 8));
+        out.insert(out.end(), raw.begin() + static_cast<long>(pos),
+                   raw.begin() + static_cast<long>(pos + n));
+        pos += n;
+    } while (pos < raw.size());
+
+    std::uint32_t a = 1, b = 0;
+    for (std::uint8_t byte : raw) {
+        a = (a + byte) % 65521;
+        b = (b + a) % 65521;
+    }
+    putU32(out, (b << 16) | a);
+    return out;
+#endif
+}
+
+inline bool writeFile(const std::string& path, const void* data, size_t len) {
+    std::FILE* f = std::fopen(path.c_str(), "wb");
+    if (!f) return false;
+    const bool ok = std::fwrite(data, 1, len, f) == len;
+    return std::fclose(f) == 0 && ok;
+}
+
+} // namespace detail
+
+/// Binary PPM (P6).
+inline bool writePPM(const std::string& path, int w, int h,
+                     const std::vector<std::uint8_t>& rgb) {
+    std::string header = "P6\n" + std::to_string(w) + " " + std::to_string(h)
+                       + "\n255\n";
+    std::vector<std::uint8_t> out(header.begin(), header.end());
+    out.insert(out.end(), rgb.begin(), rgb.end());
+    return detail::writeFile(path, out.data(), out.size());
+}
+
+/// Read a binary PPM (P6, maxval 255) into tightly packed RGB.
+inline bool readPPM(const std::string& path, int& w, int& h,
+                    std::vector<std::uint8_t>& rgb) {
+    std::FILE* f = std::fopen(path.c_str(), "rb");
+    if (!f) return false;
+    int maxval = 0;
+    const bool header = std::fscanf(f, "P6 %d %d %d", &w, &h, &maxval) == 3
+                     && std::fgetc(f) != EOF && w > 0 && h > 0 && maxval == 255;
+    bool ok = false;
+    if (header) {
+        rgb.resize(static_cast<size_t>(w) * h * 3);
+        ok = std::fread(rgb.data(), 1, rgb.size(), f) == rgb.size();
+    }
+    std::fclose(f);
+    return ok;
+}
+
+/// 8-bit truecolour PNG, filter type 0 on every row.
+inline bool writePNG(const std::string& path, int w, int h,
+                     const std::vector<std::uint8_t>& rgb) {
+    const size_t stride = static_cast<size_t>(w) * 3;
+    std::vector<std::uint8_t> raw;
+    raw.reserve((stride + 1) * static_cast<size_t>(h));
+    for (int y = 0; y < h; ++y) {
+        raw.push_back(0);
+        const auto row = rgb.begin() + static_cast<long>(stride * static_cast<size_t>(y));
+        raw.insert(raw.end(), row, row + static_cast<long>(stride));
+    }
+
+    std::vector<std::uint8_t> out = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    std::vector<std::uint8_t> ihdr;
+    detail::putU32(ihdr, static_cast<std::uint32_t>(w));
+    detail::putU32(ihdr, static_cast<std::uint32_t>(h));
+    ihdr.insert(ihdr.end(), {8, 2, 0, 0, 0});   // 8-bit RGB, no interlace
+    detail::putChunk(out, "IHDR", ihdr);
+    detail::putChunk(out, "IDAT", detail::zlibCompress(raw));
+    detail::putChunk(out, "IEND", {});
+    return detail::writeFile(path, out.data(), out.size());
+}
+
+} // namespace imageio
@@ -0,0 +1,424 @@
+// ─── WizSeries: Native Benchmark Suite ──────────────────────────────────────
+// Measures the engine outside the browser.  The `gl` suite records each
+// visualizer's geometry through RecordingRenderer (pure CPU cost) and replays
+// it through the real GLRenderer on a headless EGL/GLES 3 context once per
+// vertex streaming strategy, reporting upload and draw-call timings (plus
+// runs with quads expanded to triangles and with draw batching off), and
+// how many state calls GLStateCache issued and elided.  The
+// `pipeline` suite drives the same GL path through FramePipeline at depths
+// 1–3 and reports main-thread frame time against the added latency.  The
+// `scan` suite (CPU only) fills long partial-sum prefixes with the sequential
+// PartialSumCursor and with PartialSumScan at increasing thread counts.  The
+// `feigenbaum` suite (CPU only) times FeigenbaumEngine level by level.  The
+// `bbp` suite (CPU only) extracts hex digits of π at a position with BbpPi
+// at increasing thread counts.
+//
+//   wizbench gl --viz harmonic --frames 300 --width 1920 --height 1080
+//   wizbench pipeline --viz logistic
+//   wizbench scan --viz basel --terms 100000000
+//   wizbench feigenbaum --levels 24
+//   wizbench bbp --position 100000000
+// ────────────────────────────────────────────────────────────────────────────
+
+#include "series/BbpPi.h"
+#include "series/Feigenbaum.h"
+#include "series/PartialSumScan.h"
+#include "series/RecordingRenderer.h"
+#include "series/VisualizerRegistry.h"
+
+#ifdef WIZ_HAVE_EGL
+#include "HeadlessGL.h"
+#include "series/FramePipeline.h"
+#include "series/GLRenderer.h"
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double msSince(Clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+}
+
+struct Options {
+    std::string suite    = "gl";
+    std::string viz;                      // empty: every registered visualizer
+    int         frames   = 120;
+    int         warmup   = 10;
+    int         width    = 1280;
+    int         height   = 720;
+    long long   terms    = 20'000'000;    // scan suite
+    int         levels   = 20;            // feigenbaum suite
+    long long   position = 100'000'000;   // bbp suite
+};
+
+void printUsage() {
+    std::printf(
+        "Usage: wizbench [SUITE] [options]\n"
+        "Suites:\n"
+        "  gl                  geometry + GL streaming strategies (default)\n"
+        "  pipeline            synchronous vs double/triple-buffered frames\n"
+        "  scan                sequential vs parallel partial sums (no GL)\n"
+        "  feigenbaum          period-doubling levels and constants (no GL)\n"
+        "  bbp                 hex digits of pi at a position (no GL)\n"
+        "Options:\n"
+        "  --viz NAME          only benchmark this visualizer\n"
+        "  --frames N          measured frames per run (default: 120)\n"
+        "  --warmup N          unmeasured frames per run (default: 10)\n"
+        "  --width W           framebuffer width (default: 1280)\n"
+        "  --height H          framebuffer height (default: 720)\n"
+        "  --terms N           partial sums per scan run (default: 20000000)\n"
+        "  --levels N          period-doubling levels to find (default: 20)\n"
+        "  --position N        hex digits of pi after the first N (default: 100000000)\n");
+}
+
+bool parseArgs(int argc, char** argv, Options& opt) {
+    int i = 1;
+    if (i < argc && argv[i][0] != '-') opt.suite = argv[i++];
+    for (; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto next = [&]() -> const char* { return i + 1 < argc ? argv[++i] : nullptr; };
+        const char* v = nullptr;
+        if (arg == "--help" || arg == "-h") return false;
+        else if (arg == "--viz"    && (v = next())) opt.viz    = v;
+        else if (arg == "--frames" && (v = next())) opt.frames = std::atoi(v);
+        else if (arg == "--warmup" && (v = next())) opt.warmup = std::atoi(v);
+        else if (arg == "--width"  && (v = next())) opt.width  = std::atoi(v);
+        else if (arg == "--height" && (v = next())) opt.height = std::atoi(v);
+        else if (arg == "--terms"  && (v = next())) opt.terms  = std::atoll(v);
+        else if (arg == "--levels" && (v = next())) opt.levels = std::atoi(v);
+        else if (arg == "--position" && (v = next())) opt.position = std::atoll(v);
+        else {
+            std::fprintf(stderr, "Unknown or incomplete option: %s\n", arg.c_str());
+            return false;
+        }
+    }
+    return opt.frames > 0 && opt.warmup >= 0 && opt.width > 0 && opt.height > 0 &&
+           opt.terms > 0 && opt.levels >= 2 && opt.levels <= FeigenbaumEngine::kMaxLevel &&
+           opt.position >= 0 &&
+           static_cast<std::uint64_t>(opt.position) <= BbpPi::kMaxPosition;
+}
+
+std::vector<std::string> selectedVisualizers(const Options& opt) {
+    std::vector<std::string> names;
+    for (const auto& e : visualizerRegistry())
+        if (opt.viz.empty() || opt.viz == e.name) names.emplace_back(e.name);
+    return names;
+}
+
+/// Deterministic animation clock: frame i of a 60 fps run.
+float frameTime(int i) { return static_cast<float>(i) / 60.0f; }
+
+// ── gl suite ────────────────────────────────────────────────────────────────
+
+#ifdef WIZ_HAVE_EGL
+
+struct GLResult {
+    double uploadMs = 0, drawMs = 0, finishMs = 0;
+    double drawCalls = 0, uploadKB = 0;
+    double glCalls = 0, glElided = 0;   // state calls through GLStateCache
+};
+
+/// Replay the recorded frames through `gl` with `mode`; averages per frame.
+GLResult runStrategy(GLRenderer& gl, StreamMode mode,
+                     const std::vector<RecordingRenderer>& frames, int warmup) {
+    gl.setStreamMode(mode);
+    GLResult r;
+    const int total = static_cast<int>(frames.size());
+    for (int i = -warmup; i < total; ++i) {
+        const RecordingRenderer& rec = frames[static_cast<size_t>((i % total + total) % total)];
+        rec.replay(gl);
+        const auto t0 = Clock::now();
+        glFinish();
+        if (i < 0) continue;
+
+        const RenderStats& s = gl.lastFrameStats();
+        r.finishMs  += msSince(t0);
+        r.uploadMs  += s.uploadMs;
+        r.drawMs    += s.drawMs;
+        r.drawCalls += s.drawCalls;
+        r.uploadKB  += static_cast<double>(s.uploadBytes) / 1024.0;
+        r.glCalls   += s.glCalls;
+        r.glElided  += s.glElided;
+    }
+    for (double* v : {&r.uploadMs, &r.drawMs, &r.finishMs, &r.drawCalls, &r.uploadKB,
+                      &r.glCalls, &r.glElided})
+        *v /= total;
+    return r;
+}
+
+int runGL(const Options& opt) {
+    HeadlessGL ctx;
+    if (!ctx.init(opt.width, opt.height)) {
+        std::fprintf(stderr, "wizbench: headless GL unavailable: %s\n", ctx.error().c_str());
+        return 1;
+    }
+
+    GLRenderer gl;
+    const auto tInit = Clock::now();
+    if (!gl.init()) {
+        std::fprintf(stderr, "wizbench: GLRenderer::init failed\n");
+        return 1;
+    }
+    glFinish();
+    std::printf("GL_RENDERER  %s\n", ctx.renderer().c_str());
+    std::printf("shader init  %.2f ms\n", msSince(tInit));
+    std::printf("%dx%d, %d frames (+%d warmup), times are ms/frame\n\n",
+                opt.width, opt.height, opt.frames, opt.warmup);
+    std::printf("%-16s %-11s %9s %8s %9s %9s %9s %9s %7s %7s\n", "visualizer", "strategy",
+                "geometry", "draws", "KB", "upload", "draw", "finish", "state", "elided");
+
+    const StreamMode modes[] = {StreamMode::BufferData, StreamMode::Orphan,
+                                StreamMode::SubData, StreamMode::Ring};
+    const auto w = static_cast<float>(opt.width);
+    const auto h = static_cast<float>(opt.height);
+
+    JobSystem jobs;
+    for (const std::string& name : selectedVisualizers(opt)) {
+        auto viz = createVisualizer(name);
+        viz->attachJobs(&jobs);
+
+        // Record every frame up front so each strategy replays identical data.
+        std::vector<RecordingRenderer> frames(static_cast<size_t>(opt.frames));
+        double geometryMs = 0.0;
+        for (int i = 0; i < opt.frames; ++i) {
+            RecordingRenderer& rec = frames[static_cast<size_t>(i)];
+            const auto t0 = Clock::now();
+            rec.beginFrame(w, h);
+            viz->render(frameTime(i), w, h, rec);
+            rec.endFrame();
+            geometryMs += msSince(t0);
+        }
+        geometryMs /= opt.frames;
+
+        auto report = [&](const char* strategy, const GLResult& r) {
+            std::printf("%-16s %-11s %9.3f %8.1f %9.1f %9.3f %9.3f %9.3f %7.1f %7.1f\n",
+                        name.c_str(), strategy, geometryMs, r.drawCalls, r.uploadKB, r.uploadMs,
+                        r.drawMs, r.finishMs, r.glCalls, r.glElided);
+        };
+        for (StreamMode mode : modes)
+            report(streamModeName(mode), runStrategy(gl, mode, frames, opt.warmup));
+
+        // Quads again as six vertices each, against the indexed rows above.
+        const bool hasQuads = std::any_of(frames.begin(), frames.end(), [](const auto& f) {
+            return std::any_of(f.commands().begin(), f.commands().end(),
+                               [](const auto& c) { return c.mode == Primitive::Quads; });
+        });
+        if (hasQuads) {
+            gl.setIndexedQuads(false);
+            report("ring-tris", runStrategy(gl, StreamMode::Ring, frames, opt.warmup));
+            gl.setIndexedQuads(true);
+        }
+
+        // And every draw call uploaded and issued on its own.
+        gl.setBatching(false);
+        report("ring-direct", runStrategy(gl, StreamMode::Ring, frames, opt.warmup));
+        gl.setBatching(true);
+    }
+    return 0;
+}
+
+// ── pipeline suite ──────────────────────────────────────────────────────────
+
+int runPipeline(const Options& opt) {
+    HeadlessGL ctx;
+    GLRenderer gl;
+    if (!ctx.init(opt.width, opt.height) || !gl.init()) {
+        std::fprintf(stderr, "wizbench: headless GL unavailable: %s\n", ctx.error().c_str());
+        return 1;
+    }
+    // Recorded (pipelined) frames iterate the logistic map on the CPU; do so
+    // at depth 1 too, so the depths compare like for like.
+    gl.setGpuBifurcation(false);
+
+    JobSystem     jobs;
+    FramePipeline pipeline(jobs);
+    std::printf("GL_RENDERER  %s, %d job workers\n", ctx.renderer().c_str(),
+                jobs.workerCount());
+    std::printf("%dx%d, %d frames (+%d warmup), times are ms/frame on the main thread\n\n",
+                opt.width, opt.height, opt.frames, opt.warmup);
+    std::printf("%-16s %5s %9s %9s %9s %9s %10s\n", "visualizer", "depth", "frame",
+                "produce", "fence", "latency", "lat.frames");
+
+    const auto w = static_cast<float>(opt.width);
+    const auto h = static_cast<float>(opt.height);
+    for (const std::string& name : selectedVisualizers(opt)) {
+        auto viz = createVisualizer(name);
+        viz->attachJobs(&jobs);
+
+        for (int depth = 1; depth <= FramePipeline::kMaxDepth; ++depth) {
+            pipeline.setDepth(depth);
+            double frameMs = 0, produceMs = 0, fenceMs = 0, latencyMs = 0, latencyFrames = 0;
+            for (int i = -opt.warmup; i < opt.frames; ++i) {
+                const auto t0 = Clock::now();
+                const float time = frameTime(i + opt.warmup);
+                if (depth == 1) {
+                    gl.beginFrame(w, h);
+                    viz->render(time, w, h, gl);
+                    gl.endFrame();
+                } else {
+                    pipeline.frame(*viz, time, w, h, gl);
+                }
+                glFinish();
+                if (i < 0) continue;
+
+                const FramePipeline::Stats& s = pipeline.stats();
+                frameMs += msSince(t0);
+                if (depth > 1) {
+                    produceMs     += s.produceMs;
+                    fenceMs       += s.fenceWaitMs;
+                    latencyMs     += s.latencyMs;
+                    latencyFrames += s.latencyFrames;
+                }
+            }
+            pipeline.drain();
+            const double n = opt.frames;
+            std::printf("%-16s %5d %9.3f %9.3f %9.3f %9.3f %10.1f\n", name.c_str(), depth,
+                        frameMs / n, produceMs / n, fenceMs / n, latencyMs / n,
+                        latencyFrames / n);
+        }
+    }
+    return 0;
+}
+
+#else
+
+int runGL(const Options&) {
+    std::fprintf(stderr, "wizbench: built without EGL/GLESv2; the gl suite is unavailable\n");
+    return 1;
+}
+
+int runPipeline(const Options&) {
+    std::fprintf(stderr, "wizbench: built without EGL/GLESv2; the pipeline suite is unavailable\n");
+    return 1;
+}
+
+#endif
+
+// ── scan suite ──────────────────────────────────────────────────────────────
+
+int runScan(const Options& opt) {
+    const auto n = static_cast<std::size_t>(opt.terms);
+    std::vector<double> ref(n), sums(n);
+
+    std::vector<unsigned> threads{1};
+    const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned t = 2; t < cores; t *= 2) threads.push_back(t);
+    if (cores > 1) threads.push_back(cores);
+
+    std::printf("%zu terms, %u cores; Mterms/s, max |diff| vs sequential\n\n", n, cores);
+    std::printf("%-16s %-11s %9s %9s %11s\n", "series", "method", "ms", "Mterms/s", "max diff");
+    auto row = [&](const char* key, const std::string& method, double ms, double diff) {
+        std::printf("%-16s %-11s %9.1f %9.1f %11.3g\n", key, method.c_str(), ms,
+                    static_cast<double>(n) / ms / 1e3, diff);
+    };
+
+    for (const SeriesInfo& info : kSeriesTable) {
+        if (!opt.viz.empty() && opt.viz != info.key) continue;
+        const double ratio = 0.5;   // Geometric only
+
+        auto t0 = Clock::now();
+        PartialSumCursor cursor(info.kind, ratio);
+        for (double& s : ref) {
+            cursor.next();
+            s = cursor.sum();
+        }
+        row(info.key, "sequential", msSince(t0), 0.0);
+
+        for (unsigned t : threads) {
+            JobSystem      jobs(static_cast<int>(t));
+            PartialSumScan scan(info.kind, ratio);
+            t0 = Clock::now();
+            scan.run(0, sums, {}, {}, &jobs);
+            const double ms = msSince(t0);
+            double diff = 0.0;
+            for (std::size_t i = 0; i < n; ++i) diff = std::max(diff, std::abs(sums[i] - ref[i]));
+            row(info.key, "scan x" + std::to_string(t), ms, diff);
+        }
+    }
+    return 0;
+}
+
+// ── feigenbaum suite ────────────────────────────────────────────────────────
+
+int runFeigenbaum(const Options& opt) {
+    FeigenbaumEngine engine;
+    std::printf("%3s %-36s %-18s %-18s %-14s %9s\n", "n", "R_n (superstable)",
+                "b_n (bifurcation)", "delta_n", "alpha_n", "ms");
+    const auto t0 = Clock::now();
+    for (int n = 0; n <= opt.levels; ++n) {
+        const auto t1 = Clock::now();
+        const FeigenbaumLevel& L = engine.extend(n).back();
+        std::printf("%3d %-36s %-18.15f %-18.15f %-14.10f %9.2f\n", L.n,
+                    L.superstable.toString(32).c_str(), L.bifurcation, L.delta, L.alpha,
+                    msSince(t1));
+    }
+    std::printf("\n%d levels in %.1f ms\n", opt.levels, msSince(t0));
+    std::printf("delta ~ %.15f\nalpha ~ %.12f\nr_inf ~ %s\n", engine.delta(), engine.alpha(),
+                engine.accumulation().toString(25).c_str());
+    return 0;
+}
+
+// ── bbp suite ───────────────────────────────────────────────────────────────
+
+int runBbp(const Options& opt) {
+    const auto d = static_cast<std::uint64_t>(opt.position);
+
+    std::vector<unsigned> threads{1};
+    const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned t = 2; t < cores; t *= 2) threads.push_back(t);
+    if (cores > 1) threads.push_back(cores);
+
+    const int digits = BbpPi::reliableDigits(d);
+    std::printf("hex digits of pi after position %lld, %u cores\n\n", opt.position, cores);
+    std::printf("%-9s %-18s %11s %11s\n", "threads", "digits", "ms", "Mterms/s");
+    std::uint64_t first = 0;
+    bool          agree = true;
+    for (unsigned t : threads) {
+        JobSystem           jobs(static_cast<int>(t));
+        const auto          t0   = Clock::now();
+        const std::uint64_t frac = BbpPi::fraction(d, &jobs);
+        const double        ms   = msSince(t0);
+        if (t == threads.front()) first = frac;
+        agree &= frac == first;
+        std::printf("%-9u %-18s %11.1f %11.2f\n", t, BbpPi::toHex(frac, digits).c_str(), ms,
+                    static_cast<double>(d + 1) / ms / 1e3);
+    }
+    std::printf("\n%d digits exact at this position; thread counts %s\n", digits,
+                agree ? "agree bit for bit" : "DISAGREE");
+    return agree ? 0 : 1;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, opt)) {
+        printUsage();
+        return 2;
+    }
+    if (selectedVisualizers(opt).empty()) {
+        std::fprintf(stderr, "Unknown visualizer: %s\n", opt.viz.c_str());
+        return 2;
+    }
+
+    if (opt.suite == "gl")         return runGL(opt);
+    if (opt.suite == "pipeline")   return runPipeline(opt);
+    if (opt.suite == "scan")       return runScan(opt);
+    if (opt.suite == "feigenbaum") return runFeigenbaum(opt);
+    if (opt.suite == "bbp")        return runBbp(opt);
+
+    std::fprintf(stderr, "Unknown suite: %s\n", opt.suite.c_str());
+    printUsage();
+    return 2;
+}
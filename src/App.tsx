@@ -31,14 +31,19 @@ const CANVAS_ID = "wiz-canvas";
 type VisualizerName =
   | "cantor"
   | "harmonic"
+  | "kempner"
   | "geometric"
   | "logistic"
+  | "lyapunov"
+  | "attractor"
   | "basel"
   | "alt_harmonic"
+  | "random_harmonic"
   | "e_series"
   | "inv_geometric"
   | "gregory_leibniz"
-  | "apery";
+  | "apery"
+  | "infinite_product";
 
 interface ParamDef {
   name: string;
@@ -47,6 +52,13 @@ interface ParamDef {
   max: number;
   step: number;
   default: number;
+  /** Slider moves in log10 space (for ranges spanning many decades). */
+  log?: boolean;
+  /**
+   * Integer beyond float precision (2²⁴): sent to the engine as two exact
+   * halves, `${name}_hi` and `${name}_lo`, of 20 bits each.
+   */
+  exact?: boolean;
 }
 
 interface VisualizerConfig {
@@ -59,9 +71,27 @@ const VISUALIZERS: Record<VisualizerName, VisualizerConfig> = {
   cantor: {
     label: "Cantor Set",
     description:
-      "Recursive removal of middle-thirds, revealing the uncountably infinite Cantor dust at every level of depth.",
+      "Recursive removal of middle-thirds, revealing the uncountably infinite Cantor dust at every level of depth. IFS mode plays the chaos game instead: random contractions, repeated billions of times, fill in Cantor dust, the Sierpinski triangle and carpet, or Barnsley\u2019s fern.",
     params: [
       { name: "depth", label: "Depth", min: 1, max: 10, step: 1, default: 6 },
+      { name: "mode", label: "Mode (recursive, IFS)", min: 0, max: 1, step: 1, default: 0 },
+      {
+        name: "ifs",
+        label: "IFS (dust, triangle, carpet, fern)",
+        min: 0,
+        max: 3,
+        step: 1,
+        default: 0,
+      },
+      {
+        name: "samples",
+        label: "IFS Samples (millions)",
+        min: 1,
+        max: 10_000,
+        step: 1,
+        default: 1000,
+        log: true,
+      },
     ],
   },
   harmonic: {
@@ -73,10 +103,30 @@ const VISUALIZERS: Record<VisualizerName, VisualizerConfig> = {
         name: "terms",
         label: "Terms",
         min: 1,
-        max: 2000,
+        max: 10_000_000,
         step: 1,
         default: 30,
+        log: true,
+      },
+    ],
+  },
+  kempner: {
+    label: "Kempner Series",
+    description:
+      "Strike every term containing a 9 from the harmonic series and what is left converges \u2014 to about 22.92, yet summing it term by term to 10\u2079 gets only halfway. Baillie\u2019s digit recurrence gives the sums below each power of ten exactly, and the limit to 20 digits; any digit string can be excluded.",
+    params: [
+      { name: "exclude", label: "Excluded digits", min: 0, max: 999_999, step: 1, default: 9 },
+      { name: "exclude_width", label: "Digits in the string", min: 1, max: 6, step: 1, default: 1 },
+      {
+        name: "decades",
+        label: "Powers of ten",
+        min: 4,
+        max: 10_000,
+        step: 1,
+        default: 40,
+        log: true,
       },
+      { name: "direct", label: "Direct sum to 10^x", min: 3, max: 11, step: 0.5, default: 9 },
     ],
   },
   geometric: {
@@ -105,7 +155,7 @@ const VISUALIZERS: Record<VisualizerName, VisualizerConfig> = {
   logistic: {
     label: "Logistic Map",
     description:
-      "The bifurcation diagram of x\u2099\u208A\u2081 = r\u00B7x\u2099(1\u2212x\u2099). Period-doubling cascades into chaos; the red line marks the onset at r \u2248 3.57.",
+      "The bifurcation diagram of x\u2099\u208A\u2081 = r\u00B7x\u2099(1\u2212x\u2099). Period-doubling cascades into chaos: faint red lines mark each doubling b\u2099, computed numerically, and the solid line their limit r\u221E \u2248 3.5699, where successive gaps shrink by Feigenbaum\u2019s \u03B4 \u2248 4.6692.",
     params: [
       {
         name: "growth_rate",
@@ -117,6 +167,62 @@ const VISUALIZERS: Record<VisualizerName, VisualizerConfig> = {
       },
     ],
   },
+  lyapunov: {
+    label: "Lyapunov Fractal",
+    description:
+      "The logistic map with r alternating between a and b by a fixed sequence. Each point (a, b) is coloured by its Lyapunov exponent \u03BB: gold where the orbit settles (\u03BB < 0), blue where it is chaotic (\u03BB > 0).",
+    params: [
+      {
+        name: "sequence",
+        label: "Sequence (AB, AABAB, B\u2076A\u2076, AABB, ABBBB)",
+        min: 0,
+        max: 4,
+        step: 1,
+        default: 0,
+      },
+      {
+        name: "iterations",
+        label: "Iterations",
+        min: 100,
+        max: 20_000,
+        step: 100,
+        default: 1000,
+        log: true,
+      },
+    ],
+  },
+  attractor: {
+    label: "Strange Attractors",
+    description:
+      "Chaotic maps of the plane iterated hundreds of millions of times. One orbit never repeats, yet it traces the same fractal set, visited with a fixed density: the H\u00E9non, Clifford and Lozi attractors, shaded by how often each point is hit, refining while on screen.",
+    params: [
+      {
+        name: "attractor",
+        label: "Attractor (H\u00E9non, Clifford, Lozi)",
+        min: 0,
+        max: 2,
+        step: 1,
+        default: 1,
+      },
+      { name: "henon_a", label: "H\u00E9non a", min: 1.0, max: 1.42, step: 0.01, default: 1.4 },
+      { name: "henon_b", label: "H\u00E9non b", min: 0.0, max: 0.35, step: 0.01, default: 0.3 },
+      { name: "clifford_a", label: "Clifford a", min: -3, max: 3, step: 0.01, default: -1.4 },
+      { name: "clifford_b", label: "Clifford b", min: -3, max: 3, step: 0.01, default: 1.6 },
+      { name: "clifford_c", label: "Clifford c", min: -3, max: 3, step: 0.01, default: 1.0 },
+      { name: "clifford_d", label: "Clifford d", min: -3, max: 3, step: 0.01, default: 0.7 },
+      { name: "lozi_a", label: "Lozi a", min: 1.0, max: 2.0, step: 0.01, default: 1.7 },
+      { name: "lozi_b", label: "Lozi b", min: 0.0, max: 0.6, step: 0.01, default: 0.5 },
+      {
+        name: "samples",
+        label: "Samples (millions)",
+        min: 1,
+        max: 10_000,
+        step: 1,
+        default: 100,
+        log: true,
+      },
+    ],
+  },
   basel: {
     label: "Basel Problem",
     description:
@@ -126,25 +232,55 @@ const VISUALIZERS: Record<VisualizerName, VisualizerConfig> = {
         name: "terms",
         label: "Terms",
         min: 1,
-        max: 2000,
+        max: 10_000_000,
         step: 1,
         default: 40,
+        log: true,
       },
     ],
   },
   alt_harmonic: {
     label: "Alternating Harmonic",
     description:
-      "The sum \u2211 (\u22121)\u207F\u207A\u00B9/n converges conditionally to ln(2) \u2248 0.6931. A series that balances perfectly on the edge of infinity.",
+      "The sum \u2211 (\u22121)\u207F\u207A\u00B9/n converges conditionally to ln(2) \u2248 0.6931. A series that balances perfectly on the edge of infinity. Rearranged, the same terms converge to any target (Riemann): positive terms are taken until the sum passes it, then negative ones until it drops below.",
     params: [
       {
         name: "terms",
         label: "Terms",
         min: 1,
-        max: 2000,
+        max: 10_000_000,
         step: 1,
         default: 30,
+        log: true,
       },
+      { name: "mode", label: "Order (natural, rearranged)", min: 0, max: 1, step: 1, default: 0 },
+      { name: "target", label: "Rearrangement target", min: -3, max: 3, step: 0.01, default: 1.5 },
+    ],
+  },
+  random_harmonic: {
+    label: "Random Harmonic",
+    description:
+      "The sum \u2211 \u00B11/n with a coin flip for every sign converges with probability one. A hundred thousand random paths fan out and settle; the histogram on the right shows where they end, a smooth distribution of variance \u03C0\u00B2/6.",
+    params: [
+      {
+        name: "paths",
+        label: "Paths (thousands)",
+        min: 1,
+        max: 10_000,
+        step: 1,
+        default: 100,
+        log: true,
+      },
+      {
+        name: "terms",
+        label: "Terms",
+        min: 16,
+        max: 65_536,
+        step: 1,
+        default: 4096,
+        log: true,
+      },
+      { name: "seed", label: "Seed", min: 1, max: 1000, step: 1, default: 1 },
     ],
   },
   e_series: {
@@ -180,16 +316,29 @@ const VISUALIZERS: Record<VisualizerName, VisualizerConfig> = {
   gregory_leibniz: {
     label: "Gregory\u2013Leibniz",
     description:
-      "The sum \u2211 (\u22121)\u207F/(2n+1) = \u03C0/4 \u2248 0.7854. An elegantly simple alternating sum of odd reciprocals that maps directly to \u03C0.",
+      "The sum \u2211 (\u22121)\u207F/(2n+1) = \u03C0/4 \u2248 0.7854. An elegantly simple alternating sum of odd reciprocals that maps directly to \u03C0. Digit mode goes the other way: the Bailey\u2013Borwein\u2013Plouffe formula extracts hex digits of \u03C0 at any position without computing the ones before it.",
     params: [
       {
         name: "terms",
         label: "Terms",
         min: 1,
-        max: 2000,
+        max: 10_000_000,
         step: 1,
         default: 40,
+        log: true,
       },
+      { name: "mode", label: "Mode (series, digits)", min: 0, max: 1, step: 1, default: 0 },
+      {
+        name: "position",
+        label: "Digit position",
+        min: 0,
+        max: 1_000_000_000,
+        step: 1,
+        default: 1_000_000,
+        log: true,
+        exact: true,
+      },
+      { name: "digits", label: "Hex digits", min: 16, max: 256, step: 16, default: 64 },
     ],
   },
   apery: {
@@ -201,12 +350,38 @@ const VISUALIZERS: Record<VisualizerName, VisualizerConfig> = {
         name: "terms",
         label: "Terms",
         min: 1,
-        max: 2000,
+        max: 10_000_000,
         step: 1,
         default: 30,
+        log: true,
       },
     ],
   },
+  infinite_product: {
+    label: "Infinite Products",
+    description:
+      "Wallis\u2019s product of 4n\u00B2/(4n\u00B2\u22121), Vi\u00E8te\u2019s nested radicals and Euler\u2019s product over the primes, which equals \u03B6(s). Each bar is the logarithm of one factor: summed with compensation and exponentiated, they give partial products that stay exact to 10\u2077 factors.",
+    params: [
+      {
+        name: "terms",
+        label: "Factors",
+        min: 1,
+        max: 10_000_000,
+        step: 1,
+        default: 30,
+        log: true,
+      },
+      {
+        name: "product",
+        label: "Product (Wallis, Vi\u00E8te, Euler)",
+        min: 0,
+        max: 2,
+        step: 1,
+        default: 0,
+      },
+      { name: "s", label: "Euler exponent s", min: 1, max: 4, step: 0.05, default: 2 },
+    ],
+  },
 };
 
 const VIZ_KEYS = Object.keys(VISUALIZERS) as VisualizerName[];
@@ -222,6 +397,20 @@ function buildDefaults(): Record<string, Record<string, number>> {
   return out;
 }
 
+// ─── Engine parameters ──────────────────────────────────────────────────────
+
+/** Set a parameter of visualizer `viz` (the active one) on the engine. */
+function sendParam(mgr: SeriesManager, viz: VisualizerName, name: string, value: number) {
+  const def = VISUALIZERS[viz].params.find((p) => p.name === name);
+  if (!def?.exact) {
+    mgr.setParam(name, value);
+    return;
+  }
+  const half = 2 ** 20;
+  mgr.setParam(`${name}_hi`, Math.floor(value / half));
+  mgr.setParam(`${name}_lo`, value % half);
+}
+
 // ─── Coordinate helpers ─────────────────────────────────────────────────────
 // Convert clip-space (-1..1) to canvas pixel coordinates.
 
@@ -235,20 +424,74 @@ function clipToPixelY(clipY: number, h: number): number {
 // Module-level view state set before each annotation render pass.
 let _vScale = 1;
 let _vOffset = 0;
+// Y extent the engine autoscaled the active plot to (0: not available).
+let _yScale = 0;
+// Labels the engine computed for the active plot (getPlotReadout), or null.
+let _readout: unknown = null;
 
 /** clipToPixelX with the current pan/zoom view transform applied. */
 function viewClipX(clipX: number, w: number): number {
   return ((clipX * _vScale + _vOffset + 1) / 2) * w;
 }
 
-/** Pick sensible x-axis tick spacing for a given number of terms. */
+/** Pick sensible x-axis tick spacing for the terms visible at the current zoom. */
 function xTickStep(terms: number): number {
-  if (terms <= 10) return 1;
-  if (terms <= 50) return 5;
-  if (terms <= 100) return 10;
-  if (terms <= 500) return 50;
-  if (terms <= 1000) return 100;
-  return 250;
+  const visible = terms / Math.max(1, _vScale);
+  if (visible <= 10) return 1;
+  if (visible <= 50) return 5;
+  if (visible <= 100) return 10;
+  if (visible <= 500) return 50;
+  if (visible <= 1000) return 100;
+  if (visible <= 2000) return 250;
+  // ~8 ticks at a 1/2/5 × 10ⁿ spacing
+  const raw = visible / 8;
+  const mag = Math.pow(10, Math.floor(Math.log10(raw)));
+  const m = raw / mag;
+  return (m <= 2 ? 2 : m <= 5 ? 5 : 10) * mag;
+}
+
+const _sumCache = new Map<string, number>();
+
+/**
+ * Σ term(k) for k = first … first + terms − 1, computed once per series and
+ * term count (counts reach 10⁷, too many to re-sum every frame).
+ */
+function cachedPartialSum(
+  key: string,
+  terms: number,
+  first: number,
+  term: (k: number) => number,
+): number {
+  const id = `${key}:${terms}`;
+  let s = _sumCache.get(id);
+  if (s === undefined) {
+    s = 0;
+    for (let k = first; k < first + terms; k++) s += term(k);
+    _sumCache.set(id, s);
+  }
+  return s;
+}
+
+/// Sum of the first `terms` terms of the alternating harmonic series in the
+/// engine's greedy order towards `target` (Rearrangement.h), cached.
+function rearrangedPartialSum(target: number, terms: number): number {
+  const id = `alt_harmonic_rearranged:${target}:${terms}`;
+  let s = _sumCache.get(id);
+  if (s === undefined) {
+    s = 0;
+    let odd = 1, even = 2;
+    for (let k = 0; k < terms; k++) {
+      if (s <= target) {
+        s += 1 / odd;
+        odd += 2;
+      } else {
+        s -= 1 / even;
+        even += 2;
+      }
+    }
+    _sumCache.set(id, s);
+  }
+  return s;
 }
 
 // ─── Annotation renderers ───────────────────────────────────────────────────
@@ -262,12 +505,58 @@ const ACCENT_COLOR = "#8e44ad";
 const SUM_COLOR = "#1a3f7a";
 const LIMIT_COLOR = "#1a7a2e";
 
+// Chaos-game systems, indexed by the "ifs" parameter as in the engine;
+// self-similar ones list their map count and ratio for the dimension.
+const IFS_SYSTEMS = [
+  { name: "Cantor dust", maps: 4, ratio: 1 / 3 },
+  { name: "Sierpinski triangle", maps: 3, ratio: 1 / 2 },
+  { name: "Sierpinski carpet", maps: 8, ratio: 1 / 3 },
+  { name: "Barnsley fern", maps: 4, ratio: 0 },
+];
+
+function drawIfsAnnotations(
+  ctx: CanvasRenderingContext2D,
+  w: number,
+  h: number,
+  params: Record<string, number>,
+) {
+  const idx = Math.min(IFS_SYSTEMS.length - 1, Math.max(0, Math.floor(params.ifs ?? 0)));
+  const sys = IFS_SYSTEMS[idx];
+  const yMin = -1 + 0.10, yMax = 1 - 0.08;
+  const baseFontSize = Math.max(10, Math.min(14, w * 0.012));
+
+  ctx.font = `${baseFontSize * 1.1}px system-ui, sans-serif`;
+  ctx.fillStyle = FORMULA_COLOR;
+  ctx.textAlign = "center";
+  ctx.textBaseline = "middle";
+  ctx.fillText(
+    `${sys.name}  \u2014  chaos game, ${sys.maps} affine maps`,
+    clipToPixelX(0.04, w),
+    clipToPixelY(yMax + 0.05, h),
+  );
+
+  if (sys.ratio > 0) {
+    ctx.font = `italic ${baseFontSize * 0.9}px system-ui, sans-serif`;
+    ctx.fillStyle = LABEL_MUTED;
+    const dim = Math.log(sys.maps) / Math.log(1 / sys.ratio);
+    ctx.fillText(
+      `Similarity dimension log ${sys.maps} / log ${Math.round(1 / sys.ratio)} \u2248 ${dim.toFixed(4)}`,
+      clipToPixelX(0.04, w),
+      clipToPixelY(yMin - 0.055, h),
+    );
+  }
+}
+
 function drawCantorAnnotations(
   ctx: CanvasRenderingContext2D,
   w: number,
   h: number,
   params: Record<string, number>,
 ) {
+  if ((params.mode ?? 0) >= 0.5) {
+    drawIfsAnnotations(ctx, w, h, params);
+    return;
+  }
   const depth = Math.min(12, Math.max(1, Math.round(params.depth ?? 6)));
 
   const mLeft = 0.14, mRight = 0.06, mBottom = 0.10, mTop = 0.08;
@@ -342,16 +631,15 @@ function drawHarmonicAnnotations(
   h: number,
   params: Record<string, number>,
 ) {
-  const terms = Math.min(2000, Math.max(1, Math.round(params.terms ?? 30)));
+  const terms = Math.min(10_000_000, Math.max(1, Math.round(params.terms ?? 30)));
 
   const mLeft = 0.14, mRight = 0.06, mBottom = 0.12, mTop = 0.08;
   const xMin = -1 + mLeft, xMax = 1 - mRight;
   const yMin = -1 + mBottom, yMax = 1 - mTop;
 
-  // Compute partial sum and yScale (matching C++)
-  let maxSum = 0;
-  for (let k = 1; k <= terms; k++) maxSum += 1 / k;
-  const yScale = Math.max(1, maxSum) * 1.1;
+  // Partial sum, and the y scale the engine chose for the visible window
+  const maxSum = cachedPartialSum("harmonic", terms, 1, (k) => 1 / k);
+  const yScale = _yScale > 0 ? _yScale : Math.max(1, maxSum) * 1.1;
 
   const baseFontSize = Math.max(10, Math.min(14, w * 0.012));
 
@@ -441,6 +729,109 @@ function drawHarmonicAnnotations(
   );
 }
 
+/** Labels the Kempner visualizer computes in the engine (plotReadout). */
+interface KempnerReadout {
+  pattern: string;
+  limit: string;
+  decades: number;
+  decadeTick: number;
+  directCount: number;
+  directSum: string;
+}
+
+function drawKempnerAnnotations(
+  ctx: CanvasRenderingContext2D,
+  w: number,
+  h: number,
+  params: Record<string, number>,
+) {
+  const readout = _readout as KempnerReadout | null;
+  const decades = readout?.decades ?? Math.round(params.decades ?? 40);
+
+  const mLeft = 0.14, mRight = 0.06, mBottom = 0.12, mTop = 0.08;
+  const xMin = -1 + mLeft, xMax = 1 - mRight;
+  const yMin = -1 + mBottom, yMax = 1 - mTop;
+  const yScale = _yScale > 0 ? _yScale : 30;
+
+  const baseFontSize = Math.max(10, Math.min(14, w * 0.012));
+
+  // Y-axis tick labels at the engine's gridlines (1, 2 or 5 × 10ⁿ)
+  const raw = yScale / 4;
+  const mag = Math.pow(10, Math.floor(Math.log10(raw)));
+  const step = [1, 2, 5, 10].map((m) => m * mag).find((s) => s >= raw * 0.999) ?? raw;
+
+  ctx.font = `${baseFontSize}px "SF Mono", "Cascadia Code", "Fira Code", monospace`;
+  ctx.fillStyle = LABEL_COLOR;
+  ctx.textAlign = "right";
+  ctx.textBaseline = "middle";
+  for (let v = 0; v < yScale * 0.999; v += step) {
+    const clipY = yMin + (v / yScale) * (yMax - yMin);
+    ctx.fillText(formatTick(v), clipToPixelX(xMin - 0.025, w), clipToPixelY(clipY, h));
+  }
+
+  // X-axis: powers of ten
+  ctx.textAlign = "center";
+  ctx.textBaseline = "top";
+  const tick = readout?.decadeTick ?? Math.max(1, Math.round(decades / 10));
+  for (let j = 0; j <= decades; j += tick) {
+    const clipX = xMin + (j / decades) * (xMax - xMin);
+    ctx.fillText(`10${superscript(j)}`, clipToPixelX(clipX, w), clipToPixelY(yMin - 0.02, h));
+  }
+
+  // Y-axis label
+  ctx.save();
+  ctx.font = `bold ${baseFontSize}px system-ui, sans-serif`;
+  ctx.fillStyle = LABEL_COLOR;
+  ctx.textAlign = "center";
+  ctx.textBaseline = "middle";
+  ctx.translate(clipToPixelX(-1 + 0.03, w), clipToPixelY((yMin + yMax) / 2, h));
+  ctx.rotate(-Math.PI / 2);
+  ctx.fillText("Partial sum", 0, 0);
+  ctx.restore();
+
+  // X-axis label
+  ctx.font = `bold ${baseFontSize}px system-ui, sans-serif`;
+  ctx.fillStyle = LABEL_COLOR;
+  ctx.textAlign = "center";
+  ctx.textBaseline = "top";
+  ctx.fillText("Terms below n", clipToPixelX((xMin + xMax) / 2, w), clipToPixelY(yMin - 0.07, h));
+
+  // Title / formula
+  const pattern = readout?.pattern ?? "9";
+  ctx.font = `${baseFontSize * 1.1}px system-ui, sans-serif`;
+  ctx.fillStyle = FORMULA_COLOR;
+  ctx.textAlign = "center";
+  ctx.textBaseline = "bottom";
+  ctx.fillText(
+    `\u2211 1/n, n < 10${superscript(decades)} without \u201C${pattern}\u201D in its digits`,
+    clipToPixelX((xMin + xMax) / 2, w),
+    clipToPixelY(yMax + 0.05, h),
+  );
+  if (!readout) return;
+
+  // Limit to 20 digits, and how far direct summation has got — top right
+  ctx.font = `bold ${baseFontSize}px "SF Mono", "Cascadia Code", "Fira Code", monospace`;
+  ctx.fillStyle = LIMIT_COLOR;
+  ctx.textAlign = "right";
+  ctx.textBaseline = "top";
+  ctx.fillText(
+    `Limit = ${readout.limit}`,
+    clipToPixelX(xMax - 0.01, w),
+    clipToPixelY(yMax + 0.04, h),
+  );
+
+  if (readout.directCount > 0) {
+    ctx.font = `${baseFontSize * 0.9}px "SF Mono", "Cascadia Code", "Fira Code", monospace`;
+    ctx.fillStyle = "#a0620a";
+    const exp = Math.log10(readout.directCount).toFixed(1);
+    ctx.fillText(
+      `Direct, n \u2264 10^${exp}: ${readout.directSum}`,
+      clipToPixelX(xMax - 0.01, w),
+      clipToPixelY(yMax + 0.04, h) + baseFontSize * 1.5,
+    );
+  }
+}
+
 function drawGeometricAnnotations(
   ctx: CanvasRenderingContext2D,
   w: number,
@@ -466,7 +857,7 @@ function drawGeometricAnnotations(
       v *= ratio;
     }
   }
-  const scale = Math.max(maxAbsVal, maxAbsSum, 0.001);
+  const scale = _yScale > 0 ? _yScale : Math.max(maxAbsVal, maxAbsSum, 0.001);
 
   // Compute final partial sum
   let partialSum = 0;
@@ -629,9 +1020,10 @@ function drawLogisticAnnotations(
     ctx.fillText(rv.toFixed(1), px, py);
   }
 
-  // Chaos onset label
-  if (rMax > 3.57) {
-    const chaosT = (3.57 - rMin) / (rMax - rMin);
+  // Chaos onset label at r∞, the accumulation point of the cascade
+  const rInf = 3.569945671870945;
+  if (rMax > rInf) {
+    const chaosT = (rInf - rMin) / (rMax - rMin);
     const cx = xMin + (xMax - xMin) * chaosT;
     const chaosPx = viewClipX(cx + 0.01, w);
     if (chaosPx >= 0 && chaosPx <= w) {
@@ -640,7 +1032,7 @@ function drawLogisticAnnotations(
       ctx.textAlign = "left";
       ctx.textBaseline = "bottom";
       ctx.fillText(
-        "r \u2248 3.57",
+        "r\u221E \u2248 3.5699",
         chaosPx,
         clipToPixelY(yMax - 0.02, h),
       );
@@ -709,6 +1101,149 @@ function drawLogisticAnnotations(
   );
 }
 
+/** Sequences and (a, b) windows, indexed like LyapunovVisualizer::kSequences. */
+const LYAPUNOV_SEQUENCES = [
+  { name: "AB", a: [2.0, 4.0], b: [2.0, 4.0] },
+  { name: "AABAB", a: [2.0, 4.0], b: [2.0, 4.0] },
+  { name: "BBBBBBAAAAAA", a: [3.4, 4.0], b: [2.5, 3.4] },
+  { name: "AABB", a: [2.0, 4.0], b: [2.0, 4.0] },
+  { name: "ABBBB", a: [2.0, 4.0], b: [2.0, 4.0] },
+];
+
+function drawLyapunovAnnotations(
+  ctx: CanvasRenderingContext2D,
+  w: number,
+  h: number,
+  params: Record<string, number>,
+) {
+  const idx = Math.min(
+    LYAPUNOV_SEQUENCES.length - 1,
+    Math.max(0, Math.floor(params.sequence ?? 0)),
+  );
+  const seq = LYAPUNOV_SEQUENCES[idx];
+  const [aMin, aMax] = seq.a;
+  const [bMin, bMax] = seq.b;
+
+  const mLeft = 0.14, mRight = 0.06, mBottom = 0.12, mTop = 0.08;
+  const xMin = -1 + mLeft, xMax = 1 - mRight;
+  const yMin = -1 + mBottom, yMax = 1 - mTop;
+
+  const baseFontSize = Math.max(10, Math.min(14, w * 0.012));
+  // Multiples of 0.5 (0.1 for narrow windows), as the engine ticks them
+  const ticks = (lo: number, hi: number) => {
+    const step = hi - lo > 1 ? 0.5 : 0.1;
+    const out: number[] = [];
+    for (let k = Math.ceil(lo / step - 1e-3); k * step <= hi + 1e-3; k++)
+      out.push(k * step);
+    return out;
+  };
+
+  // a tick labels (bottom) follow the pan/zoom view
+  ctx.font = `${baseFontSize}px "SF Mono", "Cascadia Code", "Fira Code", monospace`;
+  ctx.fillStyle = LABEL_COLOR;
+  ctx.textAlign = "center";
+  ctx.textBaseline = "top";
+  for (const a of ticks(aMin, aMax)) {
+    const px = viewClipX(xMin + ((xMax - xMin) * (a - aMin)) / (aMax - aMin), w);
+    if (px < 0 || px > w) continue;
+    ctx.fillText(a.toFixed(1), px, clipToPixelY(yMin - 0.025, h));
+  }
+
+  // b tick labels (left)
+  ctx.textAlign = "right";
+  ctx.textBaseline = "middle";
+  for (const b of ticks(bMin, bMax)) {
+    const clipY = yMin + ((yMax - yMin) * (b - bMin)) / (bMax - bMin);
+    ctx.fillText(b.toFixed(1), clipToPixelX(xMin - 0.02, w), clipToPixelY(clipY, h));
+  }
+
+  // Axis labels
+  ctx.font = `bold ${baseFontSize}px system-ui, sans-serif`;
+  ctx.fillStyle = LABEL_COLOR;
+  ctx.textAlign = "center";
+  ctx.textBaseline = "top";
+  ctx.fillText("a", clipToPixelX((xMin + xMax) / 2, w), clipToPixelY(yMin - 0.075, h));
+  ctx.save();
+  ctx.textBaseline = "middle";
+  ctx.translate(clipToPixelX(-1 + 0.025, w), clipToPixelY((yMin + yMax) / 2, h));
+  ctx.rotate(-Math.PI / 2);
+  ctx.fillText("b", 0, 0);
+  ctx.restore();
+
+  // Title / formula
+  ctx.font = `${baseFontSize * 1.1}px system-ui, sans-serif`;
+  ctx.fillStyle = FORMULA_COLOR;
+  ctx.textAlign = "center";
+  ctx.textBaseline = "bottom";
+  ctx.fillText(
+    "\u03BB = lim (1/N) \u2211 ln|r\u2099(1 \u2212 2x\u2099)|",
+    clipToPixelX((xMin + xMax) / 2, w),
+    clipToPixelY(yMax + 0.05, h),
+  );
+
+  // Sequence — top right
+  ctx.font = `bold ${baseFontSize}px "SF Mono", "Cascadia Code", "Fira Code", monospace`;
+  ctx.fillStyle = SUM_COLOR;
+  ctx.textAlign = "right";
+  ctx.textBaseline = "top";
+  ctx.fillText(
+    `sequence ${seq.name}`,
+    clipToPixelX(xMax - 0.01, w),
+    clipToPixelY(yMax + 0.04, h),
+  );
+}
+
+// Strange attractors, indexed by the "attractor" parameter as in the engine,
+// with the parameters each map reads.
+const ATTRACTORS = [
+  {
+    name: "H\u00E9non",
+    formula: "x\u2032 = 1 \u2212 a\u00B7x\u00B2 + y,   y\u2032 = b\u00B7x",
+    params: ["henon_a", "henon_b"],
+  },
+  {
+    name: "Clifford",
+    formula: "x\u2032 = sin(a\u00B7y) + c\u00B7cos(a\u00B7x),   y\u2032 = sin(b\u00B7x) + d\u00B7cos(b\u00B7y)",
+    params: ["clifford_a", "clifford_b", "clifford_c", "clifford_d"],
+  },
+  {
+    name: "Lozi",
+    formula: "x\u2032 = 1 \u2212 a\u00B7|x| + y,   y\u2032 = b\u00B7x",
+    params: ["lozi_a", "lozi_b"],
+  },
+];
+
+function drawAttractorAnnotations(
+  ctx: CanvasRenderingContext2D,
+  w: number,
+  h: number,
+  params: Record<string, number>,
+) {
+  const idx = Math.min(ATTRACTORS.length - 1, Math.max(0, Math.floor(params.attractor ?? 1)));
+  const att = ATTRACTORS[idx];
+  const xMax = 1 - 0.06;
+  const yMin = -1 + 0.10, yMax = 1 - 0.08;
+  const baseFontSize = Math.max(10, Math.min(14, w * 0.012));
+
+  // Title / formula
+  ctx.font = `${baseFontSize * 1.1}px system-ui, sans-serif`;
+  ctx.fillStyle = FORMULA_COLOR;
+  ctx.textAlign = "center";
+  ctx.textBaseline = "middle";
+  ctx.fillText(
+    `${att.name}  \u2014  ${att.formula}`,
+    clipToPixelX(0.04, w),
+    clipToPixelY(yMax + 0.05, h),
+  );
+
+  // Parameters — bottom right
+  ctx.font = `${baseFontSize}px "SF Mono", "Cascadia Code", "Fira Code", monospace`;
+  ctx.fillStyle = LABEL_MUTED;
+  ctx.textAlign = "right";
+  const values = att.params.map((p) => `${p.slice(-1)} = ${(params[p] ?? 0).toFixed(2)}`);
+  ctx.fillText(values.join("   "), clipToPixelX(xMax, w), clipToPixelY(yMin - 0.055, h));
+}
+
 // ─── Text formatting helpers ────────────────────────────────────────────────
 
 function subscriptDigits(n: number): string {
@@ -752,7 +1287,7 @@ function drawBaselAnnotations(
   h: number,
   params: Record<string, number>,
 ) {
-  const terms = Math.min(2000, Math.max(1, Math.round(params.terms ?? 40)));
+  const terms = Math.min(10_000_000, Math.max(1, Math.round(params.terms ?? 40)));
   const LIMIT = Math.PI * Math.PI / 6;
 
   const mLeft = 0.14, mRight = 0.06, mBottom = 0.12, mTop = 0.08;
@@ -761,8 +1296,7 @@ function drawBaselAnnotations(
   const yScale = LIMIT * 1.15;
 
   // Compute partial sum
-  let partialSum = 0;
-  for (let n = 1; n <= terms; n++) partialSum += 1 / (n * n);
+  const partialSum = cachedPartialSum("basel", terms, 1, (n) => 1 / (n * n));
 
   const baseFontSize = Math.max(10, Math.min(14, w * 0.012));
 
@@ -850,34 +1384,24 @@ function drawAltHarmonicAnnotations(
   h: number,
   params: Record<string, number>,
 ) {
-  const terms = Math.min(2000, Math.max(1, Math.round(params.terms ?? 30)));
-  const LIMIT = Math.LN2;
+  const terms = Math.min(10_000_000, Math.max(1, Math.round(params.terms ?? 30)));
+  const rearranged = (params.mode ?? 0) >= 0.5;
+  const target = Math.min(3, Math.max(-3, params.target ?? 1.5));
+  const LIMIT = rearranged ? target : Math.LN2;
 
   const mLeft = 0.14, mRight = 0.06, mBottom = 0.12, mTop = 0.08;
   const xMin = -1 + mLeft, xMax = 1 - mRight;
   const yMid = 0;
   const yExt = 1 - Math.max(mTop, mBottom);
 
-  // Pre-scan for scaling
-  let maxAbsVal = 0, maxAbsSum = 0;
-  {
-    let s = 0;
-    for (let n = 1; n <= terms; n++) {
-      const sign = n % 2 === 1 ? 1 : -1;
-      const term = sign / n;
-      maxAbsVal = Math.max(maxAbsVal, Math.abs(term));
-      s += term;
-      maxAbsSum = Math.max(maxAbsSum, Math.abs(s));
-    }
-  }
-  const scale = Math.max(maxAbsVal, maxAbsSum, 0.001);
+  // Scale the engine chose for the visible window; the whole-range maximum
+  // is the first term (|a₁| = 1 = S₁) if it is unavailable
+  const scale = _yScale > 0 ? _yScale : 1;
 
   // Compute final partial sum
-  let partialSum = 0;
-  for (let n = 1; n <= terms; n++) {
-    const sign = n % 2 === 1 ? 1 : -1;
-    partialSum += sign / n;
-  }
+  const partialSum = rearranged
+    ? rearrangedPartialSum(target, terms)
+    : cachedPartialSum("alt_harmonic", terms, 1, (n) => (n % 2 === 1 ? 1 : -1) / n);
 
   const baseFontSize = Math.max(10, Math.min(14, w * 0.012));
   ctx.textBaseline = "middle";
@@ -938,7 +1462,9 @@ function drawAltHarmonicAnnotations(
   ctx.textAlign = "center";
   ctx.textBaseline = "bottom";
   ctx.fillText(
-    `\u2211 (\u22121)\u207F\u207A\u00B9/n,  n = 1\u2026${terms}`,
+    rearranged
+      ? `\u2211 \u00B11/n rearranged towards ${target.toFixed(2)},  ${terms} terms`
+      : `\u2211 (\u22121)\u207F\u207A\u00B9/n,  n = 1\u2026${terms}`,
     clipToPixelX((xMin + xMax) / 2, w),
     clipToPixelY(1 - mTop + 0.05, h),
   );
@@ -959,12 +1485,89 @@ function drawAltHarmonicAnnotations(
   ctx.fillStyle = LIMIT_COLOR;
   ctx.textAlign = "right";
   ctx.fillText(
-    `Limit = ln(2) \u2248 ${LIMIT.toFixed(6)}`,
+    rearranged ? `Limit = ${LIMIT.toFixed(6)}` : `Limit = ln(2) \u2248 ${LIMIT.toFixed(6)}`,
     clipToPixelX(xMax - 0.01, w),
     clipToPixelY(1 - mTop + 0.04, h) + baseFontSize * 1.5,
   );
 }
 
+function drawRandomHarmonicAnnotations(
+  ctx: CanvasRenderingContext2D,
+  w: number,
+  h: number,
+  params: Record<string, number>,
+) {
+  const terms = Math.min(65_536, Math.max(16, Math.round(params.terms ?? 4096)));
+
+  // Same layout as the engine: the fan takes 74% of the plot width, the
+  // limit histogram the rest, both over sums in [−4, 4].
+  const mLeft = 0.14, mRight = 0.06, mBottom = 0.12, mTop = 0.08;
+  const xMin = -1 + mLeft, xMax = 1 - mRight;
+  const yMin = -1 + mBottom, yMax = 1 - mTop;
+  const xSplit = xMin + 0.74 * (xMax - xMin);
+  const xHist = xSplit + 0.03;
+  const clipY = (s: number) => yMin + ((yMax - yMin) * (s + 4)) / 8;
+
+  const baseFontSize = Math.max(10, Math.min(14, w * 0.012));
+
+  // n tick labels (bottom), powers of ten on the log axis
+  ctx.font = `${baseFontSize}px "SF Mono", "Cascadia Code", "Fira Code", monospace`;
+  ctx.fillStyle = LABEL_COLOR;
+  ctx.textAlign = "center";
+  ctx.textBaseline = "top";
+  for (let n = 1; n <= terms; n *= 10) {
+    const clipX = xMin + ((xSplit - xMin) * Math.log(n)) / Math.log(terms);
+    const px = viewClipX(clipX, w);
+    if (px < 0 || px > w) continue;
+    ctx.fillText(n.toLocaleString(), px, clipToPixelY(yMin - 0.025, h));
+  }
+
+  // Sum tick labels (left)
+  ctx.textAlign = "right";
+  ctx.textBaseline = "middle";
+  for (let s = -3; s <= 3; s++)
+    ctx.fillText(String(s), clipToPixelX(xMin - 0.02, w), clipToPixelY(clipY(s), h));
+
+  // Axis labels
+  ctx.font = `bold ${baseFontSize}px system-ui, sans-serif`;
+  ctx.textAlign = "center";
+  ctx.textBaseline = "top";
+  ctx.fillText(
+    "n (log scale)",
+    clipToPixelX((xMin + xSplit) / 2, w),
+    clipToPixelY(yMin - 0.075, h),
+  );
+  ctx.fillText("limit", clipToPixelX((xHist + xMax) / 2, w), clipToPixelY(yMin - 0.025, h));
+  ctx.save();
+  ctx.textBaseline = "middle";
+  ctx.translate(clipToPixelX(-1 + 0.025, w), clipToPixelY((yMin + yMax) / 2, h));
+  ctx.rotate(-Math.PI / 2);
+  ctx.fillText("S\u2099", 0, 0);
+  ctx.restore();
+
+  // Title / formula
+  ctx.font = `${baseFontSize * 1.1}px system-ui, sans-serif`;
+  ctx.fillStyle = FORMULA_COLOR;
+  ctx.textBaseline = "bottom";
+  ctx.fillText(
+    "S\u2099 = \u2211 \u00B11/k,  fair random signs",
+    clipToPixelX((xMin + xSplit) / 2, w),
+    clipToPixelY(yMax + 0.05, h),
+  );
+
+  // ±σ marks on the histogram
+  ctx.font = `italic ${baseFontSize * 0.9}px system-ui, sans-serif`;
+  ctx.fillStyle = LIMIT_COLOR;
+  ctx.textAlign = "right";
+  ctx.textBaseline = "bottom";
+  const sigma = Math.PI / Math.sqrt(6);
+  ctx.fillText(
+    `\u03C3 = \u03C0/\u221A6 \u2248 ${sigma.toFixed(4)}`,
+    clipToPixelX(xMax, w),
+    clipToPixelY(clipY(sigma) + 0.01, h),
+  );
+}
+
 function drawESeriesAnnotations(
   ctx: CanvasRenderingContext2D,
   w: number,
@@ -1158,13 +1761,119 @@ function drawInvGeometricAnnotations(
   );
 }
 
+/** Digits the Gregory–Leibniz digit mode extracted in the engine (plotReadout). */
+interface BbpReadout {
+  position: number;
+  digits: string;
+  count: number;
+  step: number;
+  histogramTop: number;
+}
+
+function drawBbpAnnotations(
+  ctx: CanvasRenderingContext2D,
+  w: number,
+  h: number,
+  params: Record<string, number>,
+) {
+  const readout = _readout as BbpReadout | null;
+  const position = readout?.position ?? Math.round(params.position ?? 1_000_000);
+  const count = readout?.count ?? Math.round(params.digits ?? 64);
+
+  // Layout as in GregoryLeibnizVisualizer::renderDigits
+  const mLeft = 0.14, mRight = 0.06, mBottom = 0.12, mTop = 0.08;
+  const xMin = -1 + mLeft, xMax = 1 - mRight;
+  const yMin = -1 + mBottom, yMax = 1 - mTop;
+  const gridBottom = -0.05, histTop = -0.2;
+  const columns = 16;
+  const rows = Math.ceil(count / columns);
+  const cellW = (xMax - xMin) / columns;
+  const cellH = (yMax - gridBottom) / Math.max(rows, 4);
+
+  const baseFontSize = Math.max(10, Math.min(14, w * 0.012));
+  const digits = readout?.digits ?? "";
+
+  // Digits in their cells, and the position of each row's first on the left
+  const digitSize = Math.min(baseFontSize * 1.2, cellH * h * 0.3);
+  ctx.font = `bold ${digitSize}px "SF Mono", "Cascadia Code", "Fira Code", monospace`;
+  ctx.fillStyle = LABEL_COLOR;
+  ctx.textAlign = "center";
+  ctx.textBaseline = "middle";
+  for (let i = 0; i < digits.length; i++) {
+    const cx = xMin + cellW * ((i % columns) + 0.5);
+    const cy = yMax - cellH * (Math.floor(i / columns) + 0.5);
+    ctx.fillText(digits[i], clipToPixelX(cx, w), clipToPixelY(cy, h));
+  }
+  ctx.font = `${baseFontSize * 0.85}px "SF Mono", "Cascadia Code", "Fira Code", monospace`;
+  ctx.textAlign = "right";
+  for (let r = 0; r < rows; r++) {
+    const cy = yMax - cellH * (r + 0.5);
+    const first = position + 1 + r * columns;
+    ctx.fillText(`${first}`, clipToPixelX(xMin - 0.02, w), clipToPixelY(cy, h));
+  }
+
+  // Histogram: digit values below, counts on the left
+  ctx.font = `${baseFontSize}px "SF Mono", "Cascadia Code", "Fira Code", monospace`;
+  ctx.textAlign = "center";
+  ctx.textBaseline = "top";
+  const barW = (xMax - xMin) / 16;
+  for (let v = 0; v < 16; v++) {
+    const cx = xMin + barW * (v + 0.5);
+    ctx.fillText(v.toString(16).toUpperCase(), clipToPixelX(cx, w), clipToPixelY(yMin - 0.02, h));
+  }
+  if (readout) {
+    ctx.textAlign = "right";
+    ctx.textBaseline = "middle";
+    ctx.fillText("0", clipToPixelX(xMin - 0.025, w), clipToPixelY(yMin, h));
+    ctx.fillText(
+      `${readout.histogramTop}`,
+      clipToPixelX(xMin - 0.025, w),
+      clipToPixelY(histTop, h),
+    );
+  }
+
+  // X-axis label
+  ctx.font = `bold ${baseFontSize}px system-ui, sans-serif`;
+  ctx.fillStyle = LABEL_COLOR;
+  ctx.textAlign = "center";
+  ctx.textBaseline = "top";
+  ctx.fillText("Hex digit", clipToPixelX((xMin + xMax) / 2, w), clipToPixelY(yMin - 0.07, h));
+
+  // Title / formula
+  ctx.font = `${baseFontSize * 1.1}px system-ui, sans-serif`;
+  ctx.fillStyle = FORMULA_COLOR;
+  ctx.textAlign = "center";
+  ctx.textBaseline = "bottom";
+  ctx.fillText(
+    `\u03C0 = \u2211 16\u207B\u1D4F (4/(8k+1) \u2212 2/(8k+4) \u2212 1/(8k+5) \u2212 1/(8k+6)):  hex digits ${position + 1}\u2026`,
+    clipToPixelX((xMin + xMax) / 2, w),
+    clipToPixelY(yMax + 0.05, h),
+  );
+
+  // Progress — top right of the histogram
+  if (!readout) return;
+  ctx.font = `${baseFontSize * 0.9}px "SF Mono", "Cascadia Code", "Fira Code", monospace`;
+  ctx.fillStyle = SUM_COLOR;
+  ctx.textAlign = "right";
+  ctx.textBaseline = "bottom";
+  ctx.fillText(
+    `${digits.length} of ${count} digits, ${readout.step} per extraction`,
+    clipToPixelX(xMax - 0.01, w),
+    clipToPixelY(histTop + 0.06, h),
+  );
+}
+
 function drawGregoryLeibnizAnnotations(
   ctx: CanvasRenderingContext2D,
   w: number,
   h: number,
   params: Record<string, number>,
 ) {
-  const terms = Math.min(2000, Math.max(1, Math.round(params.terms ?? 40)));
+  if ((params.mode ?? 0) >= 0.5) {
+    drawBbpAnnotations(ctx, w, h, params);
+    return;
+  }
+  const terms = Math.min(10_000_000, Math.max(1, Math.round(params.terms ?? 40)));
   const LIMIT = Math.PI / 4;
 
   const mLeft = 0.14, mRight = 0.06, mBottom = 0.12, mTop = 0.08;
@@ -1172,26 +1881,14 @@ function drawGregoryLeibnizAnnotations(
   const yMid = 0;
   const yExt = 1 - Math.max(mTop, mBottom);
 
-  // Pre-scan for scaling
-  let maxAbsVal = 0, maxAbsSum = 0;
-  {
-    let s = 0;
-    for (let n = 0; n < terms; n++) {
-      const sign = n % 2 === 0 ? 1 : -1;
-      const term = sign / (2 * n + 1);
-      maxAbsVal = Math.max(maxAbsVal, Math.abs(term));
-      s += term;
-      maxAbsSum = Math.max(maxAbsSum, Math.abs(s));
-    }
-  }
-  const scale = Math.max(maxAbsVal, maxAbsSum, 0.001);
+  // Scale the engine chose for the visible window; the whole-range maximum
+  // is the first term (|a₀| = 1 = S₀) if it is unavailable
+  const scale = _yScale > 0 ? _yScale : 1;
 
   // Compute final partial sum
-  let partialSum = 0;
-  for (let n = 0; n < terms; n++) {
-    const sign = n % 2 === 0 ? 1 : -1;
-    partialSum += sign / (2 * n + 1);
-  }
+  const partialSum = cachedPartialSum("gregory_leibniz", terms, 0, (n) =>
+    (n % 2 === 0 ? 1 : -1) / (2 * n + 1),
+  );
 
   const baseFontSize = Math.max(10, Math.min(14, w * 0.012));
   ctx.textBaseline = "middle";
@@ -1285,7 +1982,7 @@ function drawAperyAnnotations(
   h: number,
   params: Record<string, number>,
 ) {
-  const terms = Math.min(2000, Math.max(1, Math.round(params.terms ?? 30)));
+  const terms = Math.min(10_000_000, Math.max(1, Math.round(params.terms ?? 30)));
   const LIMIT = 1.20205690;
 
   const mLeft = 0.14, mRight = 0.06, mBottom = 0.12, mTop = 0.08;
@@ -1294,8 +1991,7 @@ function drawAperyAnnotations(
   const yScale = LIMIT * 1.15;
 
   // Compute partial sum
-  let partialSum = 0;
-  for (let n = 1; n <= terms; n++) partialSum += 1 / (n * n * n);
+  const partialSum = cachedPartialSum("apery", terms, 1, (n) => 1 / (n * n * n));
 
   const baseFontSize = Math.max(10, Math.min(14, w * 0.012));
 
@@ -1374,6 +2070,131 @@ function drawAperyAnnotations(
   );
 }
 
+/** Labels the infinite-product visualizer computes in the engine (plotReadout). */
+interface ProductReadout {
+  product: number;
+  factors: number;
+  value: string;
+  s: number;
+  limit?: string;
+  relativeError?: number;
+}
+
+// Formula and limit label of each product, indexed by the "product" parameter.
+const PRODUCTS = [
+  { formula: "\u220F 4n\u00B2/(4n\u00B2\u22121)", limit: "\u03C0/2" },
+  { formula: "\u220F 2/c\u2099,  c\u2099 = \u221A(2 + c\u2099\u208B\u2081)", limit: "\u03C0/2" },
+  { formula: "\u220F\u209A 1/(1 \u2212 p\u207B\u02E2)", limit: "\u03B6(s)" },
+];
+
+function drawInfiniteProductAnnotations(
+  ctx: CanvasRenderingContext2D,
+  w: number,
+  h: number,
+  params: Record<string, number>,
+) {
+  const readout = _readout as ProductReadout | null;
+  const terms = Math.min(10_000_000, Math.max(1, Math.round(params.terms ?? 30)));
+  const product = PRODUCTS[Math.min(2, Math.max(0, Math.round(params.product ?? 0)))];
+
+  const mLeft = 0.14, mRight = 0.06, mBottom = 0.12, mTop = 0.08;
+  const xMin = -1 + mLeft, xMax = 1 - mRight;
+  const yMin = -1 + mBottom, yMax = 1 - mTop;
+  // Scale the engine chose for the visible window (at least 1.15 × the limit)
+  const yScale = _yScale > 0 ? _yScale : (Math.PI / 2) * 1.15;
+
+  const baseFontSize = Math.max(10, Math.min(14, w * 0.012));
+
+  // Y-axis tick labels at the engine's gridlines
+  let tickStep = yScale / 4;
+  if (tickStep < 0.01) tickStep = 0.01;
+  const mag = Math.pow(10, Math.floor(Math.log10(tickStep)));
+  tickStep = Math.ceil(tickStep / mag) * mag;
+
+  ctx.font = `${baseFontSize}px "SF Mono", "Cascadia Code", "Fira Code", monospace`;
+  ctx.fillStyle = LABEL_COLOR;
+  ctx.textAlign = "right";
+  ctx.textBaseline = "middle";
+  for (let v = 0; v < yScale; v += tickStep) {
+    const clipY = yMin + (v / yScale) * (yMax - yMin);
+    ctx.fillText(formatTick(v), clipToPixelX(xMin - 0.025, w), clipToPixelY(clipY, h));
+  }
+
+  // X-axis: factor indices
+  ctx.textAlign = "center";
+  ctx.textBaseline = "top";
+  const barW = (xMax - xMin) / terms;
+  {
+    const step2 = xTickStep(terms);
+    for (let k = 1; k <= terms; k += step2) {
+      const cx = xMin + (k - 0.5) * barW;
+      const px = viewClipX(cx, w);
+      if (px < 0 || px > w) continue;
+      ctx.fillText(`${k}`, px, clipToPixelY(yMin - 0.02, h));
+    }
+  }
+
+  // Y-axis label
+  ctx.save();
+  ctx.font = `bold ${baseFontSize}px system-ui, sans-serif`;
+  ctx.fillStyle = LABEL_COLOR;
+  ctx.textAlign = "center";
+  ctx.textBaseline = "middle";
+  ctx.translate(clipToPixelX(-1 + 0.03, w), clipToPixelY((yMin + yMax) / 2, h));
+  ctx.rotate(-Math.PI / 2);
+  ctx.fillText("Product (bars: ln factor)", 0, 0);
+  ctx.restore();
+
+  // X-axis label
+  ctx.font = `bold ${baseFontSize}px system-ui, sans-serif`;
+  ctx.fillStyle = LABEL_COLOR;
+  ctx.textAlign = "center";
+  ctx.textBaseline = "top";
+  ctx.fillText("Factor (n)", clipToPixelX((xMin + xMax) / 2, w), clipToPixelY(yMin - 0.07, h));
+
+  // Title / formula
+  ctx.font = `${baseFontSize * 1.1}px system-ui, sans-serif`;
+  ctx.fillStyle = FORMULA_COLOR;
+  ctx.textAlign = "center";
+  ctx.textBaseline = "bottom";
+  ctx.fillText(
+    `${product.formula},  ${terms} factors`,
+    clipToPixelX((xMin + xMax) / 2, w),
+    clipToPixelY(yMax + 0.05, h),
+  );
+  if (!readout) return;
+
+  // Partial product and limit — top right
+  ctx.font = `bold ${baseFontSize * 1.05}px "SF Mono", "Cascadia Code", "Fira Code", monospace`;
+  ctx.fillStyle = SUM_COLOR;
+  ctx.textAlign = "right";
+  ctx.textBaseline = "top";
+  ctx.fillText(
+    `P${subscriptDigits(readout.factors)} = ${readout.value}`,
+    clipToPixelX(xMax - 0.01, w),
+    clipToPixelY(yMax + 0.04, h),
+  );
+
+  ctx.font = `bold ${baseFontSize}px "SF Mono", "Cascadia Code", "Fira Code", monospace`;
+  ctx.fillStyle = LIMIT_COLOR;
+  const limitName = product.limit.replace("s", readout.s.toFixed(2));
+  ctx.fillText(
+    readout.limit ? `Limit = ${limitName} = ${readout.limit}` : "Diverges  \u2192  \u221E",
+    clipToPixelX(xMax - 0.01, w),
+    clipToPixelY(yMax + 0.04, h) + baseFontSize * 1.5,
+  );
+
+  if (readout.relativeError !== undefined && readout.relativeError > 0) {
+    ctx.font = `${baseFontSize * 0.9}px "SF Mono", "Cascadia Code", "Fira Code", monospace`;
+    ctx.fillStyle = LABEL_MUTED;
+    ctx.fillText(
+      `|P/L \u2212 1| = ${readout.relativeError.toExponential(2)}`,
+      clipToPixelX(xMax - 0.01, w),
+      clipToPixelY(yMax + 0.04, h) + baseFontSize * 2.9,
+    );
+  }
+}
+
 // ─── Annotation dispatch ────────────────────────────────────────────────────
 
 const ANNOTATION_RENDERERS: Record<
@@ -1387,14 +2208,19 @@ const ANNOTATION_RENDERERS: Record<
 > = {
   cantor: drawCantorAnnotations,
   harmonic: drawHarmonicAnnotations,
+  kempner: drawKempnerAnnotations,
   geometric: drawGeometricAnnotations,
   logistic: drawLogisticAnnotations,
+  lyapunov: drawLyapunovAnnotations,
+  attractor: drawAttractorAnnotations,
   basel: drawBaselAnnotations,
   alt_harmonic: drawAltHarmonicAnnotations,
+  random_harmonic: drawRandomHarmonicAnnotations,
   e_series: drawESeriesAnnotations,
   inv_geometric: drawInvGeometricAnnotations,
   gregory_leibniz: drawGregoryLeibnizAnnotations,
   apery: drawAperyAnnotations,
+  infinite_product: drawInfiniteProductAnnotations,
 };
 
 // ─── App ────────────────────────────────────────────────────────────────────
@@ -1448,7 +2274,7 @@ export default function App() {
       t0Ref.current = performance.now() / 1000;
       const saved = paramValuesRef.current[name];
       if (saved) {
-        for (const [k, v] of Object.entries(saved)) mgr.setParam(k, v);
+        for (const [k, v] of Object.entries(saved)) sendParam(mgr, name, k, v);
       }
       // Reset view on switch
       viewScaleRef.current = 1;
@@ -1488,6 +2314,8 @@ export default function App() {
     // Set module-level view state for viewClipX
     _vScale = viewScaleRef.current;
     _vOffset = viewOffsetRef.current;
+    _yScale = managerRef.current?.getPlotScale?.() ?? 0;
+    _readout = JSON.parse(managerRef.current?.getPlotReadout?.() ?? "null");
 
     const viz = activeVizRef.current;
     const renderer = ANNOTATION_RENDERERS[viz];
@@ -1744,7 +2572,8 @@ export default function App() {
         ...prev,
         [activeViz]: { ...prev[activeViz], [name]: value },
       }));
-      managerRef.current?.setParam(name, value);
+      const mgr = managerRef.current;
+      if (mgr) sendParam(mgr, activeViz, name, value);
     },
     [activeViz],
   );
@@ -1890,20 +2719,21 @@ export default function App() {
                   <input
                     id={`p-${p.name}`}
                     type="range"
-                    min={p.min}
-                    max={p.max}
-                    step={p.step}
-                    value={val}
-                    onChange={(e) =>
-                      handleParam(p.name, parseFloat(e.target.value))
-                    }
+                    min={p.log ? Math.log10(p.min) : p.min}
+                    max={p.log ? Math.log10(p.max) : p.max}
+                    step={p.log ? 0.001 : p.step}
+                    value={p.log ? Math.log10(val) : val}
+                    onChange={(e) => {
+                      const x = parseFloat(e.target.value);
+                      handleParam(p.name, p.log ? Math.round(10 ** x) : x);
+                    }}
                     disabled={!glReady}
                     className="w-full h-2 cursor-pointer accent-primary"
                   />
 
                   <div className="flex justify-between text-[10px] text-muted-foreground/60">
-                    <span>{p.min}</span>
-                    <span>{p.max}</span>
+                    <span>{p.min.toLocaleString()}</span>
+                    <span>{p.max.toLocaleString()}</span>
                   </div>
                 </div>
               );
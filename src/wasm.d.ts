@@ -20,12 +20,89 @@ export interface SeriesManager {
   /** Get the key name of the currently active visualizer. */
   getActiveVisualizer(): string;
 
+  /**
+   * Y extent the active series plot autoscaled to for the visible window
+   * (the axis runs 0…scale, or ±scale for signed bars); 0 if none.
+   */
+  getPlotScale(): number;
+
+  /**
+   * Values the active visualizer computed for its labels, as a JSON object
+   * string (e.g. the Kempner limit to 20 digits), or "null".
+   */
+  getPlotReadout(): string;
+
   /** Set a named parameter on the active visualizer. */
   setParam(name: string, value: number): void;
 
   /** Set the horizontal pan/zoom view transform. */
   setView(scale: number, offsetX: number): void;
 
+  /**
+   * Select the vertex streaming strategy:
+   * 0 bufferdata, 1 orphan, 2 subdata, 3 ring.
+   */
+  setStreamMode(mode: number): void;
+  setVertexPulling(on: boolean): void;
+  setBatching(on: boolean): void;
+  setGpuBifurcation(on: boolean): void;
+
+  /**
+   * Compute/render pipelining: 1 renders synchronously (default), 2 builds
+   * the next frame's geometry on a worker while the current one draws, 3
+   * triple-buffers.  Adds depth − 1 frames of latency (see `getStats()`).
+   */
+  setPipelineDepth(depth: number): void;
+
+  /**
+   * Milliseconds per frame (default 12).  Long computations run as
+   * incremental tasks in whatever `render()` leaves of it, paused while
+   * their visualizer is inactive; their progress shows in `getStats()` as
+   * `tasksPending` / `tasksPaused` / `taskProgress` / `taskName`.
+   */
+  setFrameBudget(ms: number): void;
+
+  /**
+   * Counters for the last rendered frame, as a JSON object string.
+   * `dataflow` lists the visualizer's computation stages as
+   * `{node, inputs, ran, runs, ms}` (`ran`: recomputed this frame), or is
+   * null for visualizers without a stage graph.  Point-density visualizers
+   * (IFS mode, strange attractors) report `points` binned so far and the
+   * latest generation rate `pointsPerSec`; both are 0 elsewhere.
+   */
+  getStats(): string;
+
+  /**
+   * Stream `terms` rows of (index, term, partial sum, error vs limit) for a
+   * series visualizer key in bounded memory.  `format` 0 yields little-endian
+   * float64 columns per chunk ([index×rows][term×rows][sum×rows][error×rows],
+   * readable as `new Float64Array(bytes.buffer, bytes.byteOffset, rows * 4)`),
+   * 1 yields CSV text.  `bytes` views WASM memory and is only valid during
+   * the callback — copy it out; return `false` to stop early.
+   * Returns a JSON summary `{rows, bytes, chunks, cancelled, ms}`.
+   */
+  exportPartialSums(
+    series: string,
+    terms: number,
+    format: number,
+    chunkRows: number,
+    onChunk: (bytes: Uint8Array, firstRow: number, rows: number) => boolean | void,
+  ): string;
+
+  /**
+   * Versioned binary snapshot of params, view and active visualizer, plus
+   * computed caches (e.g. the logistic attractor) when `includeCaches` is
+   * set.  Suitable for storing in IndexedDB.
+   */
+  serialize(includeCaches: boolean): Uint8Array;
+
+  /**
+   * Restore a snapshot from `serialize()`.  Returns false (and changes
+   * nothing) if the blob is malformed or from another version; the restore
+   * time is reported as `restoreMs` in `getStats()`.
+   */
+  deserialize(blob: Uint8Array): boolean;
+
   /** Release the C++ instance (call when done). */
   delete(): void;
 }